@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# Copyright (c) 2018 The HooliBet developers
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+'''
+Script to generate the tables of invalid outpoints and zerocoin serials
+for invalid.cpp.
+
+This script expects two JSON files in the directory that is passed as an
+argument:
+
+    invalid_outpoints.json  [{"txid": "<hex>", "n": <index>}, ...]
+    invalid_serials.json    [{"s": "<hex>"}, ...]
+
+The output is written to stdout and should be saved as `src/invalid_tables.h`.
+Both tables are sorted and bucketed by their first byte, so a lookup only
+compares the few entries of one bucket:
+
+   static const unsigned char pnInvalidOutPoints[][36] = {...};
+   static const uint16_t pnInvalidOutPointsIndex[257] = {...};
+   static const unsigned char pnInvalidSerialHashes[][32] = {...};
+   static const uint16_t pnInvalidSerialHashesIndex[257] = {...};
+'''
+
+from binascii import a2b_hex
+import hashlib
+import json
+import os
+import struct
+import sys
+
+def outpoint_key(entry):
+    '''txid in uint256 byte order followed by n in little endian, as COutPoint serializes'''
+    txid = a2b_hex(entry['txid'])
+    if len(txid) != 32 or txid == bytes(32):
+        raise ValueError('Invalid txid %s' % entry['txid'])
+    return txid[::-1] + struct.pack('<I', entry['n'])
+
+def serial_hash(entry):
+    '''GetSerialHash(): double SHA256 of the serialized CBigNum'''
+    value = int(entry['s'], 16)
+    if value <= 0:
+        raise ValueError('Invalid serial %s' % entry['s'])
+    # CBigNum::getvch(): little endian magnitude, with a spare byte for the sign bit
+    vch = value.to_bytes((value.bit_length() + 7) // 8, 'big')
+    if vch[0] & 0x80:
+        vch = b'\x00' + vch
+    vch = vch[::-1]
+    assert len(vch) < 253
+    data = bytes([len(vch)]) + vch
+    return hashlib.sha256(hashlib.sha256(data).digest()).digest()
+
+def process_table(g, name, keys, size):
+    keys = sorted(set(keys))
+    assert len(keys) < 65536
+    index = [0] * 257
+    for key in keys:
+        index[key[0] + 1] += 1
+    for i in range(256):
+        index[i + 1] += index[i]
+
+    g.write('static const unsigned char %s[][%d] = {\n' % (name, size))
+    for i, key in enumerate(keys):
+        assert len(key) == size
+        g.write('    {%s}' % ','.join('0x%02x' % b for b in key))
+        g.write(',\n' if i != len(keys) - 1 else '\n')
+    g.write('};\n\n')
+    g.write('static const uint16_t %sIndex[257] = {\n' % name)
+    for i in range(0, 257, 16):
+        g.write('    %s' % ', '.join('%d' % n for n in index[i:i + 16]))
+        g.write(',\n' if i + 16 < 257 else '\n')
+    g.write('};\n')
+
+def main():
+    if len(sys.argv) < 2:
+        print(('Usage: %s <path_to_json_files>' % sys.argv[0]), file=sys.stderr)
+        sys.exit(1)
+    g = sys.stdout
+    indir = sys.argv[1]
+    with open(os.path.join(indir, 'invalid_outpoints.json'), 'r', encoding="utf8") as f:
+        outpoints = [outpoint_key(entry) for entry in json.load(f)]
+    with open(os.path.join(indir, 'invalid_serials.json'), 'r', encoding="utf8") as f:
+        serials = [serial_hash(entry) for entry in json.load(f)]
+
+    g.write('#ifndef HOOLIBET_INVALID_TABLES_H\n')
+    g.write('#define HOOLIBET_INVALID_TABLES_H\n')
+    g.write('/**\n')
+    g.write(' * Outpoints and zerocoin serials banned from the chain\n')
+    g.write(' * AUTOGENERATED by contrib/invalid/generate-invalid.py\n')
+    g.write(' *\n')
+    g.write(' * Each outpoint is its 32-byte txid followed by n in little endian, each serial\n')
+    g.write(' * its GetSerialHash(). Entries are sorted, and the index holds the first entry\n')
+    g.write(' * starting with each byte value.\n')
+    g.write(' */\n')
+    g.write('#include <stdint.h>\n\n')
+    process_table(g, 'pnInvalidOutPoints', outpoints, 36)
+    g.write('\n')
+    process_table(g, 'pnInvalidSerialHashes', serials, 32)
+    g.write('#endif // HOOLIBET_INVALID_TABLES_H\n')
+
+if __name__ == '__main__':
+    main()
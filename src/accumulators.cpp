@@ -6,6 +6,7 @@
 #include "accumulatormap.h"
 #include "chainparams.h"
 #include "main.h"
+#include "perfstats.h"
 #include "txdb.h"
 #include "init.h"
 #include "spork.h"
@@ -231,6 +232,7 @@ bool InitializeAccumulators(const int nHeight, int& nHeightCheckpoint, Accumulat
 //Get checkpoint value for a specific block height
 bool CalculateAccumulatorCheckpoint(int nHeight, uint256& nCheckpoint, AccumulatorMap& mapAccumulators)
 {
+    PERF_TIMER("zerocoin.checkpoint.calculate");
     if (nHeight < Params().Zerocoin_Block_V2_Start()) {
         nCheckpoint = 0;
         return true;
@@ -303,6 +305,7 @@ bool InvalidCheckpointRange(int nHeight)
 
 bool ValidateAccumulatorCheckpoint(const CBlock& block, CBlockIndex* pindex, AccumulatorMap& mapAccumulators)
 {
+    PERF_TIMER("zerocoin.checkpoint.validate");
     //V1 accumulators are completely phased out by the time this code hits the public and begins generating new checkpoints
     //It is VERY IMPORTANT that when this is being run and height < v2_start, then zHBET need to be disabled at the same time!!
     if (pindex->nHeight < Params().Zerocoin_Block_V2_Start() || fVerifyingBlocks)
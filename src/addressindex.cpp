@@ -0,0 +1,34 @@
+// Copyright (c) 2016 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "addressindex.h"
+
+#include "hash.h"
+
+#include <string.h>
+
+bool GetAddressIndexKey(const CScript& script, int& nAddressType, uint160& hashBytes)
+{
+    // Match the templates byte by byte; this runs for every output of every connected block
+    if (script.size() == 25 && script[0] == OP_DUP && script[1] == OP_HASH160 && script[2] == 20 &&
+        script[23] == OP_EQUALVERIFY && script[24] == OP_CHECKSIG) {
+        nAddressType = ADDRESS_P2PKH;
+        memcpy(hashBytes.begin(), &script[3], 20);
+        return true;
+    }
+    if (script.IsPayToScriptHash()) {
+        nAddressType = ADDRESS_P2SH;
+        memcpy(hashBytes.begin(), &script[2], 20);
+        return true;
+    }
+    // Pay-to-pubkey, as used by coinbases and stakes, with a compressed or uncompressed key
+    if ((script.size() == 35 && script[0] == 33 && script[34] == OP_CHECKSIG) ||
+        (script.size() == 67 && script[0] == 65 && script[66] == OP_CHECKSIG)) {
+        nAddressType = ADDRESS_P2PKH;
+        hashBytes = Hash160(script.begin() + 1, script.end() - 1);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,239 @@
+// Copyright (c) 2016 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef HOOLIBET_ADDRESSINDEX_H
+#define HOOLIBET_ADDRESSINDEX_H
+
+#include "amount.h"
+#include "script/script.h"
+#include "serialize.h"
+#include "uint256.h"
+
+#include <stdint.h>
+
+/** Defaults for -addressindex, -spentindex and -timestampindex */
+static const bool DEFAULT_ADDRESSINDEX = false;
+static const bool DEFAULT_SPENTINDEX = false;
+static const bool DEFAULT_TIMESTAMPINDEX = false;
+
+/** Address types in the index keys; pay-to-pubkey outputs are indexed under the key's P2PKH address */
+enum AddressIndexType {
+    ADDRESS_NONE = 0,
+    ADDRESS_P2PKH = 1,
+    ADDRESS_P2SH = 2,
+};
+
+/** The address type and hash an output script pays to, false for scripts that pay no address */
+bool GetAddressIndexKey(const CScript& script, int& nAddressType, uint160& hashBytes);
+
+/**
+ * Heights and positions are stored big endian in the keys, so that LevelDB
+ * iterates the entries of an address in chain order.
+ */
+template <typename Stream>
+inline void WriteIndexBE32(Stream& s, uint32_t n)
+{
+    unsigned char buf[4] = {(unsigned char)(n >> 24), (unsigned char)(n >> 16), (unsigned char)(n >> 8), (unsigned char)n};
+    s.write((char*)buf, 4);
+}
+
+template <typename Stream>
+inline uint32_t ReadIndexBE32(Stream& s)
+{
+    unsigned char buf[4];
+    s.read((char*)buf, 4);
+    return ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) | ((uint32_t)buf[2] << 8) | (uint32_t)buf[3];
+}
+
+/** One change to the balance of an address: an output paying it or an input spending from it */
+struct CAddressIndexKey {
+    unsigned char nAddressType;
+    uint160 hashBytes;
+    int nBlockHeight;
+    unsigned int nTxIndex;
+    uint256 txhash;
+    unsigned int nIndex;
+    bool fSpending;
+
+    CAddressIndexKey() : nAddressType(ADDRESS_NONE), nBlockHeight(0), nTxIndex(0), nIndex(0), fSpending(false) {}
+    CAddressIndexKey(int nTypeIn, const uint160& hashBytesIn, int nBlockHeightIn, unsigned int nTxIndexIn, const uint256& txhashIn, unsigned int nIndexIn, bool fSpendingIn)
+        : nAddressType(nTypeIn), hashBytes(hashBytesIn), nBlockHeight(nBlockHeightIn), nTxIndex(nTxIndexIn), txhash(txhashIn), nIndex(nIndexIn), fSpending(fSpendingIn) {}
+
+    unsigned int GetSerializeSize(int nType, int nVersion) const
+    {
+        return 1 + 20 + 4 + 4 + 32 + 4 + 1;
+    }
+
+    template <typename Stream>
+    void Serialize(Stream& s, int nSerType, int nVersion) const
+    {
+        ::Serialize(s, nAddressType, nSerType, nVersion);
+        hashBytes.Serialize(s, nSerType, nVersion);
+        WriteIndexBE32(s, nBlockHeight);
+        WriteIndexBE32(s, nTxIndex);
+        txhash.Serialize(s, nSerType, nVersion);
+        ::Serialize(s, nIndex, nSerType, nVersion);
+        ::Serialize(s, fSpending, nSerType, nVersion);
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s, int nSerType, int nVersion)
+    {
+        ::Unserialize(s, nAddressType, nSerType, nVersion);
+        hashBytes.Unserialize(s, nSerType, nVersion);
+        nBlockHeight = ReadIndexBE32(s);
+        nTxIndex = ReadIndexBE32(s);
+        txhash.Unserialize(s, nSerType, nVersion);
+        ::Unserialize(s, nIndex, nSerType, nVersion);
+        ::Unserialize(s, fSpending, nSerType, nVersion);
+    }
+};
+
+/** The prefix of the CAddressIndexKey entries of an address, optionally from a height on */
+struct CAddressIndexIteratorKey {
+    unsigned char nAddressType;
+    uint160 hashBytes;
+    bool fHeight;
+    int nBlockHeight;
+
+    CAddressIndexIteratorKey(int nTypeIn, const uint160& hashBytesIn) : nAddressType(nTypeIn), hashBytes(hashBytesIn), fHeight(false), nBlockHeight(0) {}
+    CAddressIndexIteratorKey(int nTypeIn, const uint160& hashBytesIn, int nBlockHeightIn) : nAddressType(nTypeIn), hashBytes(hashBytesIn), fHeight(true), nBlockHeight(nBlockHeightIn) {}
+
+    unsigned int GetSerializeSize(int nType, int nVersion) const
+    {
+        return fHeight ? 1 + 20 + 4 : 1 + 20;
+    }
+
+    template <typename Stream>
+    void Serialize(Stream& s, int nSerType, int nVersion) const
+    {
+        ::Serialize(s, nAddressType, nSerType, nVersion);
+        hashBytes.Serialize(s, nSerType, nVersion);
+        if (fHeight)
+            WriteIndexBE32(s, nBlockHeight);
+    }
+};
+
+/** An unspent output paying an address */
+struct CAddressUnspentKey {
+    unsigned char nAddressType;
+    uint160 hashBytes;
+    uint256 txhash;
+    unsigned int nIndex;
+
+    CAddressUnspentKey() : nAddressType(ADDRESS_NONE), nIndex(0) {}
+    CAddressUnspentKey(int nTypeIn, const uint160& hashBytesIn, const uint256& txhashIn, unsigned int nIndexIn)
+        : nAddressType(nTypeIn), hashBytes(hashBytesIn), txhash(txhashIn), nIndex(nIndexIn) {}
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(nAddressType);
+        READWRITE(hashBytes);
+        READWRITE(txhash);
+        READWRITE(nIndex);
+    }
+};
+
+struct CAddressUnspentValue {
+    CAmount nSatoshis;
+    CScript script;
+    int nBlockHeight;
+
+    CAddressUnspentValue() : nSatoshis(-1), nBlockHeight(0) {}
+    CAddressUnspentValue(CAmount nSatoshisIn, const CScript& scriptIn, int nBlockHeightIn) : nSatoshis(nSatoshisIn), script(scriptIn), nBlockHeight(nBlockHeightIn) {}
+
+    //! A null value erases the entry in the batch it is written with
+    bool IsNull() const { return nSatoshis == -1; }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(nSatoshis);
+        READWRITE(script);
+        READWRITE(nBlockHeight);
+    }
+};
+
+/** The input spending an output */
+struct CSpentIndexKey {
+    uint256 txid;
+    unsigned int nOutputIndex;
+
+    CSpentIndexKey() : nOutputIndex(0) {}
+    CSpentIndexKey(const uint256& txidIn, unsigned int nOutputIndexIn) : txid(txidIn), nOutputIndex(nOutputIndexIn) {}
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(txid);
+        READWRITE(nOutputIndex);
+    }
+};
+
+struct CSpentIndexValue {
+    uint256 txid;
+    unsigned int nInputIndex;
+    int nBlockHeight;
+    CAmount nSatoshis;
+    int nAddressType;
+    uint160 addressHash;
+
+    CSpentIndexValue() : nInputIndex(0), nBlockHeight(0), nSatoshis(0), nAddressType(ADDRESS_NONE) {}
+    CSpentIndexValue(const uint256& txidIn, unsigned int nInputIndexIn, int nBlockHeightIn, CAmount nSatoshisIn, int nAddressTypeIn, const uint160& addressHashIn)
+        : txid(txidIn), nInputIndex(nInputIndexIn), nBlockHeight(nBlockHeightIn), nSatoshis(nSatoshisIn), nAddressType(nAddressTypeIn), addressHash(addressHashIn) {}
+
+    //! A null value erases the entry in the batch it is written with
+    bool IsNull() const { return txid == 0; }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(txid);
+        READWRITE(nInputIndex);
+        READWRITE(nBlockHeight);
+        READWRITE(nSatoshis);
+        READWRITE(nAddressType);
+        READWRITE(addressHash);
+    }
+};
+
+/** A block by its timestamp */
+struct CTimestampIndexKey {
+    unsigned int nTimestamp;
+    uint256 blockHash;
+
+    CTimestampIndexKey() : nTimestamp(0) {}
+    CTimestampIndexKey(unsigned int nTimestampIn, const uint256& blockHashIn) : nTimestamp(nTimestampIn), blockHash(blockHashIn) {}
+
+    unsigned int GetSerializeSize(int nType, int nVersion) const
+    {
+        return 4 + 32;
+    }
+
+    template <typename Stream>
+    void Serialize(Stream& s, int nSerType, int nVersion) const
+    {
+        WriteIndexBE32(s, nTimestamp);
+        blockHash.Serialize(s, nSerType, nVersion);
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream& s, int nSerType, int nVersion)
+    {
+        nTimestamp = ReadIndexBE32(s);
+        blockHash.Unserialize(s, nSerType, nVersion);
+    }
+};
+
+#endif // HOOLIBET_ADDRESSINDEX_H
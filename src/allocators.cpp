@@ -4,6 +4,10 @@
 
 #include "allocators.h"
 
+#include "memusage.h"
+
+#include <algorithm>
+
 #ifdef WIN32
 #ifdef _WIN32_WINNT
 #undef _WIN32_WINNT
@@ -64,3 +68,98 @@ bool MemoryPageLocker::Unlock(const void* addr, size_t len)
 LockedPageManager::LockedPageManager() : LockedPageManagerBase<MemoryPageLocker>(GetSystemPageSize())
 {
 }
+
+const size_t CPoolResource::BLOCK_ALIGN;
+const size_t CPoolResource::MAX_BLOCK_SIZE;
+const size_t CPoolResource::MIN_CHUNK_SIZE;
+const size_t CPoolResource::MAX_CHUNK_SIZE;
+
+CPoolResource::CPoolResource() : pChunkNext(NULL), pChunkEnd(NULL), nNextChunkSize(MIN_CHUNK_SIZE), nChunkUsage(0), nLargeUsage(0), nBlocksInUse(0)
+{
+    memset(vFree, 0, sizeof(vFree));
+}
+
+CPoolResource::~CPoolResource()
+{
+    for (std::vector<char*>::iterator it = vChunks.begin(); it != vChunks.end(); ++it)
+        ::operator delete(*it);
+}
+
+void CPoolResource::PushFree(void* p, size_t nClass)
+{
+    FreeBlock* pblock = static_cast<FreeBlock*>(p);
+    pblock->pnext = vFree[nClass];
+    vFree[nClass] = pblock;
+}
+
+void CPoolResource::NewChunk()
+{
+    // Keep what is left of the current chunk in the free lists
+    size_t nLeft = pChunkEnd - pChunkNext;
+    while (nLeft >= BLOCK_ALIGN) {
+        size_t nBlock = std::min(nLeft, MAX_BLOCK_SIZE) / BLOCK_ALIGN * BLOCK_ALIGN;
+        PushFree(pChunkNext, nBlock / BLOCK_ALIGN - 1);
+        pChunkNext += nBlock;
+        nLeft -= nBlock;
+    }
+
+    // Start small, so that short lived containers stay cheap, and double from there
+    size_t nSize = nNextChunkSize;
+    nNextChunkSize = std::min(2 * nNextChunkSize, MAX_CHUNK_SIZE);
+    char* pchunk = static_cast<char*>(::operator new(nSize));
+    vChunks.push_back(pchunk);
+    nChunkUsage += memusage::MallocUsage(nSize);
+    pChunkNext = pchunk;
+    pChunkEnd = pchunk + nSize;
+}
+
+void* CPoolResource::Allocate(size_t nBytes)
+{
+    if (nBytes > MAX_BLOCK_SIZE) {
+        nLargeUsage += memusage::MallocUsage(nBytes);
+        return ::operator new(nBytes);
+    }
+
+    size_t nClass = (std::max(nBytes, (size_t)1) + BLOCK_ALIGN - 1) / BLOCK_ALIGN - 1;
+    nBlocksInUse++;
+    if (vFree[nClass] != NULL) {
+        FreeBlock* pblock = vFree[nClass];
+        vFree[nClass] = pblock->pnext;
+        return pblock;
+    }
+    size_t nBlock = (nClass + 1) * BLOCK_ALIGN;
+    if ((size_t)(pChunkEnd - pChunkNext) < nBlock)
+        NewChunk();
+    void* p = pChunkNext;
+    pChunkNext += nBlock;
+    return p;
+}
+
+void CPoolResource::Deallocate(void* p, size_t nBytes)
+{
+    if (nBytes > MAX_BLOCK_SIZE) {
+        nLargeUsage -= memusage::MallocUsage(nBytes);
+        ::operator delete(p);
+        return;
+    }
+    PushFree(p, (std::max(nBytes, (size_t)1) + BLOCK_ALIGN - 1) / BLOCK_ALIGN - 1);
+    nBlocksInUse--;
+}
+
+void CPoolResource::Release()
+{
+    if (nBlocksInUse != 0)
+        return;
+    for (std::vector<char*>::iterator it = vChunks.begin(); it != vChunks.end(); ++it)
+        ::operator delete(*it);
+    vChunks.clear();
+    memset(vFree, 0, sizeof(vFree));
+    pChunkNext = pChunkEnd = NULL;
+    nNextChunkSize = MIN_CHUNK_SIZE;
+    nChunkUsage = 0;
+}
+
+size_t CPoolResource::DynamicMemoryUsage() const
+{
+    return nChunkUsage + nLargeUsage;
+}
@@ -7,6 +7,7 @@
 #define BITCOIN_ALLOCATORS_H
 
 #include <map>
+#include <stddef.h>
 #include <string.h>
 #include <string>
 #include <vector>
@@ -258,6 +259,110 @@ struct zero_after_free_allocator : public std::allocator<T> {
     }
 };
 
+/**
+ * Memory pool for containers that allocate their elements one at a time, like
+ * the nodes of a boost::unordered_map. Blocks up to MAX_BLOCK_SIZE bytes are
+ * cut from chunks of growing size and recycled through one free list per
+ * size, so filling and emptying a container rarely goes to malloc. Larger
+ * blocks pass through to operator new. Not thread-safe.
+ */
+class CPoolResource
+{
+public:
+    static const size_t BLOCK_ALIGN = 16;
+    static const size_t MAX_BLOCK_SIZE = 256;
+    static const size_t MIN_CHUNK_SIZE = 4096;
+    static const size_t MAX_CHUNK_SIZE = 1 << 20;
+
+private:
+    struct FreeBlock {
+        FreeBlock* pnext;
+    };
+
+    FreeBlock* vFree[MAX_BLOCK_SIZE / BLOCK_ALIGN];
+    std::vector<char*> vChunks;
+    char* pChunkNext;
+    char* pChunkEnd;
+    size_t nNextChunkSize;
+    size_t nChunkUsage;
+    size_t nLargeUsage;
+    size_t nBlocksInUse;
+
+    CPoolResource(const CPoolResource&);
+    void operator=(const CPoolResource&);
+
+    void PushFree(void* p, size_t nClass);
+    void NewChunk();
+
+public:
+    CPoolResource();
+    ~CPoolResource();
+
+    void* Allocate(size_t nBytes);
+    void Deallocate(void* p, size_t nBytes);
+    /** Give all chunks back to the system; only done when no block is in use */
+    void Release();
+    /** Bytes held from malloc, in use or free */
+    size_t DynamicMemoryUsage() const;
+};
+
+//
+// Allocator that takes its memory from a CPoolResource, or from operator new
+// when it has none (default constructed).
+//
+template <typename T>
+struct pool_allocator {
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T value_type;
+
+    CPoolResource* resource;
+
+    pool_allocator() throw() : resource(NULL) {}
+    explicit pool_allocator(CPoolResource* resourceIn) throw() : resource(resourceIn) {}
+    template <typename U>
+    pool_allocator(const pool_allocator<U>& a) throw() : resource(a.resource)
+    {
+    }
+    template <typename _Other>
+    struct rebind {
+        typedef pool_allocator<_Other> other;
+    };
+
+    T* allocate(std::size_t n, const void* hint = 0)
+    {
+        if (resource == NULL)
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        return static_cast<T*>(resource->Allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+        if (resource == NULL)
+            ::operator delete(p);
+        else
+            resource->Deallocate(p, n * sizeof(T));
+    }
+
+    size_type max_size() const throw() { return size_type(-1) / sizeof(T); }
+};
+
+template <typename T, typename U>
+bool operator==(const pool_allocator<T>& a, const pool_allocator<U>& b)
+{
+    return a.resource == b.resource;
+}
+
+template <typename T, typename U>
+bool operator!=(const pool_allocator<T>& a, const pool_allocator<U>& b)
+{
+    return a.resource != b.resource;
+}
+
 // This is exactly like std::string, but with a custom allocator.
 typedef std::basic_string<char, std::char_traits<char>, secure_allocator<char> > SecureString;
 
@@ -0,0 +1,129 @@
+// Copyright (c) 2015 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <regex>
+
+#include <univalue.h>
+
+static double gettimedouble(void)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+benchmark::BenchRunner::BenchmarkMap& benchmark::BenchRunner::benchmarks()
+{
+    static std::map<std::string, BenchFunction> benchmarks_map;
+    return benchmarks_map;
+}
+
+benchmark::BenchRunner::BenchRunner(const std::string& name, benchmark::BenchFunction func)
+{
+    benchmarks().insert(std::make_pair(name, func));
+}
+
+void benchmark::BenchRunner::ListAll()
+{
+    for (BenchmarkMap::const_iterator it = benchmarks().begin(); it != benchmarks().end(); ++it)
+        std::cout << it->first << std::endl;
+}
+
+std::vector<benchmark::Result> benchmark::BenchRunner::RunAll(const Options& options)
+{
+    std::regex reFilter(options.strFilter);
+    std::vector<Result> vResults;
+    for (BenchmarkMap::iterator it = benchmarks().begin(); it != benchmarks().end(); ++it) {
+        if (!std::regex_match(it->first, reFilter))
+            continue;
+        State state(it->first, options);
+        it->second(state);
+        vResults.push_back(state.GetResult());
+    }
+    return vResults;
+}
+
+void benchmark::BenchRunner::Print(const std::vector<Result>& vResults, const Options& options)
+{
+    if (options.strFormat == "json") {
+        UniValue results(UniValue::VARR);
+        for (std::vector<Result>::const_iterator it = vResults.begin(); it != vResults.end(); ++it) {
+            UniValue result(UniValue::VOBJ);
+            result.push_back(Pair("name", it->name));
+            result.push_back(Pair("iterations", (uint64_t)it->nIterations));
+            result.push_back(Pair("total", it->dTotal));
+            result.push_back(Pair("min", it->dMin));
+            result.push_back(Pair("max", it->dMax));
+            result.push_back(Pair("average", it->Average()));
+            results.push_back(result);
+        }
+        std::cout << results.write(2) << std::endl;
+        return;
+    }
+
+    std::cout << "#Benchmark,count,min,max,average,total" << std::endl;
+    for (std::vector<Result>::const_iterator it = vResults.begin(); it != vResults.end(); ++it)
+        std::cout << it->name << "," << it->nIterations << "," << it->dMin << "," << it->dMax << "," << it->Average() << "," << it->dTotal << std::endl;
+}
+
+benchmark::State::State(const std::string& _name, const Options& _options)
+    : name(_name), options(_options), nWarmupLeft(_options.nWarmup), count(0), nBatch(1), nNextCheck(0), nLastCount(0),
+      beginTime(0), lastTime(0), minTime(std::numeric_limits<double>::max()), maxTime(0)
+{
+}
+
+bool benchmark::State::KeepRunning()
+{
+    // Warm caches and lazily built state before anything is measured
+    if (nWarmupLeft > 0) {
+        --nWarmupLeft;
+        return true;
+    }
+    if (count < nNextCheck) {
+        ++count;
+        return true;
+    }
+
+    // count iterations have completed; the clock is read once per batch of them
+    double now = gettimedouble();
+    double elapsed = 0;
+    if (count == 0) {
+        beginTime = now;
+    } else {
+        elapsed = now - lastTime;
+        double perIteration = elapsed / (count - nLastCount);
+        minTime = std::min(minTime, perIteration);
+        maxTime = std::max(maxTime, perIteration);
+    }
+    lastTime = now;
+    nLastCount = count;
+
+    if (options.nIterations > 0 ? count >= options.nIterations : now - beginTime >= options.dMaxElapsed)
+        return false;
+
+    // Time batches of iterations once a single one is too quick for the clock to measure well
+    if (count > 0 && elapsed < 0.0001 && nBatch < (1 << 20))
+        nBatch *= 2;
+    nNextCheck = count + nBatch;
+    if (options.nIterations > 0)
+        nNextCheck = std::min(nNextCheck, options.nIterations);
+    ++count;
+    return true;
+}
+
+benchmark::Result benchmark::State::GetResult() const
+{
+    Result result;
+    result.name = name;
+    result.nIterations = count;
+    result.dTotal = count ? lastTime - beginTime : 0;
+    result.dMin = count ? minTime : 0;
+    result.dMax = maxTime;
+    return result;
+}
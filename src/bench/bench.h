@@ -0,0 +1,108 @@
+// Copyright (c) 2015 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef HOOLIBET_BENCH_BENCH_H
+#define HOOLIBET_BENCH_BENCH_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include <boost/function.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/stringize.hpp>
+
+// Simple micro-benchmarking framework; API mostly matches a subset of the Google Benchmark
+// framework (see https://github.com/google/benchmark)
+// Why not use the Google Benchmark framework? Because adding Yet Another Dependency
+// (that uses cmake as its build system and has lots of features we don't need) isn't
+// worth it.
+
+/*
+ * Usage:
+
+static void CODE_TO_TIME(benchmark::State& state)
+{
+    ... do any setup needed...
+    while (state.KeepRunning()) {
+       ... do stuff you want to time...
+    }
+    ... do any cleanup needed...
+}
+
+BENCHMARK(CODE_TO_TIME);
+
+ */
+
+namespace benchmark
+{
+/** How long each benchmark runs, which ones run and how the results are printed */
+struct Options {
+    uint64_t nWarmup;        //! untimed iterations before measuring starts
+    uint64_t nIterations;    //! timed iterations, or 0 to run for dMaxElapsed seconds
+    double dMaxElapsed;      //! seconds to measure for when nIterations is 0
+    std::string strFilter;   //! regular expression the names to run must match
+    std::string strFormat;   //! "csv" or "json"
+
+    Options() : nWarmup(1), nIterations(0), dMaxElapsed(1.0), strFilter(".*"), strFormat("csv") {}
+};
+
+/** The measurements of one benchmark run */
+struct Result {
+    std::string name;
+    uint64_t nIterations;
+    double dTotal;
+    double dMin;
+    double dMax;
+
+    double Average() const { return nIterations ? dTotal / nIterations : 0; }
+};
+
+class State
+{
+    std::string name;
+    const Options& options;
+    uint64_t nWarmupLeft;
+    uint64_t count;
+    uint64_t nBatch;
+    uint64_t nNextCheck;
+    uint64_t nLastCount;
+    double beginTime;
+    double lastTime;
+    double minTime;
+    double maxTime;
+
+public:
+    State(const std::string& _name, const Options& _options);
+
+    //! Whether to run the loop body once more; times the iterations between warmup and the end
+    bool KeepRunning();
+
+    Result GetResult() const;
+};
+
+typedef boost::function<void(State&)> BenchFunction;
+
+class BenchRunner
+{
+    typedef std::map<std::string, BenchFunction> BenchmarkMap;
+    static BenchmarkMap& benchmarks();
+
+public:
+    BenchRunner(const std::string& name, BenchFunction func);
+
+    static void ListAll();
+    static std::vector<Result> RunAll(const Options& options);
+    static void Print(const std::vector<Result>& vResults, const Options& options);
+};
+} // namespace benchmark
+
+// BENCHMARK(foo) expands to:  benchmark::BenchRunner bench_11foo("foo", foo);
+#define BENCHMARK(n) \
+    benchmark::BenchRunner BOOST_PP_CAT(bench_, BOOST_PP_CAT(__LINE__, n))(BOOST_PP_STRINGIZE(n), n);
+
+#endif // HOOLIBET_BENCH_BENCH_H
@@ -0,0 +1,141 @@
+// Copyright (c) 2015 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "crypto/sha256.h"
+#include "key.h"
+#include "main.h"
+#include "random.h"
+#include "script/sigcache.h"
+#include "sporkdb.h"
+#include "txdb.h"
+#include "ui_interface.h"
+#include "util.h"
+#ifdef ENABLE_WALLET
+#include "db.h"
+#include "wallet.h"
+#endif
+
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+
+CClientUIInterface uiInterface;
+CWallet* pwalletMain;
+
+extern void noui_connect();
+
+void Shutdown(void* parg)
+{
+    exit(0);
+}
+
+void StartShutdown()
+{
+    exit(0);
+}
+
+bool ShutdownRequested()
+{
+    return false;
+}
+
+/** A regtest chain holding only the genesis block, kept in memory, for the benchmarks that need chain state */
+struct BenchingSetup {
+    CCoinsViewDB* pcoinsdbview;
+    boost::filesystem::path pathTemp;
+    ECCVerifyHandle globalVerifyHandle;
+
+    BenchingSetup()
+    {
+        SHA256AutoDetect();
+        ECC_Start();
+        SetupEnvironment();
+        InitSignatureCache();
+        fPrintToDebugLog = false; // don't want to write to debug.log file
+        SelectParams(CBaseChainParams::REGTEST);
+        noui_connect();
+#ifdef ENABLE_WALLET
+        bitdb.MakeMock();
+#endif
+        pathTemp = GetTempPath() / strprintf("bench_hoolibet_%lu_%i", (unsigned long)GetTime(), (int)(GetRand(100000)));
+        boost::filesystem::create_directories(pathTemp);
+        mapArgs["-datadir"] = pathTemp.string();
+        zerocoinDB = new CZerocoinDB(0, true);
+        pSporkDB = new CSporkDB(0, true);
+        pblocktree = new CBlockTreeDB(1 << 20, true);
+        pcoinsdbview = new CCoinsViewDB(1 << 23, true);
+        pcoinsflusher = new CCoinsViewFlusher(pcoinsdbview, pcoinsdbview, pblocktree);
+        pcoinsTip = new CCoinsViewCache(pcoinsflusher);
+        InitBlockIndex();
+#ifdef ENABLE_WALLET
+        bool fFirstRun;
+        pwalletMain = new CWallet("wallet.dat");
+        pwalletMain->LoadWallet(fFirstRun);
+        RegisterValidationInterface(pwalletMain);
+#endif
+    }
+
+    ~BenchingSetup()
+    {
+#ifdef ENABLE_WALLET
+        UnregisterValidationInterface(pwalletMain);
+        delete pwalletMain;
+        pwalletMain = NULL;
+#endif
+        delete pcoinsTip;
+        delete pcoinsflusher;
+        delete pcoinsdbview;
+        delete pblocktree;
+        delete pSporkDB;
+        delete zerocoinDB;
+#ifdef ENABLE_WALLET
+        bitdb.Flush(true);
+#endif
+        boost::filesystem::remove_all(pathTemp);
+        ECC_Stop();
+    }
+};
+
+int main(int argc, char** argv)
+{
+    ParseParameters(argc, argv);
+
+    if (mapArgs.count("-?") || mapArgs.count("-help")) {
+        std::cout << "Usage: bench_hoolibet [options]\n\n"
+                  << "Options:\n"
+                  << "  -filter=<regex>     Run only the benchmarks whose name matches (default: .*)\n"
+                  << "  -list               List the benchmarks and exit\n"
+                  << "  -warmup=<n>         Untimed iterations before measuring (default: 1)\n"
+                  << "  -iterations=<n>     Timed iterations; 0 to run each benchmark for -time instead (default: 0)\n"
+                  << "  -time=<ms>          Milliseconds to measure each benchmark for (default: 1000)\n"
+                  << "  -format=<fmt>       Print the results as csv or json (default: csv)\n";
+        return 0;
+    }
+    if (mapArgs.count("-list")) {
+        benchmark::BenchRunner::ListAll();
+        return 0;
+    }
+
+    benchmark::Options options;
+    options.strFilter = GetArg("-filter", options.strFilter);
+    options.nWarmup = std::max<int64_t>(0, GetArg("-warmup", options.nWarmup));
+    options.nIterations = std::max<int64_t>(0, GetArg("-iterations", options.nIterations));
+    options.dMaxElapsed = std::max<int64_t>(1, GetArg("-time", 1000)) / 1000.0;
+    options.strFormat = GetArg("-format", options.strFormat);
+    if (options.strFormat != "csv" && options.strFormat != "json") {
+        std::cerr << "Unknown -format: " << options.strFormat << std::endl;
+        return 1;
+    }
+
+    std::vector<benchmark::Result> vResults;
+    {
+        BenchingSetup setup;
+        vResults = benchmark::BenchRunner::RunAll(options);
+    }
+    benchmark::BenchRunner::Print(vResults, options);
+    return 0;
+}
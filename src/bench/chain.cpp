@@ -0,0 +1,74 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "chain.h"
+
+#include "main.h"
+#include "masternode-payments.h"
+#include "miner.h"
+#include "pow.h"
+#include "random.h"
+#include "txmempool.h"
+#include "util.h"
+
+#include <boost/scoped_ptr.hpp>
+
+std::vector<CTransaction> CreateBenchTransactions(unsigned int nTx)
+{
+    LOCK(cs_main);
+    std::vector<CTransaction> vtx;
+    for (unsigned int i = 0; i < nTx; i++) {
+        uint256 hashPrev = GetRandHash();
+        {
+            CCoinsModifier coins = pcoinsTip->ModifyCoins(hashPrev);
+            coins->fCoinBase = false;
+            coins->fCoinStake = false;
+            coins->nVersion = 1;
+            coins->nHeight = chainActive.Height();
+            coins->vout.resize(1);
+            coins->vout[0].nValue = 10 * COIN;
+            coins->vout[0].scriptPubKey = CScript() << OP_TRUE;
+        }
+
+        CMutableTransaction tx;
+        tx.vin.resize(1);
+        tx.vin[0].prevout = COutPoint(hashPrev, 0);
+        tx.vout.resize(1);
+        tx.vout[0].nValue = 10 * COIN - 10000;
+        tx.vout[0].scriptPubKey = CScript() << OP_TRUE;
+        vtx.push_back(CTransaction(tx));
+    }
+    return vtx;
+}
+
+void FillBenchMempool(const std::vector<CTransaction>& vtx)
+{
+    LOCK(cs_main);
+    for (std::vector<CTransaction>::const_iterator it = vtx.begin(); it != vtx.end(); ++it)
+        mempool.addUnchecked(it->GetHash(), CTxMemPoolEntry(*it, 10000, GetTime(), 1.0, chainActive.Height()));
+}
+
+void VoteBenchPayee()
+{
+    LOCK2(cs_main, cs_mapMasternodeBlocks);
+    int nHeight = chainActive.Height() + 1;
+    if (!masternodePayments.mapMasternodeBlocks.count(nHeight)) {
+        masternodePayments.mapMasternodeBlocks[nHeight] = CMasternodeBlockPayees(nHeight);
+        masternodePayments.mapMasternodeBlocks[nHeight].AddPayee(CScript() << OP_TRUE, 1);
+    }
+}
+
+CBlock CreateBenchBlock()
+{
+    VoteBenchPayee();
+    LOCK(cs_main);
+    boost::scoped_ptr<CBlockTemplate> pblocktemplate(CreateNewBlock(CScript() << OP_TRUE, NULL, false));
+    if (!pblocktemplate)
+        throw std::runtime_error("CreateBenchBlock() : CreateNewBlock failed");
+    CBlock block = pblocktemplate->block;
+    block.hashMerkleRoot = block.BuildMerkleTree();
+    while (!CheckProofOfWork(block.GetHash(), block.nBits))
+        block.nNonce++;
+    return block;
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef HOOLIBET_BENCH_CHAIN_H
+#define HOOLIBET_BENCH_CHAIN_H
+
+#include "primitives/block.h"
+
+#include <vector>
+
+/**
+ * Helpers for the benchmarks that need chain state. They work on the in-memory regtest
+ * chain bench_hoolibet sets up, holding only the genesis block.
+ */
+
+/**
+ * Transactions that each spend an OP_TRUE output of their own and pay it on, minus a
+ * fee, to a new OP_TRUE output. The outputs they spend are added to pcoinsTip.
+ */
+std::vector<CTransaction> CreateBenchTransactions(unsigned int nTx);
+
+/** Add the transactions to the mempool as they are, skipping the acceptance checks */
+void FillBenchMempool(const std::vector<CTransaction>& vtx);
+
+/**
+ * Without a masternode to pay, CreateNewBlock leaves the value of a proof-of-work
+ * coinbase unset; vote a payee in for the next block so templates come out valid.
+ */
+void VoteBenchPayee();
+
+/** A block template on the chain tip from the mempool contents, with its proof of work solved */
+CBlock CreateBenchBlock();
+
+#endif // HOOLIBET_BENCH_CHAIN_H
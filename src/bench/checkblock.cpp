@@ -0,0 +1,79 @@
+// Copyright (c) 2016 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "chain.h"
+
+#include "main.h"
+#include "streams.h"
+#include "txmempool.h"
+#include "version.h"
+
+/** A block of 1000 transactions on the regtest genesis block */
+static CBlock BenchBlock()
+{
+    FillBenchMempool(CreateBenchTransactions(1000));
+    CBlock block = CreateBenchBlock();
+    mempool.clear();
+    return block;
+}
+
+static void DeserializeBlock(benchmark::State& state)
+{
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    stream << BenchBlock();
+    while (state.KeepRunning()) {
+        CDataStream ss(stream);
+        CBlock block;
+        ss >> block;
+    }
+}
+
+static void SerializeBlock(benchmark::State& state)
+{
+    CBlock block = BenchBlock();
+    while (state.KeepRunning()) {
+        CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+        stream << block;
+    }
+}
+
+static void SerializeTransaction(benchmark::State& state)
+{
+    CTransaction tx = CreateBenchTransactions(1)[0];
+    CDataStream stream(SER_NETWORK, PROTOCOL_VERSION);
+    while (state.KeepRunning()) {
+        stream.clear();
+        stream << tx;
+        CTransaction txOut;
+        stream >> txOut;
+    }
+}
+
+static void CheckBlock_1000Tx(benchmark::State& state)
+{
+    CBlock block = BenchBlock();
+    while (state.KeepRunning()) {
+        CValidationState validationState;
+        assert(CheckBlock(block, validationState, true, true, false));
+    }
+}
+
+/** ConnectBlock without writing anything, through the checks getblocktemplate and submitblock run */
+static void ConnectBlock_1000Tx(benchmark::State& state)
+{
+    CBlock block = BenchBlock();
+    while (state.KeepRunning()) {
+        LOCK(cs_main);
+        CValidationState validationState;
+        assert(TestBlockValidity(validationState, block, chainActive.Tip(), true, true));
+    }
+}
+
+BENCHMARK(DeserializeBlock);
+BENCHMARK(SerializeBlock);
+BENCHMARK(SerializeTransaction);
+BENCHMARK(CheckBlock_1000Tx);
+BENCHMARK(ConnectBlock_1000Tx);
@@ -0,0 +1,106 @@
+// Copyright (c) 2016 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "coins.h"
+#include "key.h"
+#include "keystore.h"
+#include "main.h"
+#include "random.h"
+#include "script/sign.h"
+#include "script/standard.h"
+
+/** Pay-to-pubkey-hash outputs, each in a coin of its own, all spent by one transaction signed with the keys */
+struct CoinsSetup {
+    CBasicKeyStore keystore;
+    std::vector<uint256> vTxid;
+    CMutableTransaction spend;
+
+    CoinsSetup(CCoinsViewCache& coins, unsigned int nInputs)
+    {
+        spend.vout.resize(1);
+        spend.vout[0].scriptPubKey = CScript() << OP_TRUE;
+        spend.vout[0].nValue = nInputs * COIN;
+        for (unsigned int i = 0; i < nInputs; i++) {
+            CKey key;
+            key.MakeNewKey(true);
+            keystore.AddKey(key);
+            CScript script = GetScriptForDestination(key.GetPubKey().GetID());
+
+            uint256 txid = GetRandHash();
+            CCoinsModifier modifier = coins.ModifyCoins(txid);
+            modifier->nVersion = 1;
+            modifier->nHeight = 0;
+            modifier->vout.resize(1);
+            modifier->vout[0].nValue = 2 * COIN;
+            modifier->vout[0].scriptPubKey = script;
+            vTxid.push_back(txid);
+            spend.vin.push_back(CTxIn(COutPoint(txid, 0)));
+        }
+        for (unsigned int i = 0; i < nInputs; i++)
+            SignSignature(keystore, coins.AccessCoins(vTxid[i])->vout[0].scriptPubKey, spend, i);
+    }
+};
+
+// Microbenchmark for simple accesses to a CCoinsViewCache database. Note from
+// laanwj, "replicating the actual usage patterns of the client is hard though,
+// many times micro-benchmarks of the database showed completely different
+// characteristics than e.g. reindex timings. But that's not a requirement of
+// every benchmark."
+static void CCoinsCaching(benchmark::State& state)
+{
+    CCoinsView coinsDummy;
+    CCoinsViewCache coins(&coinsDummy);
+    CoinsSetup setup(coins, 4);
+    CTransaction tx(setup.spend);
+
+    while (state.KeepRunning()) {
+        bool fHave = coins.HaveInputs(tx);
+        CAmount nValue = coins.GetValueIn(tx);
+        assert(fHave && nValue == 8 * COIN);
+    }
+}
+
+/** Fresh coins written through a cache layer and flushed to the one below, as connecting a block does */
+static void CCoinsCaching_ModifyFlush(benchmark::State& state)
+{
+    CCoinsView coinsDummy;
+    CCoinsViewCache base(&coinsDummy);
+    std::vector<uint256> vTxid;
+    for (int i = 0; i < 100; i++)
+        vTxid.push_back(GetRandHash());
+
+    while (state.KeepRunning()) {
+        CCoinsViewCache cache(&base);
+        for (std::vector<uint256>::const_iterator it = vTxid.begin(); it != vTxid.end(); ++it) {
+            CCoinsModifier modifier = cache.ModifyCoins(*it);
+            modifier->nVersion = 1;
+            modifier->vout.resize(2);
+            modifier->vout[0].nValue = COIN;
+            modifier->vout[0].scriptPubKey = CScript() << OP_TRUE;
+            modifier->vout[1].SetNull();
+        }
+        cache.Flush();
+    }
+}
+
+/** The input checks of a two-input transaction, signatures included and the signature cache left out */
+static void CheckInputs_P2PKH(benchmark::State& state)
+{
+    LOCK(cs_main);
+    CCoinsViewCache coins(pcoinsTip);
+    CoinsSetup setup(coins, 2);
+    CTransaction tx(setup.spend);
+
+    while (state.KeepRunning()) {
+        CValidationState validationState;
+        assert(CheckInputs(tx, validationState, coins, true, STANDARD_SCRIPT_VERIFY_FLAGS, false));
+    }
+}
+
+BENCHMARK(CCoinsCaching);
+BENCHMARK(CCoinsCaching_ModifyFlush);
+BENCHMARK(CheckInputs_P2PKH);
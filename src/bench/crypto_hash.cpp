@@ -0,0 +1,82 @@
+// Copyright (c) 2016 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "crypto/sha256.h"
+#include "hash.h"
+#include "pow.h"
+#include "primitives/block.h"
+#include "random.h"
+#include "utilstrencodings.h"
+
+#include <vector>
+
+/* Number of bytes to hash per iteration */
+static const uint64_t BUFFER_SIZE = 1000 * 1000;
+
+static void SHA256_1MB(benchmark::State& state)
+{
+    uint8_t hash[CSHA256::OUTPUT_SIZE];
+    std::vector<uint8_t> in(BUFFER_SIZE, 0);
+    while (state.KeepRunning())
+        CSHA256().Write(begin_ptr(in), in.size()).Finalize(hash);
+}
+
+static void SHA256D64_1024(benchmark::State& state)
+{
+    std::vector<uint8_t> in(64 * 1024, 0);
+    while (state.KeepRunning())
+        SHA256D64(begin_ptr(in), begin_ptr(in), 1024);
+}
+
+static CBlockHeader BenchHeader(int nVersion)
+{
+    CBlockHeader header;
+    header.nVersion = nVersion;
+    header.hashPrevBlock = GetRandHash();
+    header.hashMerkleRoot = GetRandHash();
+    header.nTime = 1561366802;
+    header.nBits = 0x1e0ffff0;
+    header.nAccumulatorCheckpoint = GetRandHash();
+    return header;
+}
+
+/** Double-SHA256 of a version 4 block header */
+static void SHA256D_Header(benchmark::State& state)
+{
+    CBlockHeader header = BenchHeader(4);
+    uint256 hash;
+    while (state.KeepRunning())
+        hash = Hash(BEGIN(header.nVersion), END(header.nAccumulatorCheckpoint));
+}
+
+/** Quark hash of a proof-of-work era block header, as a miner or a reindex computes it */
+static void HashQuark_Header(benchmark::State& state)
+{
+    CBlockHeader header = BenchHeader(3);
+    uint256 hash;
+    while (state.KeepRunning()) {
+        header.nNonce++;
+        hash = HashQuark(BEGIN(header.nVersion), END(header.nNonce));
+    }
+}
+
+/** Quark hashes of 1000 headers spread over all cores, as loading the block index checks them */
+static void HashQuark_HeaderBatch_1000(benchmark::State& state)
+{
+    std::vector<CBlockHeader> vHeaders;
+    for (int i = 0; i < 1000; i++)
+        vHeaders.push_back(BenchHeader(3));
+    std::vector<uint256> vHashes;
+    while (state.KeepRunning())
+        GetBlockHeaderHashes(vHeaders, vHashes);
+}
+
+BENCHMARK(SHA256_1MB);
+BENCHMARK(SHA256D64_1024);
+BENCHMARK(SHA256D_Header);
+BENCHMARK(HashQuark_Header);
+BENCHMARK(HashQuark_HeaderBatch_1000);
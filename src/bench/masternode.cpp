@@ -0,0 +1,41 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "chain.h"
+
+#include "main.h"
+#include "masternode.h"
+#include "masternodeman.h"
+#include "random.h"
+#include "util.h"
+
+/** The rank of one masternode among 1000, as the payment and winner votes ask for it */
+static void GetMasternodeRank_1000(benchmark::State& state)
+{
+    // Masternode scores are taken from the hash of the block before, which must be past the genesis block
+    while (chainActive.Height() < 2) {
+        CBlock block = CreateBenchBlock();
+        CValidationState validationState;
+        if (!ProcessNewBlock(validationState, NULL, &block))
+            throw std::runtime_error("GetMasternodeRank_1000 : ProcessNewBlock failed");
+    }
+
+    // Announced a day ago, well past the minimum age ranking wants
+    CTxIn vin;
+    for (int i = 0; i < 1000; i++) {
+        CMasternode mn;
+        mn.vin = CTxIn(COutPoint(GetRandHash(), 0));
+        mn.sigTime = GetAdjustedTime() - 24 * 60 * 60;
+        mnodeman.Add(mn);
+        vin = mn.vin;
+    }
+
+    int nHeight = chainActive.Height();
+    while (state.KeepRunning())
+        assert(mnodeman.GetMasternodeRank(vin, nHeight, 0, false) > 0);
+    mnodeman.Clear();
+}
+
+BENCHMARK(GetMasternodeRank_1000);
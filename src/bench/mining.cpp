@@ -0,0 +1,29 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+#include "chain.h"
+
+#include "main.h"
+#include "miner.h"
+#include "txmempool.h"
+
+#include <boost/scoped_ptr.hpp>
+
+/** getblocktemplate's work: a block template from a mempool of 2000 transactions */
+static void CreateNewBlock_FullMempool(benchmark::State& state)
+{
+    std::vector<CTransaction> vtx = CreateBenchTransactions(2000);
+    FillBenchMempool(vtx);
+    VoteBenchPayee();
+
+    while (state.KeepRunning()) {
+        LOCK(cs_main);
+        boost::scoped_ptr<CBlockTemplate> pblocktemplate(CreateNewBlock(CScript() << OP_TRUE, NULL, false));
+        assert(pblocktemplate && pblocktemplate->block.vtx.size() == vtx.size() + 1);
+    }
+    mempool.clear();
+}
+
+BENCHMARK(CreateNewBlock_FullMempool);
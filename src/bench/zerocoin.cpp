@@ -0,0 +1,101 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "chainparams.h"
+#include "libzerocoin/Accumulator.h"
+#include "libzerocoin/Coin.h"
+#include "libzerocoin/CoinSpend.h"
+#include "libzerocoin/Denominations.h"
+#include "primitives/block.h"
+#include "script/script.h"
+#include "zhbetchain.h"
+
+#include <list>
+
+using namespace libzerocoin;
+
+/** Blocks in the synthetic chain the witness is computed over, and mints in each */
+static const int WITNESS_BLOCKS = 10;
+static const int WITNESS_MINTS_PER_BLOCK = 4;
+
+/** Minting searches for primes, so the coins are made once and shared by the benchmarks */
+static const std::vector<PrivateCoin>& BenchCoins()
+{
+    static std::vector<PrivateCoin> vCoins;
+    if (vCoins.empty()) {
+        for (int i = 0; i < WITNESS_BLOCKS * WITNESS_MINTS_PER_BLOCK; i++)
+            vCoins.push_back(PrivateCoin(Params().Zerocoin_Params(false), CoinDenomination::ZQ_ONE));
+    }
+    return vCoins;
+}
+
+static void Accumulator_Increment(benchmark::State& state)
+{
+    ZerocoinParams* params = Params().Zerocoin_Params(false);
+    const std::vector<PrivateCoin>& vCoins = BenchCoins();
+    Accumulator accumulator(&params->accumulatorParams, CoinDenomination::ZQ_ONE);
+    size_t i = 0;
+    while (state.KeepRunning())
+        accumulator.increment(vCoins[i++ % vCoins.size()].getPublicCoin().getValue());
+}
+
+/**
+ * The walk of GenerateAccumulatorWitness over the blocks after a mint: the mints of
+ * each block are parsed back into public coins and added to the witness. The blocks
+ * are kept in memory, so reading them from disk is not part of the measurement.
+ */
+static void GenerateAccumulatorWitness_SyntheticChain(benchmark::State& state)
+{
+    ZerocoinParams* params = Params().Zerocoin_Params(false);
+    const std::vector<PrivateCoin>& vCoins = BenchCoins();
+
+    std::vector<CBlock> vBlocks(WITNESS_BLOCKS);
+    for (int i = 0; i < WITNESS_BLOCKS * WITNESS_MINTS_PER_BLOCK; i++) {
+        std::vector<unsigned char> vchValue = vCoins[i].getPublicCoin().getValue().getvch();
+        CMutableTransaction tx;
+        tx.vout.resize(1);
+        tx.vout[0].nValue = ZerocoinDenominationToAmount(CoinDenomination::ZQ_ONE);
+        tx.vout[0].scriptPubKey = CScript() << OP_ZEROCOINMINT << vchValue.size() << vchValue;
+        vBlocks[i / WITNESS_MINTS_PER_BLOCK].vtx.push_back(CTransaction(tx));
+    }
+
+    const PublicCoin& coin = vCoins[0].getPublicCoin();
+    Accumulator checkpoint(&params->accumulatorParams, CoinDenomination::ZQ_ONE);
+    while (state.KeepRunning()) {
+        Accumulator witnessAccumulator = checkpoint;
+        for (std::vector<CBlock>::const_iterator it = vBlocks.begin(); it != vBlocks.end(); ++it) {
+            std::list<PublicCoin> listPubcoins;
+            BlockToPubcoinList(*it, listPubcoins, false);
+            for (const PublicCoin& pubcoin : listPubcoins) {
+                if (pubcoin.getValue() != coin.getValue())
+                    witnessAccumulator.increment(pubcoin.getValue());
+            }
+        }
+        AccumulatorWitness witness(params, checkpoint, coin);
+        witness.resetValue(witnessAccumulator, coin);
+    }
+}
+
+static void CoinSpend_Verify(benchmark::State& state)
+{
+    ZerocoinParams* params = Params().Zerocoin_Params(false);
+    const std::vector<PrivateCoin>& vCoins = BenchCoins();
+
+    Accumulator accumulator(&params->accumulatorParams, CoinDenomination::ZQ_ONE);
+    AccumulatorWitness witness(params, accumulator, vCoins[0].getPublicCoin());
+    for (size_t i = 0; i < vCoins.size(); i++) {
+        accumulator += vCoins[i].getPublicCoin();
+        witness += vCoins[i].getPublicCoin();
+    }
+    CoinSpend spend(params, params, vCoins[0], accumulator, 0, witness, 0, SpendType::SPEND);
+
+    while (state.KeepRunning())
+        spend.Verify(accumulator);
+}
+
+BENCHMARK(Accumulator_Increment);
+BENCHMARK(GenerateAccumulatorWitness_SyntheticChain);
+BENCHMARK(CoinSpend_Verify);
@@ -0,0 +1,210 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockcache.h"
+
+#include "clientversion.h"
+#include "main.h"
+#include "streams.h"
+#include "util.h"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+CBlockFileCache blockFileCache;
+
+CBlockFileCache::CBlockFileCache() : nCacheBytes(0), nMaxCacheBytes(DEFAULT_BLOCK_CACHE_SIZE << 20), nHits(0), nMisses(0), nBytesRead(0), nMappedReads(0)
+{
+}
+
+CBlockFileCache::~CBlockFileCache()
+{
+    Clear();
+}
+
+void CBlockFileCache::SetMaxSize(size_t nMaxBytes)
+{
+    LOCK(cs);
+    nMaxCacheBytes = nMaxBytes;
+    EvictToSize(nMaxCacheBytes);
+}
+
+void CBlockFileCache::EvictToSize(size_t nTargetBytes)
+{
+    AssertLockHeld(cs);
+    while (nCacheBytes > nTargetBytes && !lruBlocks.empty()) {
+        const CCachedBlock& entry = lruBlocks.back();
+        nCacheBytes -= entry.nSize;
+        mapBlocks.erase(entry.pos);
+        lruBlocks.pop_back();
+    }
+}
+
+bool CBlockFileCache::Lookup(const CDiskBlockPos& pos, CBlock& block)
+{
+    LOCK(cs);
+    if (nMaxCacheBytes == 0)
+        return false;
+    std::map<CDiskBlockPos, BlockList::iterator, PosCompare>::iterator it = mapBlocks.find(pos);
+    if (it == mapBlocks.end()) {
+        nMisses++;
+        return false;
+    }
+    // Move to the front of the LRU list
+    lruBlocks.splice(lruBlocks.begin(), lruBlocks, it->second);
+    block = it->second->block;
+    nHits++;
+    return true;
+}
+
+void CBlockFileCache::Insert(const CDiskBlockPos& pos, const CBlock& block, size_t nSize)
+{
+    LOCK(cs);
+    if (nSize > nMaxCacheBytes / 4 || mapBlocks.count(pos))
+        return;
+
+    EvictToSize(nMaxCacheBytes - nSize);
+    CCachedBlock entry;
+    entry.pos = pos;
+    entry.block = block;
+    entry.nSize = nSize;
+    lruBlocks.push_front(entry);
+    mapBlocks[pos] = lruBlocks.begin();
+    nCacheBytes += nSize;
+}
+
+CBlockFileCache::CMappedFile::~CMappedFile()
+{
+#ifndef WIN32
+    munmap((void*)pdata, nSize);
+#endif
+}
+
+CBlockFileCache::MappedFilePtr CBlockFileCache::MapFile(int nFile)
+{
+    AssertLockHeld(cs);
+    std::map<int, MappedFilePtr>::const_iterator it = mapMappedFiles.find(nFile);
+    if (it != mapMappedFiles.end())
+        return it->second;
+
+#if defined(WIN32)
+    return MappedFilePtr();
+#else
+    // Mapping every block file needs a large address space
+    if (sizeof(void*) < 8)
+        return MappedFilePtr();
+
+    boost::filesystem::path path = GetBlockPosFilename(CDiskBlockPos(nFile, 0), "blk");
+    int fd = open(path.string().c_str(), O_RDONLY);
+    if (fd == -1)
+        return MappedFilePtr();
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return MappedFilePtr();
+    }
+
+    void* p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        LogPrintf("%s : unable to map %s\n", __func__, path.string());
+        return MappedFilePtr();
+    }
+
+    MappedFilePtr mapped(new CMappedFile((const char*)p, st.st_size));
+    mapMappedFiles[nFile] = mapped;
+    LogPrint("blockcache", "%s : mapped %s (%u bytes)\n", __func__, path.string(), mapped->nSize);
+    return mapped;
+#endif
+}
+
+bool CBlockFileCache::ReadFromMappedFile(const CDiskBlockPos& pos, CBlock& block)
+{
+    MappedFilePtr mapped;
+    {
+        LOCK(cs);
+        mapped = MapFile(pos.nFile);
+    }
+    if (!mapped)
+        return false;
+
+    // Every block is preceded by the network magic and its serialized size
+    if (pos.nPos < 8 || pos.nPos > mapped->nSize)
+        throw std::ios_base::failure("CBlockFileCache::ReadFromMappedFile : position out of range");
+    unsigned int nBlockSize;
+    CMemoryReader(mapped->pdata + pos.nPos - 4, mapped->pdata + pos.nPos, SER_DISK, CLIENT_VERSION) >> nBlockSize;
+    if (nBlockSize > mapped->nSize - pos.nPos)
+        throw std::ios_base::failure("CBlockFileCache::ReadFromMappedFile : block size out of range");
+
+    CMemoryReader reader(mapped->pdata + pos.nPos, mapped->pdata + pos.nPos + nBlockSize, SER_DISK, CLIENT_VERSION);
+    reader >> block;
+
+    LOCK(cs);
+    nMappedReads++;
+    nBytesRead += reader.GetPos();
+    return true;
+}
+
+bool CBlockFileCache::ReadTxFromMappedFile(const CDiskBlockPos& pos, unsigned int nTxOffset, CBlockHeader& header, CTransaction& tx)
+{
+    MappedFilePtr mapped;
+    {
+        LOCK(cs);
+        mapped = MapFile(pos.nFile);
+    }
+    if (!mapped)
+        return false;
+
+    if (pos.nPos > mapped->nSize)
+        throw std::ios_base::failure("CBlockFileCache::ReadTxFromMappedFile : position out of range");
+
+    CMemoryReader reader(mapped->pdata + pos.nPos, mapped->pdata + mapped->nSize, SER_DISK, CLIENT_VERSION);
+    reader >> header;
+    reader.ignore(nTxOffset);
+    size_t nTxStart = reader.GetPos();
+    reader >> tx;
+
+    LOCK(cs);
+    nMappedReads++;
+    nBytesRead += reader.GetPos() - nTxStart + ::GetSerializeSize(header, SER_DISK, CLIENT_VERSION);
+    return true;
+}
+
+void CBlockFileCache::AddBytesRead(size_t nBytes)
+{
+    LOCK(cs);
+    nBytesRead += nBytes;
+}
+
+void CBlockFileCache::Clear()
+{
+    LOCK(cs);
+    lruBlocks.clear();
+    mapBlocks.clear();
+    nCacheBytes = 0;
+    // Files still being read from are unmapped once their readers finish
+    mapMappedFiles.clear();
+}
+
+CBlockCacheStats CBlockFileCache::GetStats() const
+{
+    LOCK(cs);
+    CBlockCacheStats stats;
+    stats.nHits = nHits;
+    stats.nMisses = nMisses;
+    stats.nBytesRead = nBytesRead;
+    stats.nMappedReads = nMappedReads;
+    stats.nEntries = mapBlocks.size();
+    stats.nCacheBytes = nCacheBytes;
+    stats.nMaxCacheBytes = nMaxCacheBytes;
+    stats.nMappedFiles = mapMappedFiles.size();
+    for (std::map<int, MappedFilePtr>::const_iterator it = mapMappedFiles.begin(); it != mapMappedFiles.end(); ++it)
+        stats.nMappedBytes += it->second->nSize;
+    return stats;
+}
@@ -0,0 +1,132 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef HOOLIBET_BLOCKCACHE_H
+#define HOOLIBET_BLOCKCACHE_H
+
+#include "chain.h"
+#include "primitives/block.h"
+#include "sync.h"
+
+#include <list>
+#include <map>
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+/** Default for -blockcachesize, the memory budget (in MiB) of recently read blocks */
+static const unsigned int DEFAULT_BLOCK_CACHE_SIZE = 32;
+
+struct CBlockCacheStats {
+    uint64_t nHits;
+    uint64_t nMisses;
+    uint64_t nBytesRead;
+    uint64_t nMappedReads;
+    size_t nEntries;
+    size_t nCacheBytes;
+    size_t nMaxCacheBytes;
+    size_t nMappedFiles;
+    size_t nMappedBytes;
+
+    CBlockCacheStats() : nHits(0), nMisses(0), nBytesRead(0), nMappedReads(0), nEntries(0), nCacheBytes(0), nMaxCacheBytes(0), nMappedFiles(0), nMappedBytes(0) {}
+};
+
+/**
+ * Read-side accelerator for blk?????.dat files.
+ *
+ * Block files that will not be appended to anymore are memory-mapped read-only
+ * on first access, so reads deserialize straight from the page cache instead of
+ * doing an fopen/fseek/fread round trip. On top of that, recently deserialized
+ * blocks are kept in an LRU cache keyed by their CDiskBlockPos and bounded by
+ * their serialized size. A block never moves once written, so entries need no
+ * invalidation while the node runs.
+ */
+class CBlockFileCache
+{
+private:
+    /** A read-only mapping of a whole file, unmapped when the last reader lets go of it */
+    class CMappedFile
+    {
+    public:
+        const char* const pdata;
+        const size_t nSize;
+
+        CMappedFile(const char* pdataIn, size_t nSizeIn) : pdata(pdataIn), nSize(nSizeIn) {}
+        ~CMappedFile();
+
+    private:
+        CMappedFile(const CMappedFile&);
+        CMappedFile& operator=(const CMappedFile&);
+    };
+    typedef boost::shared_ptr<const CMappedFile> MappedFilePtr;
+
+    struct CCachedBlock {
+        CDiskBlockPos pos;
+        CBlock block;
+        size_t nSize;
+    };
+
+    typedef std::list<CCachedBlock> BlockList;
+
+    struct PosCompare {
+        bool operator()(const CDiskBlockPos& a, const CDiskBlockPos& b) const
+        {
+            return a.nFile < b.nFile || (a.nFile == b.nFile && a.nPos < b.nPos);
+        }
+    };
+
+    mutable CCriticalSection cs;
+    BlockList lruBlocks;
+    std::map<CDiskBlockPos, BlockList::iterator, PosCompare> mapBlocks;
+    //! Readers hold a reference while they deserialize, so Clear() cannot unmap a file under them
+    std::map<int, MappedFilePtr> mapMappedFiles;
+    size_t nCacheBytes;
+    size_t nMaxCacheBytes;
+
+    uint64_t nHits;
+    uint64_t nMisses;
+    uint64_t nBytesRead;
+    uint64_t nMappedReads;
+
+    MappedFilePtr MapFile(int nFile);
+    void EvictToSize(size_t nTargetBytes);
+
+public:
+    CBlockFileCache();
+    ~CBlockFileCache();
+
+    /** Set the byte budget for deserialized blocks. 0 disables caching. */
+    void SetMaxSize(size_t nMaxBytes);
+
+    /** Copy a cached block into block. Counts a hit or a miss, unless caching is disabled. */
+    bool Lookup(const CDiskBlockPos& pos, CBlock& block);
+
+    /** Remember a block that was just read from pos. nSize is its serialized size. */
+    void Insert(const CDiskBlockPos& pos, const CBlock& block, size_t nSize);
+
+    /**
+     * Deserialize the block at pos from the memory mapping of its file,
+     * mapping the file first if needed. Only call this for finalized files.
+     * Returns false if the file cannot be mapped; throws on malformed data.
+     */
+    bool ReadFromMappedFile(const CDiskBlockPos& pos, CBlock& block);
+
+    /**
+     * Deserialize the header at pos followed by the transaction nTxOffset bytes
+     * after it, from the memory mapping of a finalized file.
+     */
+    bool ReadTxFromMappedFile(const CDiskBlockPos& pos, unsigned int nTxOffset, CBlockHeader& header, CTransaction& tx);
+
+    /** Account for bytes that were read through the regular file path. */
+    void AddBytesRead(size_t nBytes);
+
+    /** Drop all cached blocks and unmap every file. */
+    void Clear();
+
+    CBlockCacheStats GetStats() const;
+};
+
+extern CBlockFileCache blockFileCache;
+
+#endif // HOOLIBET_BLOCKCACHE_H
@@ -0,0 +1,392 @@
+// Copyright (c) 2018 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockfilter.h"
+
+#include "hash.h"
+#include "main.h"
+#include "primitives/zerocoin.h"
+#include "script/script.h"
+#include "streams.h"
+#include "txdb.h"
+#include "util.h"
+#include "zhbetchain.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/thread.hpp>
+
+CBlockFilterDB* pblockfilterdb = NULL;
+
+/** Last block of the active chain whose filter, and all before it, are indexed */
+static const CBlockIndex* pindexFilterBest = NULL;
+/**
+ * Set once the background sync reached the tip; from then on ConnectTip/DisconnectTip keep the
+ * index current. Cleared again when one of those fails, to have the background sync catch up.
+ */
+static std::atomic<bool> fFilterIndexSynced(false);
+
+/** Writes bits most significant first */
+class CBitWriter
+{
+private:
+    std::vector<unsigned char>& vch;
+    uint8_t buffer;
+    int offset;
+
+public:
+    CBitWriter(std::vector<unsigned char>& vchIn) : vch(vchIn), buffer(0), offset(0) {}
+
+    /** Write the nbits least significant bits of data */
+    void Write(uint64_t data, int nbits)
+    {
+        while (nbits > 0) {
+            int bits = std::min(8 - offset, nbits);
+            buffer |= (data << (64 - nbits)) >> (64 - 8 + offset);
+            offset += bits;
+            nbits -= bits;
+            if (offset == 8)
+                Flush();
+        }
+    }
+
+    void Flush()
+    {
+        if (offset == 0)
+            return;
+        vch.push_back(buffer);
+        buffer = 0;
+        offset = 0;
+    }
+};
+
+class CBitReader
+{
+private:
+    const std::vector<unsigned char>& vch;
+    size_t nPos;
+    uint8_t buffer;
+    int offset;
+
+public:
+    CBitReader(const std::vector<unsigned char>& vchIn, size_t nPosIn) : vch(vchIn), nPos(nPosIn), buffer(0), offset(8) {}
+
+    size_t GetPos() const { return nPos; }
+
+    uint64_t Read(int nbits)
+    {
+        uint64_t data = 0;
+        while (nbits > 0) {
+            if (offset == 8) {
+                if (nPos >= vch.size())
+                    throw std::ios_base::failure("GCS filter: end of data");
+                buffer = vch[nPos++];
+                offset = 0;
+            }
+            int bits = std::min(8 - offset, nbits);
+            data <<= bits;
+            data |= static_cast<uint8_t>(buffer << offset) >> (8 - bits);
+            offset += bits;
+            nbits -= bits;
+        }
+        return data;
+    }
+};
+
+static void GolombRiceEncode(CBitWriter& writer, uint8_t P, uint64_t x)
+{
+    // The quotient in unary, then the remainder in P bits
+    uint64_t q = x >> P;
+    while (q > 0) {
+        int nbits = q <= 64 ? static_cast<int>(q) : 64;
+        writer.Write(~0ULL, nbits);
+        q -= nbits;
+    }
+    writer.Write(0, 1);
+    writer.Write(x, P);
+}
+
+static uint64_t GolombRiceDecode(CBitReader& reader, uint8_t P)
+{
+    uint64_t q = 0;
+    while (reader.Read(1) == 1)
+        q++;
+    uint64_t r = reader.Read(P);
+    return (q << P) + r;
+}
+
+/** Map x uniformly into [0, n) without a division: the high 64 bits of x * n */
+static uint64_t MapIntoRange(uint64_t x, uint64_t n)
+{
+#ifdef __SIZEOF_INT128__
+    return (static_cast<unsigned __int128>(x) * static_cast<unsigned __int128>(n)) >> 64;
+#else
+    uint64_t x_hi = x >> 32, x_lo = x & 0xFFFFFFFF;
+    uint64_t n_hi = n >> 32, n_lo = n & 0xFFFFFFFF;
+    uint64_t ac = x_hi * n_hi, ad = x_hi * n_lo, bc = x_lo * n_hi, bd = x_lo * n_lo;
+    uint64_t mid34 = (bd >> 32) + (bc & 0xFFFFFFFF) + (ad & 0xFFFFFFFF);
+    return ac + (bc >> 32) + (ad >> 32) + (mid34 >> 32);
+#endif
+}
+
+GCSFilter::GCSFilter(uint64_t k0In, uint64_t k1In) : k0(k0In), k1(k1In), N(0), F(0)
+{
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    WriteCompactSize(ss, N);
+    encoded.assign(ss.begin(), ss.end());
+}
+
+GCSFilter::GCSFilter(uint64_t k0In, uint64_t k1In, const ElementSet& elements) : k0(k0In), k1(k1In)
+{
+    if (elements.size() > std::numeric_limits<uint32_t>::max())
+        throw std::invalid_argument("GCSFilter: too many elements");
+    N = elements.size();
+    F = static_cast<uint64_t>(N) * M;
+
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    WriteCompactSize(ss, N);
+    encoded.assign(ss.begin(), ss.end());
+
+    CBitWriter writer(encoded);
+    uint64_t last = 0;
+    std::vector<uint64_t> vHashed = BuildHashedSet(elements);
+    for (size_t i = 0; i < vHashed.size(); i++) {
+        GolombRiceEncode(writer, P, vHashed[i] - last);
+        last = vHashed[i];
+    }
+    writer.Flush();
+}
+
+GCSFilter::GCSFilter(uint64_t k0In, uint64_t k1In, const std::vector<unsigned char>& encodedIn) : k0(k0In), k1(k1In), encoded(encodedIn)
+{
+    CDataStream ss(encoded, SER_NETWORK, PROTOCOL_VERSION);
+    uint64_t nElements = ReadCompactSize(ss);
+    if (nElements > std::numeric_limits<uint32_t>::max())
+        throw std::ios_base::failure("GCS filter: N too large");
+    N = nElements;
+    F = static_cast<uint64_t>(N) * M;
+
+    // Walk the codes once so a truncated or padded filter is caught here
+    CBitReader reader(encoded, encoded.size() - ss.size());
+    for (uint32_t i = 0; i < N; i++)
+        GolombRiceDecode(reader, P);
+    if (reader.GetPos() != encoded.size())
+        throw std::ios_base::failure("GCS filter: trailing data");
+}
+
+uint64_t GCSFilter::HashToRange(const Element& element) const
+{
+    uint64_t hash = CSipHasher(k0, k1).Write(element.data(), element.size()).Finalize();
+    return MapIntoRange(hash, F);
+}
+
+std::vector<uint64_t> GCSFilter::BuildHashedSet(const ElementSet& elements) const
+{
+    std::vector<uint64_t> vHashed;
+    vHashed.reserve(elements.size());
+    for (ElementSet::const_iterator it = elements.begin(); it != elements.end(); ++it)
+        vHashed.push_back(HashToRange(*it));
+    std::sort(vHashed.begin(), vHashed.end());
+    return vHashed;
+}
+
+bool GCSFilter::MatchInternal(const std::vector<uint64_t>& vQueries) const
+{
+    CDataStream ss(encoded, SER_NETWORK, PROTOCOL_VERSION);
+    ReadCompactSize(ss);
+    CBitReader reader(encoded, encoded.size() - ss.size());
+
+    // Both lists are sorted, so walk them side by side
+    uint64_t value = 0;
+    size_t nQuery = 0;
+    for (uint32_t i = 0; i < N; i++) {
+        value += GolombRiceDecode(reader, P);
+        while (true) {
+            if (nQuery == vQueries.size())
+                return false;
+            if (vQueries[nQuery] == value)
+                return true;
+            if (vQueries[nQuery] > value)
+                break;
+            nQuery++;
+        }
+    }
+    return false;
+}
+
+bool GCSFilter::Match(const Element& element) const
+{
+    if (N == 0)
+        return false;
+    return MatchInternal(std::vector<uint64_t>(1, HashToRange(element)));
+}
+
+bool GCSFilter::MatchAny(const ElementSet& elements) const
+{
+    if (N == 0 || elements.empty())
+        return false;
+    return MatchInternal(BuildHashedSet(elements));
+}
+
+GCSFilter::Element BlockFilterElement(const CScript& script)
+{
+    return GCSFilter::Element(script.begin(), script.end());
+}
+
+GCSFilter::Element BlockFilterElement(const COutPoint& outpoint)
+{
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    ss << outpoint;
+    return GCSFilter::Element(ss.begin(), ss.end());
+}
+
+GCSFilter::Element BlockFilterElement(const uint256& hash)
+{
+    return GCSFilter::Element(hash.begin(), hash.end());
+}
+
+CBlockFilter::CBlockFilter(const CBlock& block) : hashBlock(block.GetHash())
+{
+    GCSFilter::ElementSet elements;
+    BOOST_FOREACH (const CTransaction& tx, block.vtx) {
+        BOOST_FOREACH (const CTxOut& txout, tx.vout) {
+            const CScript& script = txout.scriptPubKey;
+            if (script.empty() || script[0] == OP_RETURN)
+                continue;
+            elements.insert(BlockFilterElement(script));
+
+            uint256 hashPubcoin;
+            if (TxOutToPubcoinHash(txout, hashPubcoin))
+                elements.insert(BlockFilterElement(hashPubcoin));
+        }
+
+        if (tx.IsCoinBase())
+            continue;
+        BOOST_FOREACH (const CTxIn& txin, tx.vin) {
+            if (txin.scriptSig.IsZerocoinSpend()) {
+                try {
+                    libzerocoin::CoinSpend spend = TxInToZerocoinSpend(txin);
+                    elements.insert(BlockFilterElement(GetSerialHash(spend.getCoinSerialNumber())));
+                } catch (const std::exception& e) {
+                    LogPrint("zero", "%s : unreadable zerocoin spend in %s: %s\n", __func__, tx.GetHash().GetHex(), e.what());
+                }
+                continue;
+            }
+            elements.insert(BlockFilterElement(txin.prevout));
+        }
+    }
+    filter = GCSFilter(hashBlock.Get64(0), hashBlock.Get64(1), elements);
+}
+
+bool BlockFilterIndexCovers(const CBlockIndex* pindex)
+{
+    AssertLockHeld(cs_main);
+    return pblockfilterdb && pindex && pindexFilterBest && pindexFilterBest->GetAncestor(pindex->nHeight) == pindex;
+}
+
+bool GetBlockFilter(const CBlockIndex* pindex, CBlockFilter& filter)
+{
+    return pblockfilterdb && pblockfilterdb->ReadFilter(pindex->GetBlockHash(), filter);
+}
+
+void BlockFilterIndexConnectTip(const CBlock& block, const CBlockIndex* pindex)
+{
+    AssertLockHeld(cs_main);
+    if (!pblockfilterdb || !fFilterIndexSynced || pindexFilterBest != pindex->pprev)
+        return;
+    if (!pblockfilterdb->WriteFilter(CBlockFilter(block), pindex->GetBlockHash())) {
+        // Hand back to the background sync, which retries from where the index is
+        LogPrintf("%s : failed to write filter for block %s\n", __func__, pindex->GetBlockHash().GetHex());
+        fFilterIndexSynced = false;
+        return;
+    }
+    pindexFilterBest = pindex;
+}
+
+void BlockFilterIndexDisconnectTip(const CBlockIndex* pindex)
+{
+    AssertLockHeld(cs_main);
+    // Filters are keyed by block hash, so the one of the disconnected block can stay
+    if (!pblockfilterdb || pindexFilterBest != pindex)
+        return;
+    if (pblockfilterdb->WriteBestBlock(pindex->pprev ? pindex->pprev->GetBlockHash() : uint256(0))) {
+        pindexFilterBest = pindex->pprev;
+    } else {
+        // The background sync rewinds past the disconnected block by itself
+        LogPrintf("%s : failed to rewind filter index from block %s\n", __func__, pindex->GetBlockHash().GetHex());
+        fFilterIndexSynced = false;
+    }
+}
+
+void LoadBlockFilterIndex()
+{
+    LOCK(cs_main);
+    uint256 hashBest;
+    if (pblockfilterdb->ReadBestBlock(hashBest) && mapBlockIndex.count(hashBest))
+        pindexFilterBest = mapBlockIndex[hashBest];
+    // Rewind past blocks that were reorganized away while the index was not kept current
+    if (pindexFilterBest && !chainActive.Contains(pindexFilterBest))
+        pindexFilterBest = chainActive.FindFork(pindexFilterBest);
+    LogPrintf("%s : filters indexed up to height %d\n", __func__, pindexFilterBest ? pindexFilterBest->nHeight : -1);
+}
+
+void ThreadBlockFilterIndex()
+{
+    // How long to wait before retrying after a failed block read or filter write
+    static const int64_t RETRY_INTERVAL = 60 * 1000;
+    int64_t nLastLog = GetTime();
+    while (true) {
+        boost::this_thread::interruption_point();
+
+        CBlockIndex* pindexNext;
+        {
+            LOCK(cs_main);
+            if (pindexFilterBest && !chainActive.Contains(pindexFilterBest))
+                pindexFilterBest = chainActive.FindFork(pindexFilterBest);
+            pindexNext = pindexFilterBest ? chainActive.Next(pindexFilterBest) : chainActive.Genesis();
+            if (!pindexNext && !fFilterIndexSynced) {
+                fFilterIndexSynced = true;
+                LogPrintf("%s : filter index is synced at height %d\n", __func__, pindexFilterBest ? pindexFilterBest->nHeight : -1);
+            }
+        }
+        if (!pindexNext) {
+            // The tip updates take over until one of them fails
+            while (fFilterIndexSynced)
+                MilliSleep(1000);
+            continue;
+        }
+
+        CBlock block;
+        if (!ReadBlockFromDisk(block, pindexNext)) {
+            LogPrintf("%s : failed to read block %s, retrying in a minute\n", __func__, pindexNext->GetBlockHash().GetHex());
+            MilliSleep(RETRY_INTERVAL);
+            continue;
+        }
+        CBlockFilter filter(block);
+
+        bool fWritten;
+        {
+            LOCK(cs_main);
+            if (pindexFilterBest != pindexNext->pprev)
+                continue;
+            fWritten = pblockfilterdb->WriteFilter(filter, pindexNext->GetBlockHash());
+            if (fWritten)
+                pindexFilterBest = pindexNext;
+        }
+        if (!fWritten) {
+            LogPrintf("%s : failed to write filter for block %s, retrying in a minute\n", __func__, pindexNext->GetBlockHash().GetHex());
+            MilliSleep(RETRY_INTERVAL);
+            continue;
+        }
+
+        if (GetTime() >= nLastLog + 60) {
+            nLastLog = GetTime();
+            LogPrintf("%s : indexed filters up to height %d\n", __func__, pindexNext->nHeight);
+        }
+    }
+}
@@ -0,0 +1,113 @@
+// Copyright (c) 2018 The Bitcoin Core developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef HOOLIBET_BLOCKFILTER_H
+#define HOOLIBET_BLOCKFILTER_H
+
+#include "serialize.h"
+#include "uint256.h"
+
+#include <set>
+#include <stdint.h>
+#include <vector>
+
+class CBlock;
+class CBlockFilterDB;
+class CBlockIndex;
+class COutPoint;
+class CScript;
+
+/** Default for -blockfilterindex */
+static const bool DEFAULT_BLOCKFILTERINDEX = false;
+
+/**
+ * A Golomb-coded set (BIP 158): a compact, probabilistic set of byte strings.
+ *
+ * Elements are hashed with SipHash into [0, N * M), sorted, and the gaps between
+ * them written as Golomb-Rice codes with a P-bit remainder. A query has a false
+ * positive rate of about 1/M and never a false negative. The encoding starts
+ * with N as a CompactSize.
+ */
+class GCSFilter
+{
+public:
+    typedef std::vector<unsigned char> Element;
+    typedef std::set<Element> ElementSet;
+
+    static const uint8_t P = 19;
+    static const uint32_t M = 784931;
+
+private:
+    uint64_t k0, k1;
+    uint32_t N;
+    uint64_t F;
+    std::vector<unsigned char> encoded;
+
+    uint64_t HashToRange(const Element& element) const;
+    std::vector<uint64_t> BuildHashedSet(const ElementSet& elements) const;
+    bool MatchInternal(const std::vector<uint64_t>& vQueries) const;
+
+public:
+    GCSFilter(uint64_t k0In = 0, uint64_t k1In = 0);
+    GCSFilter(uint64_t k0In, uint64_t k1In, const ElementSet& elements);
+    /** Throws std::ios_base::failure if the encoding is malformed */
+    GCSFilter(uint64_t k0In, uint64_t k1In, const std::vector<unsigned char>& encodedIn);
+
+    uint32_t GetN() const { return N; }
+    const std::vector<unsigned char>& GetEncoded() const { return encoded; }
+
+    bool Match(const Element& element) const;
+    bool MatchAny(const ElementSet& elements) const;
+};
+
+/**
+ * The filter of a block, keyed by its hash. It holds the output scripts, the
+ * outpoints spent, and the pubcoin and serial hashes of zerocoin mints and spends.
+ */
+class CBlockFilter
+{
+private:
+    uint256 hashBlock;
+    GCSFilter filter;
+
+public:
+    CBlockFilter() {}
+    CBlockFilter(const CBlock& block);
+
+    const uint256& GetBlockHash() const { return hashBlock; }
+    const GCSFilter& GetFilter() const { return filter; }
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(hashBlock);
+        std::vector<unsigned char> vchEncoded = filter.GetEncoded();
+        READWRITE(vchEncoded);
+        if (ser_action.ForRead())
+            filter = GCSFilter(hashBlock.Get64(0), hashBlock.Get64(1), vchEncoded);
+    }
+};
+
+/** The filter index (blocks/filter/), or NULL when -blockfilterindex is off */
+extern CBlockFilterDB* pblockfilterdb;
+
+GCSFilter::Element BlockFilterElement(const CScript& script);
+GCSFilter::Element BlockFilterElement(const COutPoint& outpoint);
+GCSFilter::Element BlockFilterElement(const uint256& hash);
+
+/** Whether the filters of pindex and all blocks before it on the active chain are indexed */
+bool BlockFilterIndexCovers(const CBlockIndex* pindex);
+bool GetBlockFilter(const CBlockIndex* pindex, CBlockFilter& filter);
+/** Keep the index current as the active chain moves; called with cs_main held */
+void BlockFilterIndexConnectTip(const CBlock& block, const CBlockIndex* pindex);
+void BlockFilterIndexDisconnectTip(const CBlockIndex* pindex);
+/** Find where the index left off; called once the block index is loaded */
+void LoadBlockFilterIndex();
+/** Index the active chain blocks that have no filter yet, then hand over to the tip updates and take over again if they fail */
+void ThreadBlockFilterIndex();
+
+#endif // HOOLIBET_BLOCKFILTER_H
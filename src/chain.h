@@ -98,6 +98,8 @@ enum BlockStatus {
     BLOCK_FAILED_VALID = 32, //! stage after last reached validness failed
     BLOCK_FAILED_CHILD = 64, //! descends from failed block
     BLOCK_FAILED_MASK = BLOCK_FAILED_VALID | BLOCK_FAILED_CHILD,
+
+    BLOCK_POW_CHECKED = 128, //! proof-of-work era header hash and PoW verified, skipped when loading the index
 };
 
 /** The block chain is a tree shaped structure starting with the
@@ -487,6 +489,10 @@ public:
 
     uint256 GetBlockHash() const
     {
+        // Copied from an index entry that already knows its hash
+        if (phashBlock)
+            return *phashBlock;
+
         CBlockHeader block;
         block.nVersion = nVersion;
         block.hashPrevBlock = hashPrev;
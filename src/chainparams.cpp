@@ -203,7 +203,7 @@ public:
         fMineBlocksOnDemand = false;
         fSkipProofOfWorkCheck = true;
         fTestnetToBeDeprecatedFieldRPC = false;
-        fHeadersFirstSyncingActive = false;
+        fHeadersFirstSyncingActive = true;
 
         nPoolMaxTransactions = 3;
         strSporkKey = "04c913d9b6979b180dc6634b20a62e1cd28167ecd7d64e46825bf8d3f2cf797125dfedec99135d8e95ac761616f95a6edef925bd738d4afd21a23c8d7fa0e720fd";
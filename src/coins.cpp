@@ -7,6 +7,7 @@
 
 #include "random.h"
 
+#include <algorithm>
 #include <assert.h>
 
 /**
@@ -76,7 +77,12 @@ bool CCoinsViewBacked::GetStats(CCoinsStats& stats) const { return base->GetStat
 
 CCoinsKeyHasher::CCoinsKeyHasher() : salt(GetRandHash()) {}
 
-CCoinsViewCache::CCoinsViewCache(CCoinsView* baseIn) : CCoinsViewBacked(baseIn), hasModifier(false), hashBlock(0) {}
+CCoinsViewCache::CCoinsViewCache(CCoinsView* baseIn) : CCoinsViewBacked(baseIn), hasModifier(false), hashBlock(0), cacheCoins(0, CCoinsKeyHasher(), std::equal_to<uint256>(), CCoinsMap::allocator_type(&cachePool)), cachedCoinsUsage(0) {}
+
+size_t CCoinsViewCache::DynamicMemoryUsage() const
+{
+    return cachePool.DynamicMemoryUsage() + cachedCoinsUsage;
+}
 
 CCoinsViewCache::~CCoinsViewCache()
 {
@@ -93,6 +99,7 @@ CCoinsMap::const_iterator CCoinsViewCache::FetchCoins(const uint256& txid) const
         return cacheCoins.end();
     CCoinsMap::iterator ret = cacheCoins.insert(std::make_pair(txid, CCoinsCacheEntry())).first;
     tmp.swap(ret->second.coins);
+    cachedCoinsUsage += ret->second.DynamicMemoryUsage();
     if (ret->second.coins.IsPruned()) {
         // The parent only has an empty entry for this txid; we can consider our
         // version as fresh.
@@ -115,6 +122,7 @@ CCoinsModifier CCoinsViewCache::ModifyCoins(const uint256& txid)
 {
     assert(!hasModifier);
     std::pair<CCoinsMap::iterator, bool> ret = cacheCoins.insert(std::make_pair(txid, CCoinsCacheEntry()));
+    size_t cachedCoinUsage = 0;
     if (ret.second) {
         if (!base->GetCoins(txid, ret.first->second.coins)) {
             // The parent view does not have this entry; mark it as fresh.
@@ -124,10 +132,12 @@ CCoinsModifier CCoinsViewCache::ModifyCoins(const uint256& txid)
             // The parent view only has a pruned entry for this; mark it as fresh.
             ret.first->second.flags = CCoinsCacheEntry::FRESH;
         }
+    } else {
+        cachedCoinUsage = ret.first->second.DynamicMemoryUsage();
     }
     // Assume that whenever ModifyCoins is called, the entry will be modified.
     ret.first->second.flags |= CCoinsCacheEntry::DIRTY;
-    return CCoinsModifier(*this, ret.first);
+    return CCoinsModifier(*this, ret.first, cachedCoinUsage);
 }
 
 const CCoins* CCoinsViewCache::AccessCoins(const uint256& txid) const
@@ -177,6 +187,7 @@ bool CCoinsViewCache::BatchWrite(CCoinsMap& mapCoins, const uint256& hashBlockIn
                     assert(it->second.flags & CCoinsCacheEntry::FRESH);
                     CCoinsCacheEntry& entry = cacheCoins[it->first];
                     entry.coins.swap(it->second.coins);
+                    cachedCoinsUsage += entry.DynamicMemoryUsage();
                     entry.flags = CCoinsCacheEntry::DIRTY | CCoinsCacheEntry::FRESH;
                 }
             } else {
@@ -184,10 +195,25 @@ bool CCoinsViewCache::BatchWrite(CCoinsMap& mapCoins, const uint256& hashBlockIn
                     // The grandparent does not have an entry, and the child is
                     // modified and being pruned. This means we can just delete
                     // it from the parent.
+                    cachedCoinsUsage -= itUs->second.DynamicMemoryUsage();
                     cacheCoins.erase(itUs);
                 } else {
                     // A normal modification.
+                    cachedCoinsUsage -= itUs->second.DynamicMemoryUsage();
+                    if (!(itUs->second.flags & CCoinsCacheEntry::FRESH)) {
+                        // Carry over which outputs changed. A fresh child entry replaces
+                        // a pruned one here, so all of its outputs are new.
+                        if (it->second.flags & CCoinsCacheEntry::FRESH) {
+                            for (unsigned int i = 0; i < it->second.coins.vout.size(); i++)
+                                itUs->second.MarkDirtyOut(i);
+                        } else {
+                            for (unsigned int i = 0; i < it->second.vDirtyOut.size(); i++)
+                                if (it->second.vDirtyOut[i])
+                                    itUs->second.MarkDirtyOut(i);
+                        }
+                    }
                     itUs->second.coins.swap(it->second.coins);
+                    cachedCoinsUsage += itUs->second.DynamicMemoryUsage();
                     itUs->second.flags |= CCoinsCacheEntry::DIRTY;
                 }
             }
@@ -202,7 +228,10 @@ bool CCoinsViewCache::BatchWrite(CCoinsMap& mapCoins, const uint256& hashBlockIn
 bool CCoinsViewCache::Flush()
 {
     bool fOk = base->BatchWrite(cacheCoins, hashBlock);
-    cacheCoins.clear();
+    // Drop the map with its buckets, so that the pool can give its memory back
+    CCoinsMap(0, CCoinsKeyHasher(), std::equal_to<uint256>(), CCoinsMap::allocator_type(&cachePool)).swap(cacheCoins);
+    cachePool.Release();
+    cachedCoinsUsage = 0;
     return fOk;
 }
 
@@ -264,18 +293,48 @@ double CCoinsViewCache::GetPriority(const CTransaction& tx, int nHeight) const
     return tx.ComputePriority(dResult);
 }
 
-CCoinsModifier::CCoinsModifier(CCoinsViewCache& cache_, CCoinsMap::iterator it_) : cache(cache_), it(it_)
+CCoinsModifier::CCoinsModifier(CCoinsViewCache& cache_, CCoinsMap::iterator it_, size_t usage) : cache(cache_), it(it_), cachedCoinUsage(usage)
 {
     assert(!cache.hasModifier);
     cache.hasModifier = true;
+    const CCoins& coins = it->second.coins;
+    if (!(it->second.flags & CCoinsCacheEntry::FRESH)) {
+        vAvailableBefore.resize(coins.vout.size());
+        for (unsigned int i = 0; i < coins.vout.size(); i++)
+            vAvailableBefore[i] = !coins.vout[i].IsNull();
+    }
+    fCoinBaseBefore = coins.fCoinBase;
+    fCoinStakeBefore = coins.fCoinStake;
+    nHeightBefore = coins.nHeight;
+    nVersionBefore = coins.nVersion;
 }
 
 CCoinsModifier::~CCoinsModifier()
 {
     assert(cache.hasModifier);
     cache.hasModifier = false;
-    it->second.coins.Cleanup();
-    if ((it->second.flags & CCoinsCacheEntry::FRESH) && it->second.coins.IsPruned()) {
+    CCoinsCacheEntry& entry = it->second;
+    entry.coins.Cleanup();
+    if (!(entry.flags & CCoinsCacheEntry::FRESH)) {
+        // Outputs that were spent or added are dirty, and all outputs are when the
+        // transaction metadata changed. Outputs are never replaced in place by a change
+        // that gets written back (only an unclean disconnect does that).
+        const CCoins& coins = entry.coins;
+        bool fMetaChanged = coins.fCoinBase != fCoinBaseBefore || coins.fCoinStake != fCoinStakeBefore ||
+                            coins.nHeight != nHeightBefore || coins.nVersion != nVersionBefore;
+        unsigned int nOutputs = std::max(vAvailableBefore.size(), coins.vout.size());
+        for (unsigned int i = 0; i < nOutputs; i++) {
+            bool fBefore = i < vAvailableBefore.size() && vAvailableBefore[i];
+            bool fAfter = i < coins.vout.size() && !coins.vout[i].IsNull();
+            if (fMetaChanged ? (fBefore || fAfter) : (fBefore != fAfter))
+                entry.MarkDirtyOut(i);
+        }
+    }
+    cache.cachedCoinsUsage -= cachedCoinUsage; // Subtract the old usage
+    if ((entry.flags & CCoinsCacheEntry::FRESH) && entry.coins.IsPruned()) {
         cache.cacheCoins.erase(it);
+    } else {
+        // If the coin still exists after the modification, add the new usage
+        cache.cachedCoinsUsage += entry.DynamicMemoryUsage();
     }
 }
@@ -7,7 +7,9 @@
 #ifndef BITCOIN_COINS_H
 #define BITCOIN_COINS_H
 
+#include "allocators.h"
 #include "compressor.h"
+#include "memusage.h"
 #include "script/standard.h"
 #include "serialize.h"
 #include "uint256.h"
@@ -284,6 +286,15 @@ public:
                 return false;
         return true;
     }
+
+    //! heap memory held by the outputs and their scripts
+    size_t DynamicMemoryUsage() const
+    {
+        size_t ret = memusage::DynamicUsage(vout);
+        BOOST_FOREACH (const CTxOut& out, vout)
+            ret += memusage::DynamicUsage(out.scriptPubKey);
+        return ret;
+    }
 };
 
 class CCoinsKeyHasher
@@ -307,6 +318,7 @@ public:
 
 struct CCoinsCacheEntry {
     CCoins coins; // The actual cached data.
+    std::vector<bool> vDirtyOut; // The outputs that are potentially different from the parent view; only kept when DIRTY and not FRESH.
     unsigned char flags;
 
     enum Flags {
@@ -315,9 +327,21 @@ struct CCoinsCacheEntry {
     };
 
     CCoinsCacheEntry() : coins(), flags(0) {}
+
+    void MarkDirtyOut(unsigned int n)
+    {
+        if (n >= vDirtyOut.size())
+            vDirtyOut.resize(n + 1);
+        vDirtyOut[n] = true;
+    }
+
+    size_t DynamicMemoryUsage() const
+    {
+        return coins.DynamicMemoryUsage() + memusage::MallocUsage((vDirtyOut.capacity() + 7) / 8);
+    }
 };
 
-typedef boost::unordered_map<uint256, CCoinsCacheEntry, CCoinsKeyHasher> CCoinsMap;
+typedef boost::unordered_map<uint256, CCoinsCacheEntry, CCoinsKeyHasher, std::equal_to<uint256>, pool_allocator<std::pair<const uint256, CCoinsCacheEntry> > > CCoinsMap;
 
 struct CCoinsStats {
     int nHeight;
@@ -399,7 +423,15 @@ class CCoinsModifier
 private:
     CCoinsViewCache& cache;
     CCoinsMap::iterator it;
-    CCoinsModifier(CCoinsViewCache& cache_, CCoinsMap::iterator it_);
+    size_t cachedCoinUsage; // Cached memory usage of the CCoins object before modification
+    //! Which outputs were available and the transaction metadata before modification, to find
+    //! the outputs that changed. Only recorded when the entry is not FRESH.
+    std::vector<bool> vAvailableBefore;
+    bool fCoinBaseBefore;
+    bool fCoinStakeBefore;
+    int nHeightBefore;
+    int nVersionBefore;
+    CCoinsModifier(CCoinsViewCache& cache_, CCoinsMap::iterator it_, size_t usage);
 
 public:
     CCoins* operator->() { return &it->second.coins; }
@@ -420,8 +452,13 @@ protected:
      * declared as "const".  
      */
     mutable uint256 hashBlock;
+    //! Holds the nodes of cacheCoins, so it must be declared first
+    CPoolResource cachePool;
     mutable CCoinsMap cacheCoins;
 
+    /* Cached dynamic memory usage for the inner CCoins objects. */
+    mutable size_t cachedCoinsUsage;
+
 public:
     CCoinsViewCache(CCoinsView* baseIn);
     ~CCoinsViewCache();
@@ -457,6 +494,9 @@ public:
     //! Calculate the size of the cache (in number of transactions)
     unsigned int GetCacheSize() const;
 
+    //! Calculate the memory held by the cache, in bytes
+    size_t DynamicMemoryUsage() const;
+
     /** 
      * Amount of hoolibet coming in to a transaction
      * Note that lightweight clients may not know anything besides the hash of previous transactions,
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string>
 
 /** A hasher class for SHA-256. */
 class CSHA256
@@ -25,4 +26,20 @@ public:
     CSHA256& Reset();
 };
 
+/**
+ * Select the fastest SHA-256 implementations the CPU supports, returning a
+ * description of them. Call once at startup, before any other threads run.
+ */
+std::string SHA256AutoDetect();
+
+/**
+ * Compute the double SHA-256 of each of blocks 64-byte inputs, such as the
+ * pairs of hashes in a merkle tree level, several at a time where possible.
+ * out receives blocks * 32 bytes; in holds blocks * 64 bytes. out may be
+ * equal to in, so a merkle level can be hashed in place: every input block is
+ * read before the output that overlaps it is written. Other overlaps are not
+ * supported.
+ */
+void SHA256D64(unsigned char* out, const unsigned char* in, size_t blocks);
+
 #endif // BITCOIN_CRYPTO_SHA256_H
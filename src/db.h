@@ -7,6 +7,7 @@
 #define BITCOIN_DB_H
 
 #include "clientversion.h"
+#include "perfstats.h"
 #include "serialize.h"
 #include "streams.h"
 #include "sync.h"
@@ -119,6 +120,7 @@ protected:
     {
         if (!pdb)
             return false;
+        PERF_TIMER("bdb.read");
 
         // Key
         CDataStream ssKey(SER_DISK, CLIENT_VERSION);
@@ -155,6 +157,7 @@ protected:
             return false;
         if (fReadOnly)
             assert(!"Write called on database in read-only mode");
+        PERF_TIMER("bdb.write");
 
         // Key
         CDataStream ssKey(SER_DISK, CLIENT_VERSION);
@@ -3,88 +3,62 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "invalid.h"
-#include "invalid_outpoints.json.h"
-#include "invalid_serials.json.h"
+#include "invalid_tables.h"
+
+#include "crypto/common.h"
+#include "primitives/zerocoin.h"
+
+#include <algorithm>
+#include <string.h>
 
 namespace invalid_out
 {
-    std::set<CBigNum> setInvalidSerials;
-    std::set<COutPoint> setInvalidOutPoints;
-
-    UniValue read_json(const std::string& jsondata)
+    namespace
     {
-        UniValue v;
-
-        if (!v.read(jsondata) || !v.isArray())
-        {
-            return UniValue(UniValue::VARR);
-        }
-        return v.get_array();
+    template <size_t N>
+    struct CKeyLess {
+        bool operator()(const unsigned char (&a)[N], const unsigned char* b) const { return memcmp(a, b, N) < 0; }
+    };
+
+    /** Binary search the bucket of entries that share the key's first byte, typically a handful */
+    template <size_t N>
+    bool TableContains(const unsigned char (*table)[N], const uint16_t* index, const unsigned char* key)
+    {
+        const unsigned char (*begin)[N] = table + index[key[0]];
+        const unsigned char (*end)[N] = table + index[key[0] + 1];
+        const unsigned char (*it)[N] = std::lower_bound(begin, end, key, CKeyLess<N>());
+        return it != end && memcmp(*it, key, N) == 0;
+    }
     }
 
-    bool LoadOutpoints()
+    bool ContainsOutPoint(const COutPoint& out)
     {
-        UniValue v = read_json(LoadInvalidOutPoints());
-
-        if (v.empty())
-            return false;
-
-        for (unsigned int idx = 0; idx < v.size(); idx++) {
-            const UniValue &val = v[idx];
-            const UniValue &o = val.get_obj();
-
-            const UniValue &vTxid = find_value(o, "txid");
-            if (!vTxid.isStr())
-                return false;
-
-            uint256 txid = uint256(vTxid.get_str());
-            if (txid == 0)
-                return false;
-
-            const UniValue &vN = find_value(o, "n");
-            if (!vN.isNum())
-                return false;
-
-            auto n = static_cast<uint32_t>(vN.get_int());
-            COutPoint out(txid, n);
-            setInvalidOutPoints.insert(out);
-        }
-        return true;
+        unsigned char key[36];
+        memcpy(key, out.hash.begin(), 32);
+        WriteLE32(key + 32, out.n);
+        return TableContains(pnInvalidOutPoints, pnInvalidOutPointsIndex, key);
     }
 
-    bool LoadSerials()
+    bool ContainsSerial(const CBigNum& bnSerial)
     {
-        UniValue v = read_json(LoadInvalidSerials());
-
-        if (v.empty())
-            return false;
-
-        for (unsigned int idx = 0; idx < v.size(); idx++) {
-            const UniValue &val = v[idx];
-            const UniValue &o = val.get_obj();
-
-            const UniValue &vSerial = find_value(o, "s");
-            if (!vSerial.isStr())
-                return false;
-
-            CBigNum bnSerial = 0;
-            bnSerial.SetHex(vSerial.get_str());
-            if (bnSerial == 0)
-                return false;
-            setInvalidSerials.insert(bnSerial);
-        }
-
-        return true;
+        return ContainsSerialHash(GetSerialHash(bnSerial));
     }
 
-    bool ContainsOutPoint(const COutPoint& out)
+    bool ContainsSerialHash(const uint256& hashSerial)
     {
-        return static_cast<bool>(setInvalidOutPoints.count(out));
+        return TableContains(pnInvalidSerialHashes, pnInvalidSerialHashesIndex, hashSerial.begin());
     }
 
-    bool ContainsSerial(const CBigNum& bnSerial)
+    std::vector<COutPoint> GetInvalidOutPoints()
     {
-        return static_cast<bool>(setInvalidSerials.count(bnSerial));
+        const size_t nOutPoints = sizeof(pnInvalidOutPoints) / sizeof(pnInvalidOutPoints[0]);
+        std::vector<COutPoint> vOutPoints;
+        vOutPoints.reserve(nOutPoints);
+        for (size_t i = 0; i < nOutPoints; i++) {
+            uint256 hash;
+            memcpy(hash.begin(), pnInvalidOutPoints[i], 32);
+            vOutPoints.push_back(COutPoint(hash, ReadLE32(pnInvalidOutPoints[i] + 32)));
+        }
+        return vOutPoints;
     }
 }
-
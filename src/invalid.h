@@ -5,21 +5,23 @@
 #ifndef HOOLIBET_INVALID_H
 #define HOOLIBET_INVALID_H
 
-#endif //HOOLIBET_INVALID_H
-
 #include <libzerocoin/bignum.h>
-#include <univalue/include/univalue.h>
 #include <primitives/transaction.h>
 
+#include <vector>
+
+/**
+ * Outpoints and zerocoin serials banned from the chain. The lists are
+ * compiled in as sorted tables, see contrib/invalid/generate-invalid.py.
+ */
 namespace invalid_out
 {
-    extern std::set<CBigNum> setInvalidSerials;
-    extern std::set<COutPoint> setInvalidOutPoints;
-
-    UniValue read_json(const std::string& jsondata);
-
     bool ContainsOutPoint(const COutPoint& out);
     bool ContainsSerial(const CBigNum& bnSerial);
-    bool LoadOutpoints();
-    bool LoadSerials();
-}
\ No newline at end of file
+    bool ContainsSerialHash(const uint256& hashSerial);
+
+    /** Every banned outpoint, in table order */
+    std::vector<COutPoint> GetInvalidOutPoints();
+}
+
+#endif //HOOLIBET_INVALID_H
@@ -1,6796 +0,0 @@
-// Copyright (c) 2018 The PIVX developers
-// Distributed under the MIT software license, see the accompanying
-// file COPYING or http://www.opensource.org/licenses/mit-license.php.
-
-#ifndef HOOLIBET_INVALID_OUTPOINTS_JSON_H
-#define HOOLIBET_INVALID_OUTPOINTS_JSON_H
-#include <string>
-
-std::string LoadInvalidOutPoints()
-{
-    std::string str = "[\n"
-            "  {\n"
-            "    \"txid\": \"00405ad8cc4ec7b6be27dedc6bf19f2febf8e338031fe552d7bf5c0dfd6e67de\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"00438a4c089b31f8b12c75c274eed5914a0e78f91bb8bb8cf52f2194b8190cdb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"00438a4c089b31f8b12c75c274eed5914a0e78f91bb8bb8cf52f2194b8190cdb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0091d20a2af5f54e1cf5cd27cb5b7d2fe928db4cb9c40987d8ba8f206cff225a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0091d20a2af5f54e1cf5cd27cb5b7d2fe928db4cb9c40987d8ba8f206cff225a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0139e44f59fee4052d43cf709f3078cf489304d6107e9d7a0885b466a3a22dc6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0139e44f59fee4052d43cf709f3078cf489304d6107e9d7a0885b466a3a22dc6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"017ad2f684700eb538484231e5455d7613867cc4772c468d03e5bd99e8eb8e23\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"01d0113c48e1dfc08bff37faaeaa50a1eb98e26da20e860a2991a4dd3d2f3e61\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"01e74cc60b380a1102103f7df14bb8972b43fc2e3781a65920bf40c0e4b012e9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"01e74cc60b380a1102103f7df14bb8972b43fc2e3781a65920bf40c0e4b012e9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"02484718907a39f8caa13d61a52e4e977d7bfe4703bda0b4a680e65e379b7eae\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"02484718907a39f8caa13d61a52e4e977d7bfe4703bda0b4a680e65e379b7eae\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"02ec53a6da7c0dcd662a4fd7d6af199ab48caf1d921aa1953e7ce110083cfcf9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0357a0a5011e8bd34d767b8aae1d5872edef12f668d84b5d4787c8f0b4b52746\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0357a0a5011e8bd34d767b8aae1d5872edef12f668d84b5d4787c8f0b4b52746\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"03bcbaf2c42a271ce5b1b0080c0bb57cd2f59dbbe71bb0170d0bf6a4f0c743f7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"040361e86ebd598eb580a9d3d00d482b55d793816b50882d5ce64dd1869a70e9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"040361e86ebd598eb580a9d3d00d482b55d793816b50882d5ce64dd1869a70e9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0489446611c91f4e4c605e572e924871eb028643fa215a55f5464f77002c773c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0489446611c91f4e4c605e572e924871eb028643fa215a55f5464f77002c773c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"04ac31cd61ac6fd317e58b90e9a32ef6b03c067880bf27c055330742a1d2f019\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"04ac31cd61ac6fd317e58b90e9a32ef6b03c067880bf27c055330742a1d2f019\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"05661cbaf57d69e77fc7f721554bc0b073a0cb17a4f6ff91bd9555bd55bf5254\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"05730ffc2f0f00683c6ee8662dde8f6cd166ccd8f0597484b32aebe8e05104aa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0583ae0ba9983215be2e1f2d67da43b3b37d1805d17811d81bdf9ae8699c8cf1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"05db42a11a2d59213c138764fb4a14ee50cb27ad8564685adc830cce0cd67815\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"06175aea562856aac029c14187624106a5e14552cbab440b4aa81c63329c35dc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"06175aea562856aac029c14187624106a5e14552cbab440b4aa81c63329c35dc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0622cac4d75cae612a717a192a5b36d5d7c7d5d195db76c8bb2da5770ab79a1d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"06468b85a292d3176a17c3452f46d9d2f090c11e6af7c358440543f36dbddcc5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"06468b85a292d3176a17c3452f46d9d2f090c11e6af7c358440543f36dbddcc5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"065619befdddb2e6a5637e912c87cbff0d9678de5ebda22914f330bdba637da0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"06628c6e7bab04018035707554b5b32c6fad371bd549e36ea863b9abb2194e1c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"06628c6e7bab04018035707554b5b32c6fad371bd549e36ea863b9abb2194e1c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"06895aa5d28b45fb2f66a6a658b9c42a40c72d29f930969e573bdf4f2c65d19f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"071a08099310da3c409e2579c3bdcf9cfb854ccd9766b42ddaa4ad344509b891\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"07ae9fe0c4daf8c3a2d464c51ef2a90c4d0b79004326991ed84bb57ccd07aa75\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"07ae9fe0c4daf8c3a2d464c51ef2a90c4d0b79004326991ed84bb57ccd07aa75\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0812a19701fa062bfe20de85d5e21a897c9181a4e1a534339923b6f726130e35\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"081a70e987901b32bedbd6e65d8db3cb69bd6028fdf5484345e101849331a63f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"081a70e987901b32bedbd6e65d8db3cb69bd6028fdf5484345e101849331a63f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"08501c017c5a66f99a34d4719df9192e292a67d7e39bbc30cce0b0524cbfb321\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"08501c017c5a66f99a34d4719df9192e292a67d7e39bbc30cce0b0524cbfb321\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"089e44127ae51cf5d5882089f241fc1e1cc22b852d8f7f5f6f8dc91e4c4037f5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"089e44127ae51cf5d5882089f241fc1e1cc22b852d8f7f5f6f8dc91e4c4037f5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"08c1035b5302e3d73ab06bb6e9c20d736d1e02d8c10669dcf475958c9d5a9fba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"09669ccfd0e55ee8f97a6e9295d697ced19a0e83fddc9d93c118ef580b9464de\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"09669ccfd0e55ee8f97a6e9295d697ced19a0e83fddc9d93c118ef580b9464de\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0993240231eccb835c0371088cfc7ee86885ba566adbf5ee206af121da9bf348\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0993240231eccb835c0371088cfc7ee86885ba566adbf5ee206af121da9bf348\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0a2df0ef5ac5db86869b4e118f45ef72421140635156ef424de907dc1d0165b3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0a2df0ef5ac5db86869b4e118f45ef72421140635156ef424de907dc1d0165b3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0a3d864593f59085f5b62e47af10769fec4a68ab03a116695c37a33d318cd1ba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0a3d864593f59085f5b62e47af10769fec4a68ab03a116695c37a33d318cd1ba\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0a6099002810dc4065cec3bffa07c876e451b22b9c2700ebd29366846577661e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0a6099002810dc4065cec3bffa07c876e451b22b9c2700ebd29366846577661e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0a67f3b8210e12c4e4cbed5d9a46a3e07938d2af8dcfb5549c6ac4f873b2bc44\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0b88115d9645a51d9fa56f84e1d05b927949b933f6159c4eda6f304e4326d192\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0bd97e3d96405f80d736f292c05ef8d89ca4dc07c5e366e8e72c70fa0c73069f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0bd97e3d96405f80d736f292c05ef8d89ca4dc07c5e366e8e72c70fa0c73069f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0bf42890cc5957e41a04c88e167babed0857597163892ac53b1c46c6f5ed49e0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0bf42890cc5957e41a04c88e167babed0857597163892ac53b1c46c6f5ed49e0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0d08120f32d32e9d35c0f793e9c2dec52eb864caa085103056bfe7d813b24ddf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0d08120f32d32e9d35c0f793e9c2dec52eb864caa085103056bfe7d813b24ddf\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0d241b451d17e435e61a196cd275ef0034d1f101307859abafc3539646c85d0c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0d241b451d17e435e61a196cd275ef0034d1f101307859abafc3539646c85d0c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0d3f317455116bf3b05b0d9f0ab8cdb8ac2aa31b2c131ba38e17322f42ad8b82\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0d3f317455116bf3b05b0d9f0ab8cdb8ac2aa31b2c131ba38e17322f42ad8b82\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0dd771ea116c69ac2f42a4809f6207fe302532b963596226a1ee07dbf3ba4a8d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0dd771ea116c69ac2f42a4809f6207fe302532b963596226a1ee07dbf3ba4a8d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0df13e1ede2d64503dcd75b756a46a13658b91a6cf97465f424fb6e2287c52f9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0e2e43e761a0bc371a37f9dc3b0a02e4e6902a373de06d2e4e87e9a7b1e97bcc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0eb93ac17ae304f4bd175cc14296fef5acc52c14fa0afd75d9cd8b37a11a4ab2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0eb93ac17ae304f4bd175cc14296fef5acc52c14fa0afd75d9cd8b37a11a4ab2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0ebde08b36f3e1699b26b7e2b93f4a20d5280b1d419da4c2ec20beab18f22930\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0ebde08b36f3e1699b26b7e2b93f4a20d5280b1d419da4c2ec20beab18f22930\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0f036a997354c93f9ca34d70ad0ff5988bd0e28b2d89b1f57d05df37ff57ba5f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0f50959e88bc2dd96835f0dee3ccd9ff0832d66b7f3f2fdb99c25ada3e5899bd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0f50959e88bc2dd96835f0dee3ccd9ff0832d66b7f3f2fdb99c25ada3e5899bd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0f50fde9dbec1fa5418947e426dec21941de384c21dd61a6d5023294c94897f6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0f50fde9dbec1fa5418947e426dec21941de384c21dd61a6d5023294c94897f6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0fc7311433f8e2931dbdd5aaae15e97e42cc3f474ae539f8f8eddfa032336fc8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"0fc7311433f8e2931dbdd5aaae15e97e42cc3f474ae539f8f8eddfa032336fc8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"107757d0e2b6f9613401cc1c50dcd35c0c056c09a817f0549fa85ce60ef89d25\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1088aebc92c20c31f55a12e6c014360d50c97b2034d3a89e80fd53b43ec840b1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"108abf02d81486a1c6c33d96436cc0498f39233dee394ad1ad05e7a5e31d3779\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"10a83415a1fd677ec66da06bbeb4bb7fe691326960c2343b0ab4123d6012c86d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"10a83415a1fd677ec66da06bbeb4bb7fe691326960c2343b0ab4123d6012c86d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"111214208503954bc40a95382ab3c12e221718a3dd12f8800d607f05f691fab0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"111214208503954bc40a95382ab3c12e221718a3dd12f8800d607f05f691fab0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"11c7c35990a2e94f4440a8c9fb5b77de9bf7fc3adcfa35d5bfd3509cc2dbe1ad\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"11f1a21c092236a90c10e0202e1490e6e0336cef2727527a4518419346da0312\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"11f1a21c092236a90c10e0202e1490e6e0336cef2727527a4518419346da0312\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"11f2838ad108074df8b7adabaed73bf8c764ac2a116d525fcc7accfd02ecc38d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"12049cdd325438cb011787f8f59cd18111209fabbaabfa8f100c35522024f2f3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"121832beb663b51a7c03aa9a3800b1b74698c19095ffc93e9de97e066ef8f833\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1253897c64d0d87103f3824cb6e1886c5eb8f5cffbab62554bd4ba04a5b03aff\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1253897c64d0d87103f3824cb6e1886c5eb8f5cffbab62554bd4ba04a5b03aff\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"12600a57dab7c8d3cedfd5784716a6396eb1e0c1b25c0d09a746fceb9a0ee7fa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"12cf428509f09983a15c00d443253515d874940d555cc3acf0035c0674ee60a1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"12cf428509f09983a15c00d443253515d874940d555cc3acf0035c0674ee60a1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"130bf14fd44a22f4d033dc057b9e20b829211e415f12adafcfbb326303bc92c8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"130e0295094e83e23c204e3bdd13a6a6a6b07f4bda51ad533200ea9a30a78dde\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1314219afcbf6f3fb185f4fd52ab03bcea04c0140b591888e2a35a1c5a95f420\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1314219afcbf6f3fb185f4fd52ab03bcea04c0140b591888e2a35a1c5a95f420\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"13b77e12b54aaff0e45b883bdcc7373fbb010cdb34001ef4e028fbc446ca6144\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"13fa26c0ed5f516c317c76dc32f907bc24cb5b23b9b32babe3b4d2a1f3e038c2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"13fa26c0ed5f516c317c76dc32f907bc24cb5b23b9b32babe3b4d2a1f3e038c2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"14084ac4fc5e1abec5da9168e06244785acb55825b6c5bf4342a9ee7aacb2211\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"14084ac4fc5e1abec5da9168e06244785acb55825b6c5bf4342a9ee7aacb2211\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"14d173bd618007c8f96121981d6271f9e1d26a7e224f207991dae6f4d759efad\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"14f775627b5e9b18cbd63a91f0b537649238d5a3654eaf0d9cd01b00e9929838\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"15566bd86e03604a46383d2b65fa619e5eae7ad88c5d88fdd8b80861176df6fa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"15566bd86e03604a46383d2b65fa619e5eae7ad88c5d88fdd8b80861176df6fa\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"158e1e5e396e99b9e7b9e39853fca437a5dbbd4bf3a1e6d3aa90bed923ef0e99\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"158e1e5e396e99b9e7b9e39853fca437a5dbbd4bf3a1e6d3aa90bed923ef0e99\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"159591f7b062a198221deac1cbfe612458b24a8e91150980eec5d451b91657f7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"159591f7b062a198221deac1cbfe612458b24a8e91150980eec5d451b91657f7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"15f6651e62ff25ed50338765e44e948a8baf735de01f99a093b4609bd4cd008f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1648b142fe68303c5195a630c2eee0143ff1fa74087db0958ed3a6338253be60\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"166aacbae84f7fdce526de92849c72a9e8d4c863427d67ee1450fe934653d2ac\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"166aacbae84f7fdce526de92849c72a9e8d4c863427d67ee1450fe934653d2ac\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"16d27ac809bb613026f18a3255c941c5cdb14589a02d11fe0b48e845d8312689\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"177829c7de9b480b81927f80ab005cc9e7ba58a10a8d6b5908db95b8e54eac18\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"177829c7de9b480b81927f80ab005cc9e7ba58a10a8d6b5908db95b8e54eac18\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"18665cfb229c4933caf048ce2b95e066bc854596bb81d62c9dabe985e9635cd5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"19134f4d27a5402ef2b82d96b83f478b17798cfadc323c071dc74ed7ec7165fa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"19134f4d27a5402ef2b82d96b83f478b17798cfadc323c071dc74ed7ec7165fa\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"196dae0b5880bc0b9015502298adf1a65b0ac2b391c0696530404d644bb127ba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"197e857cc16314f156b68122695291e0721c440bf2fff5ca0120e47f1da358d1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"197e857cc16314f156b68122695291e0721c440bf2fff5ca0120e47f1da358d1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"19923ee0897ba0e3beb4683c2e5df8f956181feb1c49fddf6f6b44f28bb83cf5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"19923ee0897ba0e3beb4683c2e5df8f956181feb1c49fddf6f6b44f28bb83cf5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"199b9b2c5b96736c19a13f9f07365d8ec1b4bb56d8c0fa7dab6bd1bc50d8c522\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"199b9b2c5b96736c19a13f9f07365d8ec1b4bb56d8c0fa7dab6bd1bc50d8c522\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"19da31c5c53961c9c29abd76fe8fe2c55e73cf4e4a1936dff8b879bb13844f43\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"19da31c5c53961c9c29abd76fe8fe2c55e73cf4e4a1936dff8b879bb13844f43\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1a0910c3ca9a01a34706b53318d991bb1bdb1313f120701e9c6d89605c96ee97\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1a33e5140fac18a334315612940b2cded7418228e24e4712a1a874e05017070a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1a57e43844d2670839190c3617f027cc23110404d4c6f5b85ff73fce2e7028b8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1a69f50a7f1c197853fc146b3cb1c278f89b1a72aea7c9d1d64b75acd53eb2d7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1a69f50a7f1c197853fc146b3cb1c278f89b1a72aea7c9d1d64b75acd53eb2d7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1a96a2fb4fe59ae80190e15e87e4eac7c604b998b4d3f78cbffb95d6e4ea671b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1a96a2fb4fe59ae80190e15e87e4eac7c604b998b4d3f78cbffb95d6e4ea671b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1ae0ac2f6ba92760c36856b1f3dfc01026d75abfdf8c00621bc28a2db2c380e9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1ae0ac2f6ba92760c36856b1f3dfc01026d75abfdf8c00621bc28a2db2c380e9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1b01e7daaed504b1dab238caa2369fa585c4ce5d22cccba3a5cc39df6a0d780d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1b01e7daaed504b1dab238caa2369fa585c4ce5d22cccba3a5cc39df6a0d780d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1b0d95efd87a9604d99402b5f2ef58fed33d94aae216b938979883a9639153ef\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1b0d95efd87a9604d99402b5f2ef58fed33d94aae216b938979883a9639153ef\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1b2dfb3c8824b5a93c28f63c226675762e1d401dfaa8cbd4380c15f40b8fd44e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1b2dfb3c8824b5a93c28f63c226675762e1d401dfaa8cbd4380c15f40b8fd44e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1b2e1983481f6c4b9da5460b9169b92031ee6b4d03eaccba246e5bdddef1f3dc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1ba5bdde0f31ac1e581aedf6da1229fb6c38176be43382494061f9690cf2869a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1ba5bdde0f31ac1e581aedf6da1229fb6c38176be43382494061f9690cf2869a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1bf2cfd9cedb058caee02f6c561a3df026f66f1cd3aebea5c131532c35ce8f64\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1c3ac61aead677c04bee734f29f1bfd896b8edf232c63c717460e7845256e3ed\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1c3ac61aead677c04bee734f29f1bfd896b8edf232c63c717460e7845256e3ed\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1c64d62fdbda9b0b6730152e7866576cb09fce1ea3e39cc3f2048f373d51338f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1c64d62fdbda9b0b6730152e7866576cb09fce1ea3e39cc3f2048f373d51338f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1cb84da323c53cb49294d5e00965d95801c0b28514322130357313770e0ab240\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1cb84da323c53cb49294d5e00965d95801c0b28514322130357313770e0ab240\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1cd0c0df697ecce58d7371e255fd452b6040d6ab5dd39575b5a984c332279333\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1cd0c0df697ecce58d7371e255fd452b6040d6ab5dd39575b5a984c332279333\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d0da20ac550fc0dcae078ea8118d7d2d3ee0331e4f2fa1f68a4e3105a26b638\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d0da20ac550fc0dcae078ea8118d7d2d3ee0331e4f2fa1f68a4e3105a26b638\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d28a9f6a8ff5c4fabf1457f3def15586bf9452fb31fe6ed22c499792ecfe5c6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d28a9f6a8ff5c4fabf1457f3def15586bf9452fb31fe6ed22c499792ecfe5c6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d306a7d07aece5546f594e54eedccfacb27332149e3cc7ecfbbe8c4c4b20f0f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d306a7d07aece5546f594e54eedccfacb27332149e3cc7ecfbbe8c4c4b20f0f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d398e40c5e5ca00fc5e60b35a4eef15c86ee2a1d98bf11b0b3281e956b97482\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1d398e40c5e5ca00fc5e60b35a4eef15c86ee2a1d98bf11b0b3281e956b97482\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1e2caee2e2add82506213a6bebe22c0ae9517ed561cc2574f96f6846c3d69990\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1e4df7992c08783ab9c3252de58ddb58abd74103f03ec00568e066396de4aa45\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1e4df7992c08783ab9c3252de58ddb58abd74103f03ec00568e066396de4aa45\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1ed44f23e384722d04836b9f68a848216d419201cf512b3e98e1c92878e87c66\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1ed44f23e384722d04836b9f68a848216d419201cf512b3e98e1c92878e87c66\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1f20d7962b019613a16a5fae6c589d58f4dc111e309d16a97e02d1fa373f811d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1f619fb622c58ac5eb47ede8aa4d9381e71375c89835f752d7aecca6558f2dee\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1f619fb622c58ac5eb47ede8aa4d9381e71375c89835f752d7aecca6558f2dee\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1f788a2449cb7686ab5f87735093b229b4739c138c409c6213a7865304556aa0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"1f788a2449cb7686ab5f87735093b229b4739c138c409c6213a7865304556aa0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"203f2fa072dec16b9025453c2bb54695dabdd5a458bd63dd32253862cd248bbe\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"203f2fa072dec16b9025453c2bb54695dabdd5a458bd63dd32253862cd248bbe\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"20f8762ca75f932edd0e922b934ad54be82a6a5cb7a3fdeda6b6fe2af9dedee8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"217e665294b5f43977f53dd34a030be6f813f9bc2f6c88402c769bab44c10395\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"217e665294b5f43977f53dd34a030be6f813f9bc2f6c88402c769bab44c10395\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"228115a174a51c23b5a7baf6d0de7be7654875486df843a98ee3c3c447992b46\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"228115a174a51c23b5a7baf6d0de7be7654875486df843a98ee3c3c447992b46\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"22b9ad2b0a376c135b9763e4e65ca9a8dbd07492c954046e3e0ec33a6c4b556c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"22b9ad2b0a376c135b9763e4e65ca9a8dbd07492c954046e3e0ec33a6c4b556c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"22c759a214d532c0fdce60758adc7dce600f365ae696038a503567333b06abd5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"22c759a214d532c0fdce60758adc7dce600f365ae696038a503567333b06abd5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"23486925a2cea21f4a5eef18040e4356174dd316c3d99ea4a7b2a5482febf62e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2372cdd7ea5c4491f67988262f68d3f531b130092e67e55f5d9b9dc82bd4d843\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"237d8eb09f2e691fb0c4d8793e1d84ff8407ce543e202a56fe00c462e770291b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"238c15f6bef55a1a450d94ee7af95cc285a287090efde788a7dd55c95d728c94\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"238c15f6bef55a1a450d94ee7af95cc285a287090efde788a7dd55c95d728c94\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"238f528f048ef8c40636e8bb56f12676b494f79f344677852f5876e5b185d8f7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"238f528f048ef8c40636e8bb56f12676b494f79f344677852f5876e5b185d8f7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"24678445b4c24dd0786de6115452bf64f616ad31aa03c51004ac4028b6f1f43c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"24678445b4c24dd0786de6115452bf64f616ad31aa03c51004ac4028b6f1f43c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"24a595be809e552319cd5b4f264be3b053fe8c780d843dd81a7b45282ed360bc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"24a595be809e552319cd5b4f264be3b053fe8c780d843dd81a7b45282ed360bc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"24ba685f8bd3f4fd806e7f85864b9796ff9a889f2496362791b2101b1777be83\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"24ba685f8bd3f4fd806e7f85864b9796ff9a889f2496362791b2101b1777be83\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"253e1c05d09a9e77b2cc6c8c98315e0d522be2d9b8bbf976c00e0dbb1a6bddab\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"256b0da6517ad9a051202c183fa40823b06c70daafc3c48e6f2103b91706c921\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"256c9146466b57ad90a139cf1589164fa626217ae12b86d0177ca2e1464af060\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"256c9146466b57ad90a139cf1589164fa626217ae12b86d0177ca2e1464af060\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"259c8189b207af99686ee4129b1fd3a3c08163140d048a1eb0aa7ccb56198296\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"25af4a63ad75515616bc7be30c3e318e256292e275b62315d8a77511ea3c4f4c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"25d2e52bd41a76ac6284b975f72de0e49a78ebe72c7ce9d0141dcf6aea82f3af\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"25d2e52bd41a76ac6284b975f72de0e49a78ebe72c7ce9d0141dcf6aea82f3af\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"25f3ca7699d60bfba5e2c43a8795d5b26c0bdaf08f74f5998de1ea6049695eee\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"25f3ca7699d60bfba5e2c43a8795d5b26c0bdaf08f74f5998de1ea6049695eee\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"25f81c6be419a368abafc8a7e8926f90b579760c06ab26739b6f615c511c631c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"263ad4802d845502b5e68e8c38166e4b8a529e5d0b1769e9418db8173aed3b8c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"263ad4802d845502b5e68e8c38166e4b8a529e5d0b1769e9418db8173aed3b8c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"264f518f51f4d6529c06d5c9aab3b736d9c7af2197c372253be243adaffe1bf6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"264f518f51f4d6529c06d5c9aab3b736d9c7af2197c372253be243adaffe1bf6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"26717856eef42334c6c96d2e2c514dd7810fad1862592607767595d24edcfa0e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"26717856eef42334c6c96d2e2c514dd7810fad1862592607767595d24edcfa0e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2694d0c9f34def2f6e1b6b989ae3f6dfd2bde036834cffb2d014e7c3f01e8851\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2694d0c9f34def2f6e1b6b989ae3f6dfd2bde036834cffb2d014e7c3f01e8851\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"273226384a1f303f94d943e43b58b1a8f845be9894f404ee628a161eb36bc6ba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"273226384a1f303f94d943e43b58b1a8f845be9894f404ee628a161eb36bc6ba\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"274c7c852ecd9675bfe009111b4d1a32bade381a1144124e8fecc266925cc320\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"274c7c852ecd9675bfe009111b4d1a32bade381a1144124e8fecc266925cc320\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"276adafb859206731fe91f78fccb70bc1c1bb5994e43811748c3a1274044cac8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"276adafb859206731fe91f78fccb70bc1c1bb5994e43811748c3a1274044cac8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"281937915e6f100b7cfc375c2628dc65263eff1f95ff7eb90a040db4b09c6d94\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"286e660127a8bacf3b887285ada924447bffc3432cb94cc0d3c00d2fd6e123a2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"286e660127a8bacf3b887285ada924447bffc3432cb94cc0d3c00d2fd6e123a2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"28c08b2ad6aa361394cc42e6dcf6d453ca0e1855d58f1d998df4e706bd7afa21\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"28c08b2ad6aa361394cc42e6dcf6d453ca0e1855d58f1d998df4e706bd7afa21\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"29166d34a31a0ccdc42254c0f1533435d5f4e662d16652cc9c6eb2f3639ba8ba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"29166d34a31a0ccdc42254c0f1533435d5f4e662d16652cc9c6eb2f3639ba8ba\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"29dcde5bdb4f0fe0983d38669ee5ceb9578f994df26c4c5ee0fe4527cc5c0d46\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"29dcde5bdb4f0fe0983d38669ee5ceb9578f994df26c4c5ee0fe4527cc5c0d46\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"29fe4707ddb1cd29a457dcb358a870c99e45af75336c45eae4a89a1a07800612\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2a295568d66aa2cd06fb2d89089f2616dfbaec10132d7c97f1232cc10891cc79\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2a7391913dc72ecde8973e4192eb4dbff3ee6d6472185093638f7aeeef78a800\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2a77be1aaf39825def6c77f447d6767043c5c21578113406b40b5a5b85f86a56\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2a77be1aaf39825def6c77f447d6767043c5c21578113406b40b5a5b85f86a56\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2ab0fbebe325d8a178b586523dd669adbc4e89ef95e3e64528625f0d6b5e896f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2ae82c8413426bbf0daa707970c01c7a72043f5cfa46d2d954a4c66a939c666a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2ae82c8413426bbf0daa707970c01c7a72043f5cfa46d2d954a4c66a939c666a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2af91c06d73b7139b333030639cf4ea7b159b56b26aaf4f6ecaf082d37c5f34c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2af91c06d73b7139b333030639cf4ea7b159b56b26aaf4f6ecaf082d37c5f34c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2b07dabbab647ee8658a3ed4c0e5e5f0a0e2e166985346921d1f674216006b5d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2b07dabbab647ee8658a3ed4c0e5e5f0a0e2e166985346921d1f674216006b5d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2bd381aaa5dcbea056cea479b1de373cdf4a01a7c89e61bc39ecaceacd0b5ba1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2bf190f07a2f8834940d3238182ddae2abde6532681fc9b0d35defa9bd999e14\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2bf190f07a2f8834940d3238182ddae2abde6532681fc9b0d35defa9bd999e14\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2bfdb0bd5b52c6abf7fab382b25111756ff308843a4069d5515fa13ab44d4761\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2bfdb0bd5b52c6abf7fab382b25111756ff308843a4069d5515fa13ab44d4761\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2c00e9693f85468daabf07f4e7ff36182814a2123baf17225aea584f2ca0830b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2c00e9693f85468daabf07f4e7ff36182814a2123baf17225aea584f2ca0830b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2c0c08652ecd0378d0adf80208cbb1ce89e8f448dbc50733fe20be6271631313\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2c0c08652ecd0378d0adf80208cbb1ce89e8f448dbc50733fe20be6271631313\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2c684582cf3228672baac8db0b35c436f5115fe6d51c73e046667483d58a05e9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2c684582cf3228672baac8db0b35c436f5115fe6d51c73e046667483d58a05e9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2ce55c8d4dd3862685e3a3d490cc930d9f69e04696fa0febc1a41546066c4cdd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2d6fe7120112ec95877e9bb9a6b22b94e926b3f6de31254eb560a05ff17317fd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2d6fe7120112ec95877e9bb9a6b22b94e926b3f6de31254eb560a05ff17317fd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e08fd6abc3ef4e6d069d1eeaf301ac638c2a9e2017d2d3e45c793ec753042ba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e08fd6abc3ef4e6d069d1eeaf301ac638c2a9e2017d2d3e45c793ec753042ba\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e1108dd8df3acf59d77d23eb557b959e9cc5bf506c8e14079bda9a41b1ae29f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e1108dd8df3acf59d77d23eb557b959e9cc5bf506c8e14079bda9a41b1ae29f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e3b7806b8ab75063c2a86fc0587ab0f8b72e005e809aa826dedfaf28f06e05b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e3b7806b8ab75063c2a86fc0587ab0f8b72e005e809aa826dedfaf28f06e05b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e930e51a46ee8904654e66ecb4067519ca1a59577798b42e4c90f127e6a2305\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e9da2ea1fd94e7527d58658c94b684a756e4108218d97c6065a4fb74a423ccc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2e9da2ea1fd94e7527d58658c94b684a756e4108218d97c6065a4fb74a423ccc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2eed33f1f1524e302765d0504962071e21b2ca7ec2c17b5d3eb2561592bece07\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2eed33f1f1524e302765d0504962071e21b2ca7ec2c17b5d3eb2561592bece07\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2f0c506d3a98018195c0d99b51afe33369d82104f3e2cb2ba6a65bd8eb981282\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2f2c78c8c300e8d31670edc55b7a55d8263dd146a2fcc38313f5ff5072694886\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2f2c78c8c300e8d31670edc55b7a55d8263dd146a2fcc38313f5ff5072694886\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2fda819426d12459be8730c8c3e697abb81fdcdef15f74f32d704e9e646f41a8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"2fda819426d12459be8730c8c3e697abb81fdcdef15f74f32d704e9e646f41a8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3034ffa2738687797af85ab0e5f2ec1d6d38fd61babff364611567d02ae687e6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3034ffa2738687797af85ab0e5f2ec1d6d38fd61babff364611567d02ae687e6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"303cdb125293d7f4f0a5a5d2337f0e91e75d4b33a7e27fac40c74555f4ce16a1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"303cdb125293d7f4f0a5a5d2337f0e91e75d4b33a7e27fac40c74555f4ce16a1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"305f457b2309c655962d252f42efd960d7e4699ffc7dbcca637e460e98586ea6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"30a92b814fd10b4c4f9329f474de5b5806f4d5a00217216471f16bfe7f80ac7a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"30a92b814fd10b4c4f9329f474de5b5806f4d5a00217216471f16bfe7f80ac7a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"314be7b6d4574fac048e2c97eddd011e809b804da7341676f63a501bf18d2386\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"314be7b6d4574fac048e2c97eddd011e809b804da7341676f63a501bf18d2386\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"31ef92733fb5ea8b0da45258d2aaf67ff255d4f05a5bfe84e0f144dc434c6f50\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"31ef92733fb5ea8b0da45258d2aaf67ff255d4f05a5bfe84e0f144dc434c6f50\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3210f61ceccec3bde42490c267373ada61ce6ed0f7204ab76681ee966de732c1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3210f61ceccec3bde42490c267373ada61ce6ed0f7204ab76681ee966de732c1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"324dcad13a5cea1ba08cd7a27d4559b7c8f321b61d8b2e04907a7821323819c6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"324dcad13a5cea1ba08cd7a27d4559b7c8f321b61d8b2e04907a7821323819c6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3295926f48ce12a3445e3aa5412087d2a5dae4dee039add0c5a859cb6582b9f2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"32c8c2f00b864ddaf1887fc2c1029f7a562e3712d2f42022bfd209b99025d4e7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"32c8c2f00b864ddaf1887fc2c1029f7a562e3712d2f42022bfd209b99025d4e7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3302fdd27067f17c81145ebc39d84137216afe371c1c660177496293ce52a70a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3302fdd27067f17c81145ebc39d84137216afe371c1c660177496293ce52a70a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3310efe747db9bdca25ba6e6fee9233862620956ab82b5188f849fdfb9808eaf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3310efe747db9bdca25ba6e6fee9233862620956ab82b5188f849fdfb9808eaf\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3367dd22a7d180cdc7ce2ad4781b1f9350a17ed252cb030c23e944d9fd67c50e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"33a5edfe20ddcbc65653047fe029ffdff9a08656c056fe773b2128b4e7240f98\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"33a5edfe20ddcbc65653047fe029ffdff9a08656c056fe773b2128b4e7240f98\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3423753ded761fb2b353c3cca0868edb6692decfcffcfeef372b70b4b646c9b3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3423753ded761fb2b353c3cca0868edb6692decfcffcfeef372b70b4b646c9b3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3493e2d113bafcd645a3f0b2b872a44df0d16b1828fa3bf3a0ebc4d4be3fa96e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"353bc1160164eca3c00974ed637f2df3ef4d628c25d91af9f0c4e0d857053443\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"353bc1160164eca3c00974ed637f2df3ef4d628c25d91af9f0c4e0d857053443\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"353c3efbe42b4179b872e151a53687c3448e91e99e1782993de9ac6e7ac66907\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"353fd3bb12bf0912497131ece5af831f867e076e89539a2ff3324b37b025519a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"353fd3bb12bf0912497131ece5af831f867e076e89539a2ff3324b37b025519a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3551d10ff3ac0c7f7c51f81fcb20a01876778eb316986afb3fbbbf7dce0924ab\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"35758c96296b89ab39013c0c08aff917a3907e5c4b516cf088543460e6d1e0ac\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"35d3f5548b496f115b6a62a0ace40123e1f8ad9618f86710099b0eab801901fd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"35ea61ffbafdf497a9570e079e9820afb6d57bb9ad7ea4184b7378cbccc92081\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"35ea61ffbafdf497a9570e079e9820afb6d57bb9ad7ea4184b7378cbccc92081\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"35eaf70bd70e6ef92c15a2a056bd1eaff91c310f5156ac45f979fa7c30b80f3b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"35eaf70bd70e6ef92c15a2a056bd1eaff91c310f5156ac45f979fa7c30b80f3b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3728f895d1fcfbcacb98853e5aa92a2e2294817e70fe1b91f2a9e384c2333714\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3728f895d1fcfbcacb98853e5aa92a2e2294817e70fe1b91f2a9e384c2333714\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3760fdcefd3aa2c9f44541f1111fd774480a82ed5b5170a08d4fa81c42ca2727\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"37b1fae4fd0e8dd448977a9320ef20707d0d909f3e2257e8b5456ca056e513f3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"37b5e8f91004a59e577ebb3eda1f055fbb044f849b338dc51e12224b0dc3c2c4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38032efcfc820a70bd039f84fde45e3b168d78212005bcf7ea97033871981ff6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38032efcfc820a70bd039f84fde45e3b168d78212005bcf7ea97033871981ff6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38447dab6074aecf97cc464146691a2c1777b332197b9101c1eaae5d1cd297ce\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3854c928b2adb416e57d338d5cab5b4ce1a3f47497242cf5bd5df2ea55872fee\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3854c928b2adb416e57d338d5cab5b4ce1a3f47497242cf5bd5df2ea55872fee\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3888892374e263be121b40dc008ccd6f0644435632643a7f3f213195bac60887\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38a4008e0bb6bcf413bfb6a24090ba87ab845634964f5c9462f4109f23badd0a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38a4008e0bb6bcf413bfb6a24090ba87ab845634964f5c9462f4109f23badd0a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38a831395c02d661a2231e24374f7b40a7953c45200e0832dd90bb9b10950f6b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38a831395c02d661a2231e24374f7b40a7953c45200e0832dd90bb9b10950f6b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38b776da06f979925b22db7a19e9933092b5029980693a89698081daa8c55c64\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38b776da06f979925b22db7a19e9933092b5029980693a89698081daa8c55c64\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"38eb88f71c91d5e281b203a170ce46bac91b81f295de889ab7d1d9f4711cb9b1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3943bb560d531e4f988ccd47896b3c4dc47fa740cd34fa694a4798c6127f47b8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"396171b3f42e100fa29a303efb7abf82312384a4e7ee2e51a55b49033f224321\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"396171b3f42e100fa29a303efb7abf82312384a4e7ee2e51a55b49033f224321\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"39762718a9ed6cc48266a48ccb1b0075efcb086487c403deb484e8288fe9652f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"39b68a2c6b67bc5cca12c43a58070fab7c847852e2bd95370afddccec567bef7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"39b68a2c6b67bc5cca12c43a58070fab7c847852e2bd95370afddccec567bef7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3a27e02a5ed7f9104e08846364eec0254f925d621751fd18f5105eac8ecfc544\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3a27e02a5ed7f9104e08846364eec0254f925d621751fd18f5105eac8ecfc544\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3a59c0a7b99030389f13d844554612e4fa0d7c0f6768a2339569708ea7a76475\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3a85be3170d1505cc7fd4be1f5302e851b5d0a025d87a2367f66a1aa3df0754a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3a85be3170d1505cc7fd4be1f5302e851b5d0a025d87a2367f66a1aa3df0754a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3b457d2ef1d9529af63b4bd2612f0faa64914b0e51d7a062e72dc26f549b1d59\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3b55c35db1961e338a837327f3e959798bfd43146c69a4b61d0b8cc24f7c726d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3b55c35db1961e338a837327f3e959798bfd43146c69a4b61d0b8cc24f7c726d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3b6400e3a8d72b71a9494c8f24a26c4c7644d3828ff6d38c9589fed135b1f9de\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3b9c7a4fc9eb0cefd3f40be45b8054884d86da1a4358bae15133015a4967ad3b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3ba707c1910ae8b86818170baf7306b861c58c6d0cfdc70af7a5e2efd6f5049a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3ba707c1910ae8b86818170baf7306b861c58c6d0cfdc70af7a5e2efd6f5049a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3baf760020881cc9ed516ec8928f47d241bf075fcb9d0706c15eab79ecf88830\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3bb4751e54c38a3cca9522ed49341d95b29bb9d8a3aaea7284940fbdf6ecc4e9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3bb4751e54c38a3cca9522ed49341d95b29bb9d8a3aaea7284940fbdf6ecc4e9\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3bcccff7cb1894be9a37ebd93f784cf0efbbc939ed86191033a391eb7088d6a1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3bcccff7cb1894be9a37ebd93f784cf0efbbc939ed86191033a391eb7088d6a1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3c5d1c9091c8112b121b53fbc8947b6b357241d49667c43ecaa615acc880ea47\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3c606b6c26dad2d55986604e70b37bd27e4815f757fbb4c92aa03036a7d5a006\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3c606b6c26dad2d55986604e70b37bd27e4815f757fbb4c92aa03036a7d5a006\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3d5dae6644616f0afb4c17cad8623d9a242f3cd14380121350686006547fc9a2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3d9a3b3e0c90b349644585c3ec06e41b034da7bcff7245d079ef05fb513cdefd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3db7dbcedb913c41237515b2c1abe0e69f09e36d33c6c91ea11d2cbe1bc47c05\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3db7dbcedb913c41237515b2c1abe0e69f09e36d33c6c91ea11d2cbe1bc47c05\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3df0e0b627247ced549498b67b3525d49d420a97130180980d92cadeec4658f5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3df0e0b627247ced549498b67b3525d49d420a97130180980d92cadeec4658f5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3e64214b169f6164918ac96da7c2f17599981410993ef2b36b1015453870754f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3ed15809c9819ab996f1a1740bd132b127b0bec4e94f3ca0fff606cda3282b15\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3ed15809c9819ab996f1a1740bd132b127b0bec4e94f3ca0fff606cda3282b15\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3ed3db178be348fb83ea2a96ced5453460bf35522d78c8c0fb3bff77ff4111af\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3ed3db178be348fb83ea2a96ced5453460bf35522d78c8c0fb3bff77ff4111af\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3f4da8b86ac4f1086d7abdba738c821d6b05cc4c4abe5fe941444f6bb6a10f1c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3f532b62dc44d542930549dd53c060ae0d5b81510ceb5325b49ef06eb7277a2a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3f532b62dc44d542930549dd53c060ae0d5b81510ceb5325b49ef06eb7277a2a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3f79af6fd74215200acf22b7fe22071dc14315fd3efed71b976694f4efffc211\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3fb7ec8cc84adfb889da2972c2fc3ac3107053f312dc6734d987b108ff0a11c1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3fe5c9c0df766f5c92051431051022dbbbf7c1f06783f992429ba79214e2c36c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"3fe5c9c0df766f5c92051431051022dbbbf7c1f06783f992429ba79214e2c36c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"405f1a268a38ed898618cc3e693192e100bcf59953f931bf80c9c0494ccfefa4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"405f1a268a38ed898618cc3e693192e100bcf59953f931bf80c9c0494ccfefa4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"40e83b8e2320fa89b560f42f276374c4431b9f4de625491627e06ef1c813cbfd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"40e83b8e2320fa89b560f42f276374c4431b9f4de625491627e06ef1c813cbfd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"40f01268e852fa9479c851a4ad35b73c3ea9c5fd5c874f888b1808121eaaab8e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"40fdf22559523786d6d90bb20699f70c45f7ba26c97729a47ad33eb713d56211\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"41e08e8641f1ba803b41402902b2606ca158b467f509aca2bbb674b3c70c7715\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"41e08e8641f1ba803b41402902b2606ca158b467f509aca2bbb674b3c70c7715\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"42100de8a02827d7fbddb1dca908ae31b25ddce07b74640e03ce5adacfc84b9a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"42100de8a02827d7fbddb1dca908ae31b25ddce07b74640e03ce5adacfc84b9a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4246278f8f01e48fdb85be9d6b3ef7851385fd40cd135bfff18267f38f276aac\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"425ab0bd4390e9eb23a511c2b7869d3af9d2b6ea6415516caa8dee78f7c2e682\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"425ab0bd4390e9eb23a511c2b7869d3af9d2b6ea6415516caa8dee78f7c2e682\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"42c5caf2a895ba6292be46abce93e6f0e960bca696e0a7f47eaf47961cea0e2e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"42c5caf2a895ba6292be46abce93e6f0e960bca696e0a7f47eaf47961cea0e2e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"42ccf80d5b9e0a8e900131bd39b623d7539a61015c4ec18c5adfda0e8cc19db3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"42fed751a1878f27c8616e6a19e43a79ba824184f2ac9f4027d2b2204277196c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"42fed751a1878f27c8616e6a19e43a79ba824184f2ac9f4027d2b2204277196c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"434a02d607e4c2fc7420e3eb7e5d16fb68c871a7c3d7d1240d297ed9e363170a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"435ab9860930a11eeef78e347bc1c39c66b4fa3fabffba7634c894014a77cc4f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"435ab9860930a11eeef78e347bc1c39c66b4fa3fabffba7634c894014a77cc4f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"439759d0e722f730c30fac7983a5e642cafe1343c828ca4248a0d07107d8a0f4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"439759d0e722f730c30fac7983a5e642cafe1343c828ca4248a0d07107d8a0f4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43e50cad7097eb57b3e672fb46dc11215d99ded634fb29abf65068e30919366c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43e50cad7097eb57b3e672fb46dc11215d99ded634fb29abf65068e30919366c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43ea5c5a5edee112288db368bba3df4d4faff593145ffb28acf94efe8015d258\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43ea5c5a5edee112288db368bba3df4d4faff593145ffb28acf94efe8015d258\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43f66ff2029169dc5e00cd8e54cf53f688b69fda8c741f5021d2ea93aaa5992e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43f66ff2029169dc5e00cd8e54cf53f688b69fda8c741f5021d2ea93aaa5992e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43feb89bf957b2eff5654fd1f1e9f9b72ee48be70d1f16dd0da4d9b6bde02d7f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"43feb89bf957b2eff5654fd1f1e9f9b72ee48be70d1f16dd0da4d9b6bde02d7f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"44068ba68efeef1a6605b5ea100feb523733c757b8243b42b874ea4ee9b9d569\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4433b96cfeee3e2c0984b3dc342fe342ec3a9481deca3c52b69e661a1a5bfc9a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4433b96cfeee3e2c0984b3dc342fe342ec3a9481deca3c52b69e661a1a5bfc9a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4452bfde6b20f68e5a4d2ded55f69d200d21608e965662268a8ce745002d282a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4452bfde6b20f68e5a4d2ded55f69d200d21608e965662268a8ce745002d282a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"44e5bdf9e8ef7f8c6f21a161e2a34e21ab50cc383d97ba894e3c0d169bd9f45e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"44e5bdf9e8ef7f8c6f21a161e2a34e21ab50cc383d97ba894e3c0d169bd9f45e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"44e75cd3d95ef4719f318ba9d5af0a636c2d28dbe9e1c4fba0a842a894627de5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"44e75cd3d95ef4719f318ba9d5af0a636c2d28dbe9e1c4fba0a842a894627de5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"45625bbc31e6055a3d7ac9109c415245566be8b7f02e30e6db275183280bda22\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"45625bbc31e6055a3d7ac9109c415245566be8b7f02e30e6db275183280bda22\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"469f132fc523fa6840967a9a7ec7b794cca5fea7f368c7c50552b68c556bf7e5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"469f132fc523fa6840967a9a7ec7b794cca5fea7f368c7c50552b68c556bf7e5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"46e6e427d397c1c3e85791c91848aa2e814cb1bc982df40107d863be8ef15672\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"47893a8ba11a2e958c1809525f366afa07f6ebc35b1a88b25410c8dabda2a3b4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"47d200757556febf055f8caf9f3f1f36fcb7a64c9ef2fb5096b8850a0ed422d7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"47d200757556febf055f8caf9f3f1f36fcb7a64c9ef2fb5096b8850a0ed422d7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"47ee069817a05be7694448834b51485d94c59b211b0a78a5960bcf4fb63cb784\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"48176cb0c7ee5e8eb8bdc4ed0fc7099421d24b1bdefda228004360da0c7e2128\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"48176cb0c7ee5e8eb8bdc4ed0fc7099421d24b1bdefda228004360da0c7e2128\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"481f5c7a55e1c54ded35e61fe71c21d72ab0df0f1a303bd8876f35370671ddfd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"481f5c7a55e1c54ded35e61fe71c21d72ab0df0f1a303bd8876f35370671ddfd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"483f4fbc09217bbce226e49bd499fff71a04f51caacad559421766ff14022cef\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4841ba39c65183a86bbed010b79fba504f59dda4bb531b6c2d7aabaaa9de2f3a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4841ba39c65183a86bbed010b79fba504f59dda4bb531b6c2d7aabaaa9de2f3a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4848331591cadc3f7652c1191232c01264412dd0b3239ac62a7605655201ee38\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"485039c53471026b90a334a6949e8cb8b62d39586219a2f1533f0b274c0a58db\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"491b5a5fffc4aab3546c0b65cad05052fbe2817ea7ad556446315bc6ab74934f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4a91fb0549f50ce6cb23c366b7126d9ca2861ddcd45f479e5b49d3fff36ed3c4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4ac3621ab50aebcb2943e031ab798f482769f762c586e3cddd3c1342924c2e0c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4ac3621ab50aebcb2943e031ab798f482769f762c586e3cddd3c1342924c2e0c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4ae3bf1ac3ece330a2559ba0f3ffe8649a3833e8ea0c1929f861674535a3579a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4b220399906ac10d91e771e47061b5f9e2808dde07873a014fe8da47a219b923\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4b220399906ac10d91e771e47061b5f9e2808dde07873a014fe8da47a219b923\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4c19502fdeb8f9c2b9b2237ec12156b3a351a707dc923e705775a2387ade4ceb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4c4c05d8f1088ba48aeefd97f5c099e11809f5bf7a4be38b62acb4bbcbe508b6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4c4c05d8f1088ba48aeefd97f5c099e11809f5bf7a4be38b62acb4bbcbe508b6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4cb11b9b413941012ebd193225bdef7f6d274069a0086ef3586293dfe801aca2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4cddca53263879d2b1e702050c50198b860642b72d83d93a83868d513684cd2e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4cddca53263879d2b1e702050c50198b860642b72d83d93a83868d513684cd2e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4cfbf7c1eb054602fcd3179383e0bc2c68a7645b5f686d29afb24f9205aae581\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4d69dee6979eedd85e8982925c0bb97205a1d59f25187a358110d2b0972ff19d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4d69dee6979eedd85e8982925c0bb97205a1d59f25187a358110d2b0972ff19d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4d849a2595a6b48794b6df37c338b570a439b21add6add10bb2a76f26172ee16\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4d849a2595a6b48794b6df37c338b570a439b21add6add10bb2a76f26172ee16\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4da77f6330ff9d4d7a2fc80721c82ff67ed0ac858626417c4729add2491fddb2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4dc3341e77b4c6e87c99b0b0a90f1e0a5179eb5daf0f317f2e2436b1e892e8dd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4dc3341e77b4c6e87c99b0b0a90f1e0a5179eb5daf0f317f2e2436b1e892e8dd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4dc779bdabfcbb4225f65ddef8c58da74e689ecc38490c2ee775880710793eef\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e10a192f2753953b93ab702fdd0ba4a3d5e0241ca45f7ba23c5f2d3fbc7d407\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e3087f36b432f2df21d385142d78e7cc79132d73294e2834ab68665d755683b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e3087f36b432f2df21d385142d78e7cc79132d73294e2834ab68665d755683b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e375ae141842eab3e18b5e08f3226fa07d24eed680328cf8f1a11632937589f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e375ae141842eab3e18b5e08f3226fa07d24eed680328cf8f1a11632937589f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e7a54153e334d72a4eaa9c945488e560d92849bae16d1430e069d2b9d981049\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e8e6a38d5ac76f8c213b42fcf89c8eb96aaace9341e5bebe4ade79e651bba35\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e8e6a38d5ac76f8c213b42fcf89c8eb96aaace9341e5bebe4ade79e651bba35\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4e977ce4e374a81a5973aaa2ac423cd25d9b2289e4b30190ae87404b832e8b8f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4f22ff85f0ed6509d179af63d38cfd0dfb1b5505194b8e8ffd9e60802be5e03b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4f22ff85f0ed6509d179af63d38cfd0dfb1b5505194b8e8ffd9e60802be5e03b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4f7c10e21d1884f5aca7d559baf24c18321ca7d9eb160fb029d5fe515dc7c1a3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4f7c10e21d1884f5aca7d559baf24c18321ca7d9eb160fb029d5fe515dc7c1a3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4fb601b049196af7f1638c7103db4a2ed67cf12fe9bd2933d230f44356b5ab08\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4fff0840c662b1d70e17fcc1cc1577bdf29733d5c79b7206cd96a6146eb764bb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"4fff0840c662b1d70e17fcc1cc1577bdf29733d5c79b7206cd96a6146eb764bb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5041a7f4ea272edea8de7ab3d734681a529715c7b9fef656f848e6fe58e05d1a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5041a7f4ea272edea8de7ab3d734681a529715c7b9fef656f848e6fe58e05d1a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50642d6ff4b7d3755972d0e3bf6f9f2d30592a7dddc215d23965fa7ecb2a8f82\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50882812dbb6483045e03667309e308541c7560061ebc961f37a34a94e93a3a3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"508d49cac08f9bba48d86f15a2a6bf5480bf6abc66064828b5f13a03692101d7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"508d49cac08f9bba48d86f15a2a6bf5480bf6abc66064828b5f13a03692101d7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50ab1335d959dfa6e1a9ed3735b00b88db138e1daa8a4dc302fe506124dfc59b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50ab1335d959dfa6e1a9ed3735b00b88db138e1daa8a4dc302fe506124dfc59b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50d30175c01d5c3d69d29e640762cd3960d153066791b996ddb80b69bc9b4d3a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50d30175c01d5c3d69d29e640762cd3960d153066791b996ddb80b69bc9b4d3a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50dbbb8df930eabb2434858590c9e6c668bdee04b1f172ce094fb39d1c67653f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"50dbbb8df930eabb2434858590c9e6c668bdee04b1f172ce094fb39d1c67653f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"517450cb537fb08fb40e049019d9fcbe94f29a2a0561a70bb2e47eb8de672b76\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"517450cb537fb08fb40e049019d9fcbe94f29a2a0561a70bb2e47eb8de672b76\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"51b1a748f04661a80be181b8ebda97066a89bd7a898454caf0ddc227cf5c56a9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"51b1a748f04661a80be181b8ebda97066a89bd7a898454caf0ddc227cf5c56a9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"51f4c79ba77bb02d2c6dadf47b70b1a182113e47b3ee66bbbfd65c783fdc4427\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"51f4c79ba77bb02d2c6dadf47b70b1a182113e47b3ee66bbbfd65c783fdc4427\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5228184ac758345b49495d93d612e21408577ff2cb2f855b7789baceefdfd559\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5228184ac758345b49495d93d612e21408577ff2cb2f855b7789baceefdfd559\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5240857ececcfdbc1ebd19cd6591318461359bab81977a2188d767dfbe1f40dd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5276b4d90ee0fe88cf81bd6a10225726b6e216a963fd4cd2921d35f155e754d6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"52813e1bee7625edded6d0762d102cb7821053ef8d6e5116f8873151d68f5e15\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"52813e1bee7625edded6d0762d102cb7821053ef8d6e5116f8873151d68f5e15\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"529b6a26bf4be72ef946ce455e49e0a5a799da19e18e662b8972239085935004\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"529b6a26bf4be72ef946ce455e49e0a5a799da19e18e662b8972239085935004\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"52a1e12eebf5d75f444f86dd79661b0ea2be081a86f1c9d592c5addadd3fc640\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"52a1e12eebf5d75f444f86dd79661b0ea2be081a86f1c9d592c5addadd3fc640\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5342c66da4f5e2815988997c9e9d1eb352ee56e879817a3d886ae26dacc0aa72\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"53506911b957884d191b5a3250fca9ebf1dc5d2851b4d833da32c3813669b405\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5361cd5119cfacf86a9533eacf70bb996770ba074708f271794a1f2a1cfcfdbe\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"537be66a0ec501e3ffbbd0bf0828bebb54b71e840454806e40818726cfca41d4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"537be66a0ec501e3ffbbd0bf0828bebb54b71e840454806e40818726cfca41d4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"53f4d04f29f282102441232ab92ac7170bb1ac432553f5be780beda06e142bff\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"542e2fb5cae3e7054dec931bd0309d54e633a508f78c89115c8aaf43094998a8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"545a1424626a8a44bfeffa80a71534a1ccf6849514f8e97487e9d017ba22db75\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"54612b75bea0281037758f008837567344ed2351d147849b4e724146092047c5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"54612b75bea0281037758f008837567344ed2351d147849b4e724146092047c5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"546311dbb2579bf0560f2daed29fc2b8340731b18ab7bf0547523c00d9d179c5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"546311dbb2579bf0560f2daed29fc2b8340731b18ab7bf0547523c00d9d179c5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5540c32978054ad9fa7a96c87c1b9e7aa78526274645031899022b04acfa6af2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5540c32978054ad9fa7a96c87c1b9e7aa78526274645031899022b04acfa6af2\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"55a30705d650b26b786298f0c2d28b88ebcb8186e62b964fcf7a090fae88a43b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"55a30705d650b26b786298f0c2d28b88ebcb8186e62b964fcf7a090fae88a43b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"55a8378207a9782f4dc9989c0f7c5c11f84c5d712ebd0aee23263179aab60adb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"55a8378207a9782f4dc9989c0f7c5c11f84c5d712ebd0aee23263179aab60adb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"55e8cfc66a6ec21831f53b33217ada8b53ddfc1db8056284c74599107271901b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"55e8cfc66a6ec21831f53b33217ada8b53ddfc1db8056284c74599107271901b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5608cd60edf5a8f4ead8e4f50ce223f8deb891e4ef1e149fc46948054d5bed7a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5651039f94ac9a496efa5eedab605b757a174b9aafdf64f2f8b35bea71bbe7b6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5651039f94ac9a496efa5eedab605b757a174b9aafdf64f2f8b35bea71bbe7b6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"567c924692cf4d82b9022f1c30fb05402c6c96ac2789ca295886b99b781c796b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"567c924692cf4d82b9022f1c30fb05402c6c96ac2789ca295886b99b781c796b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"569dfce553adf9b50fb2d1ba24743ce084e5ffd7ce6340511b9dba1619328080\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"56ffe6bd02b018a997eefb09928d133027059b43e1524242a6cc334a53436db6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"570339ab5f2ca985468c03ec2693c2e23177bde7f6d8094894deb98c36244aa7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"570339ab5f2ca985468c03ec2693c2e23177bde7f6d8094894deb98c36244aa7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"571104d5e24e59875a40f6c6c8d516d7e95eb0c542bb825e746bd03a8958e3ac\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"571104d5e24e59875a40f6c6c8d516d7e95eb0c542bb825e746bd03a8958e3ac\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"573ecad79bd034468108c4ac0be233418b0d77bb33dc455496b31a0f97917b7d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"573ecad79bd034468108c4ac0be233418b0d77bb33dc455496b31a0f97917b7d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"574a32dcbb5560d3f37ace8b77f556a26c4d954c8ad7cc6559c64a546bf89aa3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"57c24941680a641c431ac0f539210f0f51b0ef51a2969f7ad7da9a0e77268a41\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"57d568a775ef279d37322a5c4ae260c9cee6d938445db5f4c07f7888a4ff561b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"582bd6c31f994bd845215040714329bfe78fe308ceb198730f89713971db3f91\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"582bd6c31f994bd845215040714329bfe78fe308ceb198730f89713971db3f91\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"584079d79b64b16b7012160e0c03dfe5879fa42618d8b4e65d34c11b4427f036\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"584079d79b64b16b7012160e0c03dfe5879fa42618d8b4e65d34c11b4427f036\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5854bbf06906dbf0dfb31f9bd8a119d759272b68e37c823c6fdd367ee19c8d5d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"585ba50393aec105273057517e361b7946ba626af7674e5829f83bad80c3438e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"585f5b22c89a42a3bd38ae8fc4c77759e7ac091c04dccb953ab30da1dfc69a82\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"58be9b9fe0487283f7fbf3c284da12e784ff43f9e0d1f8ea9c8c3bd12f8847b2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"593ae31619f3b83573aa4f978d6fe685306b708e2a2aa9f9e23c416fd0d30c01\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"593ae31619f3b83573aa4f978d6fe685306b708e2a2aa9f9e23c416fd0d30c01\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"59b03d13ab92475ab541104ef6a0e1432feacbe6497d57c352f69897f33ad510\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"59b03d13ab92475ab541104ef6a0e1432feacbe6497d57c352f69897f33ad510\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5a1e993558a51a9c2aff820d542c6d980b83d4db7e13a148a32ff507f382870b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5a1e993558a51a9c2aff820d542c6d980b83d4db7e13a148a32ff507f382870b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5a33e2d61b4e284e81e30b7737a6f98be6399cd9ad42f00fe6698a0d18b315ec\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5a4867cf77c11836c8ca55de9aaf2c90b6692b89c85c3f5e5c12f264df824a5e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5a4867cf77c11836c8ca55de9aaf2c90b6692b89c85c3f5e5c12f264df824a5e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5a4f5d25e4f1422b7945432d38bda3ed1a8879b1a77f68dca0b3eb1c5ba1d413\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5a4f5d25e4f1422b7945432d38bda3ed1a8879b1a77f68dca0b3eb1c5ba1d413\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5aac64cdcdf10d96ea74881408c1f8c9047e5509b46bf56235929d03d2499d20\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5aac64cdcdf10d96ea74881408c1f8c9047e5509b46bf56235929d03d2499d20\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5ac9cb846292705dd5bdf21d8eed87e906f5c7b6b808d38eb64145bd50e2560a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5afee9e834a8155e073033fcecd79632bc57bb11d268fa7e4bbbde86e2806f3f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5b3427239eeaf56f7c962ca752a4fee083e58f33c9f44e0a8ed1a95f0badd0f6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5b3e3f38abb481d8281fee5edeca88dc225de9f51f562f02d41798bc0db62c89\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5b3e3f38abb481d8281fee5edeca88dc225de9f51f562f02d41798bc0db62c89\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5bb58db2b176e4fb7b499e3746f15dcffb847303e1f455ccc56e83148750bc7b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5c491c16fdaad031a1217cfc4252298e8bd7fa96a08dbc6507bbef3846ceda2b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5c491c16fdaad031a1217cfc4252298e8bd7fa96a08dbc6507bbef3846ceda2b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5d5ebdddbf76a652265050383e6c7a613b1ce41a0e50d1cd6aae55dfd3c950b4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5d85f853a5e817c96725345900b80984af463be8f052bbe982e84ba5a50f0c7e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5db3d4cd885c2b28cf68bd7c32309f5281111842722333ed4cf6ecfbe7c000fd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5f3731d419c42e2be8f561fbbebead2ed9b66c5f413d399688b5e09164f9d377\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5f801292e023ed5f0705267498e289881e97371676dd06d695e05adf69adff33\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5fcbb13db805876800d2a23199a48cb675387bf1e4d8c52e3d1aab4f6e511a0c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5fcbb13db805876800d2a23199a48cb675387bf1e4d8c52e3d1aab4f6e511a0c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5fd9ca4b9a4fad91713046520ea53d45a63abb01731e29b763026ee19ae5c38d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5fd9ca4b9a4fad91713046520ea53d45a63abb01731e29b763026ee19ae5c38d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5ffea7afa62cf8c69597ad8a75b9c61fc188432800b52b1c43c4d02fd0fd0f0f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"5ffea7afa62cf8c69597ad8a75b9c61fc188432800b52b1c43c4d02fd0fd0f0f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6061c3730066be56959952afab7b99a6216a0f7322d51cde70e2a30c007ef67c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"608714b28727941bba1c55231a3c285103bc7292104f4331bae8d2773dd88f4b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"608714b28727941bba1c55231a3c285103bc7292104f4331bae8d2773dd88f4b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"610af482b729b031cd82a9926a8cf28c61388cbed07112a7eb329c7465ca217a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"611ac48a86e3b3f0cdaa6d5ea173d7525bdd3dfa6ff743760cf52948e41998a9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"615fb586cd822be3ef426fdcb05cc5b32adcc3544d213f731310e532a9290bda\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6183a2611361c3a66d5bd1b14cc0123fb34825bd9693e7335abfea3a03b9e866\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6183a2611361c3a66d5bd1b14cc0123fb34825bd9693e7335abfea3a03b9e866\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6216b98bbc54eb3a08052cba9e0c79ba61eb9dc309881c0267fc0702b1ae1915\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6216b98bbc54eb3a08052cba9e0c79ba61eb9dc309881c0267fc0702b1ae1915\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"62bde2a6c8c26ddd795450a6bea76923b70b5a4bb647610bea5ac7f2059463e0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"62bde2a6c8c26ddd795450a6bea76923b70b5a4bb647610bea5ac7f2059463e0\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"630f774d6dbd622386ca98be314959563ccba07b90bbb285c8eb0fcaf7817b65\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"632c060a82be441a339bcd671468c63ec6498b46bbe589b31985d291ae92e397\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"636b44b9408a667f06885d3150e9c6f41ef1f973d3c151564fcfb2f38b3316f8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"63a8fbbb623064265d84f1567500aef8a0233a0797cd09cefd8c2914a499334f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"63a9619c62d77632c577a7936be5be2f4db9fb970a9301920b5bea3ec154e0a5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"63ec73d20eca16117b5cf831e61939be71c4df794f8a78bd47bc9ac2c588c815\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"64ab1a87c00292c80c265847e29128ad5ac695b06c1cb7b05871e18b8eaefafc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"64ab1a87c00292c80c265847e29128ad5ac695b06c1cb7b05871e18b8eaefafc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6512f784abacb9a7e65a9e0289d24ad8b699f6075b18f68d8c1559adc0343a0c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6512f784abacb9a7e65a9e0289d24ad8b699f6075b18f68d8c1559adc0343a0c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"65208ba1183e8900dd553e8798884662d789c15c793fbb9d154d5f46c07eec08\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"65208ba1183e8900dd553e8798884662d789c15c793fbb9d154d5f46c07eec08\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"652e644f0428dd0e0448eaeefd6b4b33fe65d43c3f4ae8f36e363c0d25e42e7c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"652e885b739a914d64bba6b4fd4a42b0398983c5a1e578d52ce6b4ebec84b51c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"652e885b739a914d64bba6b4fd4a42b0398983c5a1e578d52ce6b4ebec84b51c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"65901aac5b76337c1a39e1489d040b93a4d3a49373ced6c6524cd61d69dd2877\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"65901aac5b76337c1a39e1489d040b93a4d3a49373ced6c6524cd61d69dd2877\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6637bf10326df2b05eed0ef1ff96147574c2f9f20d6ebc5664bf65a3de3c6654\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"66613cf7746aa26577019a96ab35dfb0d15a593188c9a4a517cf815fb0752ed2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"66613cf7746aa26577019a96ab35dfb0d15a593188c9a4a517cf815fb0752ed2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6664a1611fac6bbd921d40da4be788f3fd6ab7af6ab48f03594f52022c810a74\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6664a1611fac6bbd921d40da4be788f3fd6ab7af6ab48f03594f52022c810a74\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"66811c923a7a8a16672d663507fd61f66962ebc64e2bd33955c9749751ae36c9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"66a22776a87aba2796ddb34e71a64cca2d27ca9f83cd2a5ebf40e1d5f391c4d6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"67057f1e20dcf3d804408fae0807109c7270d7d3ef53e0482007058da67c7f5b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"67057f1e20dcf3d804408fae0807109c7270d7d3ef53e0482007058da67c7f5b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6722c37c865bdd8219c74eed434504e9c8cc20c324eccd809fbf038f56ec7b6f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"672f48a29149c12ec613a55dd714fc3b9ffc08a1d3a503d97e8f51caed3d17e3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"672f48a29149c12ec613a55dd714fc3b9ffc08a1d3a503d97e8f51caed3d17e3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"67371af05b63a2867b068f7f9137c9b5ecf7faff1a62333ac09d733fd4e7f5d1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"67371af05b63a2867b068f7f9137c9b5ecf7faff1a62333ac09d733fd4e7f5d1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"679c42133f006600be6c1d5ff941abdb3237e5c0dca61db2acbc933f3d81c562\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"67c0f1837506419f823febab55479c267ff460668246c916bd8de5bd6fb103b6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6837b82c53dc6a70bef2b8226295fd58fc2a9f5d73b4509843ff493f84d90ff9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6837b82c53dc6a70bef2b8226295fd58fc2a9f5d73b4509843ff493f84d90ff9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"684f636d61329dadeddc41188b68e03a5b2eb9df29ce2b5a0a869106140d3fe1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"684f636d61329dadeddc41188b68e03a5b2eb9df29ce2b5a0a869106140d3fe1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"687da84d0fb5f9990cfc3cb692fd21cdf9963a6414fcdf03a4f42a0fc5287703\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6896aad77d808edcee14d2999cf1024b9d7076e234302f86f40e388d6e3a1131\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6896aad77d808edcee14d2999cf1024b9d7076e234302f86f40e388d6e3a1131\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"68a4bcc0d11cbfd9bfa099585e2b2243a125156654fefb836743e76b2a1cb83f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"68a4bcc0d11cbfd9bfa099585e2b2243a125156654fefb836743e76b2a1cb83f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"68f0ef9b2945ff55a341691618a780a02d2f9604f1edf010fcb6679b831577db\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"68f0ef9b2945ff55a341691618a780a02d2f9604f1edf010fcb6679b831577db\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"691f6578158f99655720073b4e68a4ae89718e793df1d6609bce76da09c90df3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"691f6578158f99655720073b4e68a4ae89718e793df1d6609bce76da09c90df3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"692b9a63a3fb0a0e5c0ad47e6f722c74bade8369451b12fc686375ab06f40cc5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"692b9a63a3fb0a0e5c0ad47e6f722c74bade8369451b12fc686375ab06f40cc5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"692e1d1ba0486db815c8fddf8fed85d4ea600259dc81d3229772fe57a85317a7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"692e1d1ba0486db815c8fddf8fed85d4ea600259dc81d3229772fe57a85317a7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6968d05d597f83425c9eb8c9427df5ce95d933089198f04eb6b24a0e3e7edaae\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6968d05d597f83425c9eb8c9427df5ce95d933089198f04eb6b24a0e3e7edaae\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6a4d689d480e2a2310a53e87dc7d0a0adb327bd34dbb06f46a85ea82ffa9b336\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6a4d689d480e2a2310a53e87dc7d0a0adb327bd34dbb06f46a85ea82ffa9b336\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6af9f6d34fd89ee0a87ecda011c4eaebcb1c78798604d65b4e57106f2ac165e3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6af9f6d34fd89ee0a87ecda011c4eaebcb1c78798604d65b4e57106f2ac165e3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6b37c84b18d7ae48cb9b4774ac7ecd25a0bbf87a98c02341ba482b9293379ae3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6b532339b025eba1831f5319e1384dd56d8491aa3708ec83eda3acc166d0796d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6b532339b025eba1831f5319e1384dd56d8491aa3708ec83eda3acc166d0796d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6b95665dd506bda092c19691a5cc87f4e753de32c997cd4409f218fd64c3298c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6b95665dd506bda092c19691a5cc87f4e753de32c997cd4409f218fd64c3298c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6bd6034d5e222fa4af3cbd8587b05e018edae111a3585ffe0eeb2f0ee1dac669\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6bd856f458896f35a369d08326f1ce87108da375eea930c13cfb6fed6284f0c8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6bd856f458896f35a369d08326f1ce87108da375eea930c13cfb6fed6284f0c8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6bdf9741511cf965136096e88b9606c799249d59de9d711814d5ae645676ae00\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6bdf9741511cf965136096e88b9606c799249d59de9d711814d5ae645676ae00\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6be1dec83b4c2ff4a0f9a62983fbcd6e7e78e1993c9ed6e77fec7fa8e227f65d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6be1dec83b4c2ff4a0f9a62983fbcd6e7e78e1993c9ed6e77fec7fa8e227f65d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6cd971e3c5d9b41730ba29f25f1a64c5544ce8302550688a3c890ebcd62c8afa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6cd971e3c5d9b41730ba29f25f1a64c5544ce8302550688a3c890ebcd62c8afa\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6cf06800ecf05cfe0c2b30f7332c0f5759106951ba418935a62ba1667669891b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6cf06800ecf05cfe0c2b30f7332c0f5759106951ba418935a62ba1667669891b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6d18d0129196db41ac9bd4bfa133be6df87869b1d9335219a751ae35a9f805cf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6d18d0129196db41ac9bd4bfa133be6df87869b1d9335219a751ae35a9f805cf\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6ea93292703185c9a7bd6aa08a5ae909c6ca316441a356426fef1d53fd18bf07\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6eadffe19c6765d6ceaf3699dcdadb6a032eedd3678f79555aed2255751a86cf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6eadffe19c6765d6ceaf3699dcdadb6a032eedd3678f79555aed2255751a86cf\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6ec9aa04ef693737a7ceb5681791db07b8f40b93a5ca10c1867eb71ac8242878\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6ec9aa04ef693737a7ceb5681791db07b8f40b93a5ca10c1867eb71ac8242878\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6ecb01e9960aaa6101a8da56dc25f87beb4f1fa945ca5f4cf5245e710ded845c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6ecb01e9960aaa6101a8da56dc25f87beb4f1fa945ca5f4cf5245e710ded845c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6ecc45242878169fd1c9bfbc199f5c5c53f5c2c6daae99dbe0395a1f5ef70d3b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6f649b96cab5b1e6e117c3072d5aac8ed27742deef527ec6c898135ad354da81\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6f649b96cab5b1e6e117c3072d5aac8ed27742deef527ec6c898135ad354da81\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6f6d4686822e9ceb7618c9e347f7869699faedfab2eeab01abb978bb429cf868\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"6fc05c15e0da3aced31e5bcf5c8a37504e19ca84575384c15aa23dad8d4f864b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"702a6cb8e2109cb40c69fb83e9dcc4a929ea47682ebccf0845c48dbee35cf6b3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"702de787b5251cb0981e5276e509302afa4a96259529aaf8f18536caf7d490be\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"708a02402e6ad00548ffcbf4b50777f73863a61f3781371c105823fb5f312e81\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"708a02402e6ad00548ffcbf4b50777f73863a61f3781371c105823fb5f312e81\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7105ee48abbcdf5c344976c5215babdaa6b4f39324ac5b85dfeec01e6d7742c0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7105ee48abbcdf5c344976c5215babdaa6b4f39324ac5b85dfeec01e6d7742c0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"719278b368e3aaa1e714d35f06a34d52c227ce2ffd92aa6cbba485ecd16e99a3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"719278b368e3aaa1e714d35f06a34d52c227ce2ffd92aa6cbba485ecd16e99a3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"71978ddfcb8190632b260cbbd2001f8160fc1be8fc2d91cce30759636b88daa8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"71df05ace2283a3add7767b37072f7be070b21068243b288f5f6f82f6c81b45c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"71df05ace2283a3add7767b37072f7be070b21068243b288f5f6f82f6c81b45c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"72fbc333a43cabac8796a0d447ccfa960ede098d3c954e865e53d8146da1a99f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"72fbc333a43cabac8796a0d447ccfa960ede098d3c954e865e53d8146da1a99f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"73b0bebcaa46a0bcdf134390b405925f9092afc82a62c744502e628ab773b30d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"73b0bebcaa46a0bcdf134390b405925f9092afc82a62c744502e628ab773b30d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"73bbafc7cdd484672a47dc142696c7d57ebe15f7a68f8809c14bc5f33eac31af\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"73f0180ef587718635e0d81a54e7ae7af5827ebf3d6691f5744a128d3879b93a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"74029b878f32196e774053bb081e233ef1ecc4c27b558952e858e0221b64881b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7412d9706651766616e576c6391cb2e4a3146de3aee27ef849b3c455ad1caa63\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7412d9706651766616e576c6391cb2e4a3146de3aee27ef849b3c455ad1caa63\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7478a7bfd7df747db30c2b2df75a67b44fa8cb80cd196174dbe00b1b58346e54\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7478a7bfd7df747db30c2b2df75a67b44fa8cb80cd196174dbe00b1b58346e54\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"750accc52c659986e304cb87f95d4f63a39da24544980b43a9184eb9d9bd5255\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"750accc52c659986e304cb87f95d4f63a39da24544980b43a9184eb9d9bd5255\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7537bf02ea43559f17d191011679d6dc210169b7f269f5f702940548ba718b1b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7537bf02ea43559f17d191011679d6dc210169b7f269f5f702940548ba718b1b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"75d313b10840414efa36df21d4f961114be6a8c74953a7f4fcc3241d11220920\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"75d313b10840414efa36df21d4f961114be6a8c74953a7f4fcc3241d11220920\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"75dd7331746540b84bfcf57113a656cef26867634c59a3352c77874fd90b6a31\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"75dd7331746540b84bfcf57113a656cef26867634c59a3352c77874fd90b6a31\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"75fdd94eedb1a88d792982fcdb7f3e6d99ca88138920960ae99adb4fb77625a7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"75fdd94eedb1a88d792982fcdb7f3e6d99ca88138920960ae99adb4fb77625a7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"760f2e55bf8f853764bb6aaa045c646175b7b6b8ac9e87f000588b0352d380dc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7649b82eb6b19b3024bccb5a546704f7a0b7107d591eed36a2bc43e52e622d76\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"76855db74eaad3d0c073c15f4598e4e95dfbc21afecfe21f9ee479ef8e13e9c2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"76855db74eaad3d0c073c15f4598e4e95dfbc21afecfe21f9ee479ef8e13e9c2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"769973bbb28fb4e8f7fcd7b78d4f09723c0f6f58b3c88d7b05d5d9cecf1eb93d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"769973bbb28fb4e8f7fcd7b78d4f09723c0f6f58b3c88d7b05d5d9cecf1eb93d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"769b731d16e5934147dca77e3533b6490d1947c9889a5d67cc6671b636eab67a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"769b731d16e5934147dca77e3533b6490d1947c9889a5d67cc6671b636eab67a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"76c42080e52f8167d1d50a4e8fcc95c49afa8d4769fe7637ed4848f3f9cf9806\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"76c42080e52f8167d1d50a4e8fcc95c49afa8d4769fe7637ed4848f3f9cf9806\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"76ec2d1610f5d7a458583c3dde10eb8a7dbfaaed52873268a6a6011bd45616a2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"76ec2d1610f5d7a458583c3dde10eb8a7dbfaaed52873268a6a6011bd45616a2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"77150aa1e37a625e4b52fdf5c208687d559199442e920ceedab15f51149823df\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"77797cb9c641059209b2060a35decbfd314e6075a563efcd68a39c9059a29c72\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7785f0edd6b775f4e58ae168c579f66edfb6c23dbc938a9b8bd66c5ce8b85cef\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7785f0edd6b775f4e58ae168c579f66edfb6c23dbc938a9b8bd66c5ce8b85cef\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"78479bf14fffef4e9dcfe3356e695beebbcee953cd507c95b9e046b140d64a24\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"78479bf14fffef4e9dcfe3356e695beebbcee953cd507c95b9e046b140d64a24\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"786cb4c80da17cad6d6a39c6658accf08dd173da2a2ea18fa7489e6fb788922d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"786cb4c80da17cad6d6a39c6658accf08dd173da2a2ea18fa7489e6fb788922d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7898c406060efcd78fb246cb56ecba7d9dcf59605b4f479638e783455c4e2015\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7898c406060efcd78fb246cb56ecba7d9dcf59605b4f479638e783455c4e2015\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"78a152ba8b6331bb710ed263b4af90a08c9d74df4ca9b868c7c03f0ee475c6a8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"78a152ba8b6331bb710ed263b4af90a08c9d74df4ca9b868c7c03f0ee475c6a8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"797786296a0c7b4ece42f473fa1d081240b1add0cb9d8d58502328a1e50afd4a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"797786296a0c7b4ece42f473fa1d081240b1add0cb9d8d58502328a1e50afd4a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"797d8aa18719be9f08b698accdd97171875ce6a5547d85703e49844827790784\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"797d8aa18719be9f08b698accdd97171875ce6a5547d85703e49844827790784\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7a51693996f04de3ea8e1a6b3b722d7b169a01d1aec51c033e5efbdeb4442147\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7a51693996f04de3ea8e1a6b3b722d7b169a01d1aec51c033e5efbdeb4442147\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7b17e7fde99ceb7f5b4db0cd492353c06fce1d49f162f937113e7c0b9cfe8ed1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7b17e7fde99ceb7f5b4db0cd492353c06fce1d49f162f937113e7c0b9cfe8ed1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7b6dc7723982e7594776d445b60c99c7d133c9e71c1667bec6d85dc04cb1f5dd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7b6dc7723982e7594776d445b60c99c7d133c9e71c1667bec6d85dc04cb1f5dd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7b9e84c4b06f2493e417bba3158ee3ebe7fc8982a80fbfb3340bdefe3f1272e8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7b9e84c4b06f2493e417bba3158ee3ebe7fc8982a80fbfb3340bdefe3f1272e8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7bd34101e21e676796eeeb27ff54cce2ff35ddc9a762a82c211515f82d97e92e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7bd34101e21e676796eeeb27ff54cce2ff35ddc9a762a82c211515f82d97e92e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7ce356b6e57fabc1f9203db4cd055da749de3c575bd85386de842dc99eab20fc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7ce356b6e57fabc1f9203db4cd055da749de3c575bd85386de842dc99eab20fc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7d21a0eb030fb6925fc3f56282443fa02e4896020c72fd54b8f8c997743586e7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7d81c8619324ff1ee062f6cf2a7e64de2261faa27d8da6e941c66bc72e323d53\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7dcf74eb40517011aabd8462c3617a90081a4a2662bb54c5c04d4f3171f9a09d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e0f1920c491cd7471c2e390ebf4b24344cb5b7c9b53082ba20b5b2d4c753049\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e0f1920c491cd7471c2e390ebf4b24344cb5b7c9b53082ba20b5b2d4c753049\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e24b40f2935dd39029e20a2a423cd965667bd9b33665a4365ebbc2fe12331b2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e24b40f2935dd39029e20a2a423cd965667bd9b33665a4365ebbc2fe12331b2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e535a21dce242e2f067ff80906106cf8617c3b506f491f4d5644e4b92eee9a8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e535a21dce242e2f067ff80906106cf8617c3b506f491f4d5644e4b92eee9a8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e768a2b5362cb24e1359449c91f1a2c542f9687764e6bdf1c96f0963423549e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7e768a2b5362cb24e1359449c91f1a2c542f9687764e6bdf1c96f0963423549e\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7ea5dd47421dc7a3c6b8c29dbf7ed9e7509a6e4190caced821a8713b125e80c1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7ea5dd47421dc7a3c6b8c29dbf7ed9e7509a6e4190caced821a8713b125e80c1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7eeadda268e8dc1f3c72356dd50679ebcc8cc83967e5ce0b16cf123f1a81409c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7eeadda268e8dc1f3c72356dd50679ebcc8cc83967e5ce0b16cf123f1a81409c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7f2d899006b921f7b55208309f6abb2b21c5fbbfc8f49b0385ae22ab54509f91\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7f3616eee230938622257b1b40be1e9b10d702ebe69b0161f5089c6ae8a9a79a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7f3616eee230938622257b1b40be1e9b10d702ebe69b0161f5089c6ae8a9a79a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7f3d232ccce6c533b530e68a84d5256786c4d37f031db1b4232dc5e118185276\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7f70d17472d0f6adb7bac1616c8321690308b624f7a297f7ac9c11d0b0d4dac7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7f70d17472d0f6adb7bac1616c8321690308b624f7a297f7ac9c11d0b0d4dac7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7fd8d13ae58013d3c0c7bc056ce75d599e2dd4a6bb5b72ac582a8302ada1032a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7fd8d13ae58013d3c0c7bc056ce75d599e2dd4a6bb5b72ac582a8302ada1032a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"7fe047ce9ec9b0a9899341650578e131197fb4d0451df572e10254cdb7b0f5a9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"805ff6ddb99854304639e9b99ebe29c40d82a2e04c13f30a90da094d14b509b0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"807365467c86dfbdbd7f5b5433e57ccec0a547c94eb561dce2e29e29cfd86017\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"807f37da41b3451cf9108954db417bee28985af895b8ffeb4f38b41adbf1741c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"807f37da41b3451cf9108954db417bee28985af895b8ffeb4f38b41adbf1741c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"80c7e9be47436a176bd951e493337249be23329d51b23bca1bff5b6868f47064\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"80cd0023c262cebd85ef1387b825c061614321752bec59d54fcede3c41b8da60\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"80cd0023c262cebd85ef1387b825c061614321752bec59d54fcede3c41b8da60\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"812bb53f772c9ef32543963dbf9877ac0a151b05d8ff4083e22a9e01dbe17ae2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"812bb53f772c9ef32543963dbf9877ac0a151b05d8ff4083e22a9e01dbe17ae2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"814b29424bae2297439bcd8d699d2f4e90813a7ef95742954d73e62719b66498\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"814b29424bae2297439bcd8d699d2f4e90813a7ef95742954d73e62719b66498\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"814d7b3548395e53ddc378e3c5ec95e453239deb5b805786224810e6288f6f73\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"817593043b13c1b0c70efdc28359efd19efd0d170fd9a261eb664cc09fe54751\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"817593043b13c1b0c70efdc28359efd19efd0d170fd9a261eb664cc09fe54751\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"818b11fba6b18e69caa96542ddb70bfea0c308d90c0f93bd321a2727318cbd1d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"818b11fba6b18e69caa96542ddb70bfea0c308d90c0f93bd321a2727318cbd1d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"81a1401feda7332bd6472803d127e25fd931ec8600384bfa3c8ede6469a74121\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"81a1401feda7332bd6472803d127e25fd931ec8600384bfa3c8ede6469a74121\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"81c65cd176edeb7d981ccbc6b5b278cbaeeed8f02fed9b9e624b052b66da837c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"82345b7a7d3d4689ff252f0fc2de7970524efd97e939b377fd2ccd08f9ea60e3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"82345b7a7d3d4689ff252f0fc2de7970524efd97e939b377fd2ccd08f9ea60e3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8326537cf9783acf65effcfd81e65ef75bc534faad226450cd9d253131085fc0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"83385bb17ee0382c94fbb720413de0e22bb480d775393f55074cfcd8d38dc483\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"83385bb17ee0382c94fbb720413de0e22bb480d775393f55074cfcd8d38dc483\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"837751d330c50582fbd0d9e198db93df071e30ed73c3844f006e63276e239943\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"839d23c0aa8cc0e628acfa1d9b58046f3639bdb0d8f67387c4671fd99dffb91b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"839d23c0aa8cc0e628acfa1d9b58046f3639bdb0d8f67387c4671fd99dffb91b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"842353acbc854de24407d7783426fde916ed45f12579504ba9c1df125355c7ab\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"842353acbc854de24407d7783426fde916ed45f12579504ba9c1df125355c7ab\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84267d238856bea4e3db9593ac30dfd4cc4997ef0dcbaf27f49edfd748c7efa3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84267d238856bea4e3db9593ac30dfd4cc4997ef0dcbaf27f49edfd748c7efa3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84743a8f5b6315f6727d92f3f15812e8d00059d928bc9de8a90d23a24a9f48be\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84743a8f5b6315f6727d92f3f15812e8d00059d928bc9de8a90d23a24a9f48be\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8484d2cdc33f31fa610e22d593fa9c2b1e2e4b6c2ea53612612c479ab6f7aad0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8484d2cdc33f31fa610e22d593fa9c2b1e2e4b6c2ea53612612c479ab6f7aad0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8487ce4090a111761324f6365743702fd9c89db20617ce5e6a0e291ac6086367\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8487ce4090a111761324f6365743702fd9c89db20617ce5e6a0e291ac6086367\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84e55508662585626bfa27452321a1df254a65bd1e49d5c9fccfee0a4c665ee5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84e55508662585626bfa27452321a1df254a65bd1e49d5c9fccfee0a4c665ee5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84f98ba34966cb0bffbb2326f1fc755b75666a750bb188350c8ee85f1352e701\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"84f98ba34966cb0bffbb2326f1fc755b75666a750bb188350c8ee85f1352e701\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"856fcb43e0394eedb3ec0978618e47d6030ebdfda606f4cae9cfe5bd4bc3eeaf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"85b92a25a307c61cf18530912e3a7e3bc88098f33eb3d46400df22d254954bda\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86158ccdcc8b793606209489a71a36312c3ee5f0694de6a2a3d847913c2158f1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"862a81a5d571f293b0b0e8401c56b673a089aae4819a3647fd13a1cd074443a9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"862a81a5d571f293b0b0e8401c56b673a089aae4819a3647fd13a1cd074443a9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8640dd92617e4e8f00a113a6a19646b99a2fdaf46672b7e9a6486f28d97cfb14\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8640dd92617e4e8f00a113a6a19646b99a2fdaf46672b7e9a6486f28d97cfb14\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8661b26e97e29d121d5d71893f375b4ad144b68dd1d7a9b4ef374eb1e75cf496\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86761d63d54e527cdd3f571de4c4c6aef6e98f737e3b29244053c850da8d7370\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86761d63d54e527cdd3f571de4c4c6aef6e98f737e3b29244053c850da8d7370\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86911926ccc5541d068b505d4cf1ec66d244a8341f8509b0e3a1301c2813ac94\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86911926ccc5541d068b505d4cf1ec66d244a8341f8509b0e3a1301c2813ac94\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86a0afe2ddec131720a18718463cd5cc5143ca137ad164ad5697edccdaa0e200\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86a0afe2ddec131720a18718463cd5cc5143ca137ad164ad5697edccdaa0e200\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"86e88a8d06e58d4d6ef008884477b4efbfd7178054f7318cf06f0d1a09493e8a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"873bc3779d833fe0056cff40c9cee9d029c89c838faa85f2ed6bb529ca24ae1a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"873bc3779d833fe0056cff40c9cee9d029c89c838faa85f2ed6bb529ca24ae1a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8750e8a4be84726d0c08317d7d11b7de0d683b185eb7f25a80a0a9ebffbec697\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8750e8a4be84726d0c08317d7d11b7de0d683b185eb7f25a80a0a9ebffbec697\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"875600bafd06aed1e4e42f7dd7fee16a0c45f5551e3cb320fd1e1309de8c5dbb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"876ba70665d500eadd485ab1c986f610e61ea07592f9a43ec716a3c58fbd8a5a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"87b8d532519414c94517792336e079cf0ffa3f60f3f374885bc12ff4f86fbe77\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8823dfc5ac80f998b5659c73ae37ffc9fca1a5c921cdc368e07e3eb03e52466e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"888fd2342e0a61bc6419f20434c18d2b41e9745a43f68dc6deb58ecc99d5ec5d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"88dc55677b2af96b9ef9cf26fd4a6a17b320959573305a71cbd41c02c283025f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"88dc55677b2af96b9ef9cf26fd4a6a17b320959573305a71cbd41c02c283025f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"88e140031b8960f3b3fcd4eb0f771d97d579d727a168b8ebfb6d52e2149d3ecd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"88e140031b8960f3b3fcd4eb0f771d97d579d727a168b8ebfb6d52e2149d3ecd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"890ea2598f25f46615a02912a0be60b385c17afc80c1f817eb0f7b88f4dd84df\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8965f6fe407668a91c4925893347ca0951d78c8337aef4d25e98babc7e9fe06d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8965f6fe407668a91c4925893347ca0951d78c8337aef4d25e98babc7e9fe06d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8980b46aac5b8b7ebed22d4d551b33a99f933873fd8eaa58b627ad214876f643\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8980b46aac5b8b7ebed22d4d551b33a99f933873fd8eaa58b627ad214876f643\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"89d60009530f522c708aadd49f3ef7375cad58bea0be6b515d045e5cfd078369\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8ad8f6e7d0211be7053dd29c98c736e6303eade6b2c9f8572accd9b41a5ddda6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8ae7bca02bb3102f7255e7021ec61265a0b4db67cd0588d37320145713f8b7e9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8b346fdc8b824d94c271db13c1fea4af14ce91f10901df978a6c8d108657f453\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8b6362c0b6bff7019d6221824f8ca36535db2ab14d06916ca3c2152fa53e9f7d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8b8806e1e72d7011ce5f8ad6069cb9924594969f2a06ea06c3678930a1445fbc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8b8806e1e72d7011ce5f8ad6069cb9924594969f2a06ea06c3678930a1445fbc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8b9b056e6831ef00a133a3257f0acba13b8a6b4f27fc63c2985e99ca4199c1cb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8b9b056e6831ef00a133a3257f0acba13b8a6b4f27fc63c2985e99ca4199c1cb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8c54ccd7789d8e2bc5f979a430b1d015a90f1eebc73414eeea0951de5bac5362\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8c6728cd48f657ab56b1150b0fc5ce29ae304d8461052077df4c6dafa08277d8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8cdceec796f1476b72ece392c4c69f87376c76915b1cf966029a47955233d7bd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8cdceec796f1476b72ece392c4c69f87376c76915b1cf966029a47955233d7bd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8d6e89d12d51d7103b05959fa414794af18624d066f0497002903e84a13c3224\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8d6e89d12d51d7103b05959fa414794af18624d066f0497002903e84a13c3224\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8dbe9fca4cd19082b31cde4642c206ff4049ffb8e732fa2c22499dd0fe74b2bf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8dcbb3585bf6c357702f37fc9c45eb70bcc7999faf18d04404aa41b28f614bbd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8e2ede8e862750af5836adff85fba81568873b40ed9648c26a0f3cfa0eb9fafe\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8e6b9a3f109663a835b9a008371a45ae6106d9d256876db4eb6f63f94e5d2f79\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8ead2c0c76615db9f26178ebaf221718a1db9838b1567e21d7bcad507cc3e9c6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8f374c3c60407c60c779fa4bf61a5f88150845edeaaa350bb02b8c45fd037571\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8f5905e499b14146918fee18aa68557c08b617028d2f37120bd66dcf10fc2fc5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8f5905e499b14146918fee18aa68557c08b617028d2f37120bd66dcf10fc2fc5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8fbfa9eaf8da790e35edc03e047e7188196fc8797882a182a53dbfa89911cca6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8fceafc50fc743340b972c600302f8ae6fb471bff1e652febeab3c85c982d176\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8fceafc50fc743340b972c600302f8ae6fb471bff1e652febeab3c85c982d176\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8fcf90c801fad679eed6e765c4f9fab867d136c88ef9359ac8a540854c29b99e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8fd1ffe62f9fd0d1cc336d12ff0b7feb8ba540b73396a2b8717d59cb584482b7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8fd1ffe62f9fd0d1cc336d12ff0b7feb8ba540b73396a2b8717d59cb584482b7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"8fe93eeaa43d17a71083fb06985d70163f15201a4273d767b2e1f9eeb27eac67\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"90155cc74eb0a980452d1b9bdd5c1da839ee0d560ee54eecfd4e6f8419374078\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"904babe3cc4a6523f6c7d7bb4fa8178c2c955c89d81a14dde3234ff0f34318f2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"904babe3cc4a6523f6c7d7bb4fa8178c2c955c89d81a14dde3234ff0f34318f2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"905ba432e164950576b11a851bf9e20da65a563ed1f7c48c70e08195cea64910\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"905bee529096fffcd9db5df6412c01a8fcb7e3b278d40577424787a92c2184c4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"905bee529096fffcd9db5df6412c01a8fcb7e3b278d40577424787a92c2184c4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"90710a52375ee50ccc9acc02613bee5347650b9f2161c75678983d4b51716e6f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"90ee0000e5ab9ac3f4408f6b4d27fa4eedcb2c52c6cf614e6dd347634fede04e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"90ee0000e5ab9ac3f4408f6b4d27fa4eedcb2c52c6cf614e6dd347634fede04e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"91b2f175d0fc88146369f84ca6c239ca1a6ed98829ef62482a99547730a9ebea\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"91f9f6cc669facd111f878e457fda05584815afe9cf23b6405fd48dfe20633d1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"91f9f6cc669facd111f878e457fda05584815afe9cf23b6405fd48dfe20633d1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9263e34378d30e333d08476050a49cc27cd37184536134598ecc1f304b6ed93f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9263e34378d30e333d08476050a49cc27cd37184536134598ecc1f304b6ed93f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9299bf498fb56be00833487fbec77f2bd83d642e13a9e3bfd859df5e89080e05\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"92c7be3c98c57372e1db4afa66055e16e1a76e295d6aa6c6e078629cf56faf70\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"92c7be3c98c57372e1db4afa66055e16e1a76e295d6aa6c6e078629cf56faf70\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"92dc617893c552bbff8cc6cbba564452e8a81ef994ac2230f6c922b6c498c756\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"92dc617893c552bbff8cc6cbba564452e8a81ef994ac2230f6c922b6c498c756\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"932f62162bcacb82fba8da45b4dfb5791a84217f1025305e7b7aa4000c3b84e0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"932f62162bcacb82fba8da45b4dfb5791a84217f1025305e7b7aa4000c3b84e0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"933874d8bff04df6747bca29582974990978827cbda5760ec9cceeeeb54f9566\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"933874d8bff04df6747bca29582974990978827cbda5760ec9cceeeeb54f9566\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9367c8794fa89f465e17385e0a07d4a51d6170835cb1a3408bd26cbac6f703ff\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9367c8794fa89f465e17385e0a07d4a51d6170835cb1a3408bd26cbac6f703ff\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"94069ffcadfec40d2a4242158dc78ae8c6cc384a85f7fbd71d7ef26028ead3f5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"943a14e24f551013929c65f7f048e2824da2a2ed3e361344b3be6d481f3d7bd4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"945044b2c9942caf7757f3388ba99ee66146257e5f59e8ed393c02755253734d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"945044b2c9942caf7757f3388ba99ee66146257e5f59e8ed393c02755253734d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"945335aef9b3ad2d1c90b835f16e2d67ca04388d000a475324071c932a1068cf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"945335aef9b3ad2d1c90b835f16e2d67ca04388d000a475324071c932a1068cf\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"945ec1d29b9c8b6c6e9b4b8ac93a1734fb391a0baa6998a8a19750088b58de7a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"945ec1d29b9c8b6c6e9b4b8ac93a1734fb391a0baa6998a8a19750088b58de7a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"948f7027b4ef9e19eeb9596f048adcadb7d54842ec2cc8f46f64d7d670deaa44\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"948f7027b4ef9e19eeb9596f048adcadb7d54842ec2cc8f46f64d7d670deaa44\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"94a7153361e6cc2d9252d4a58616cca087bda7c7b3288a865e3fbb145ab308bd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"94a7153361e6cc2d9252d4a58616cca087bda7c7b3288a865e3fbb145ab308bd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"94ea15df80b1ca7344b5f410f2b8e108780b94686e0d5e54efc448d1ba01e760\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"94ea15df80b1ca7344b5f410f2b8e108780b94686e0d5e54efc448d1ba01e760\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9503bb92a882ea713afeee49e0b40361693e6a1ed93b596b30222a033ac2e74a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9503bb92a882ea713afeee49e0b40361693e6a1ed93b596b30222a033ac2e74a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9514a9c891d5e68930081876ae8afdb9b3f721935dc534b8d224b6dc2ad0d630\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9514a9c891d5e68930081876ae8afdb9b3f721935dc534b8d224b6dc2ad0d630\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"95935e3663e1ad9c9ba0a4317586f009430cb8bc0b8db47cee4f247c9227e97f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"959980bc960f19db95720458de60c8b950bfbf3b5c484772a6b0f6114ee2ddbb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"959980bc960f19db95720458de60c8b950bfbf3b5c484772a6b0f6114ee2ddbb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"95f7d5eeb7a5982f97093adcec5127c63b635c34f70d08a2e139993601973109\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"96aa87400ad8ddd8195ad282be1141207509e72c706908207d0902847c6cdae9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"96d7617fd1d78090cb94a711663eb326f52160ae05fb213b6e28ed601ffcc31b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"97b4112fc338bcc79a3f8c176ce0afa0884d9fa56507ded405c6f7c352feb64a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"97b4112fc338bcc79a3f8c176ce0afa0884d9fa56507ded405c6f7c352feb64a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9878361067c6bce87245517f833c2c7d90edfe40c167941d5554fbc044fcc691\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9878361067c6bce87245517f833c2c7d90edfe40c167941d5554fbc044fcc691\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"98cd917fd42973dbbffa561e647fa4d593287e62b2407fccca9638e67d7e42bf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"993a54d3efd0c82b25649bf5d6f77a44f6f5959531e2854530b260dae328bfd6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"997bc50b09f1455e793c76527c37ab1c718702bcabd6eac8dc368d3ed9bfe112\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"997bc50b09f1455e793c76527c37ab1c718702bcabd6eac8dc368d3ed9bfe112\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9981d353d3eb06e784c456f0f48ee6ff6b143dbf0653bd64e8025f3931f2d6de\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99980e7a29ba0c4322b7e9c1e499ec49a693513130ea9b33d47c3b0df4a1e1bf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99980e7a29ba0c4322b7e9c1e499ec49a693513130ea9b33d47c3b0df4a1e1bf\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99bd3ba73a331a89e5b357026befe087bfdba2f9fac2a2c6c4c8ce9975ab5995\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99bd3ba73a331a89e5b357026befe087bfdba2f9fac2a2c6c4c8ce9975ab5995\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99c04aabd8efb2c5519d8f52ac68b591a12f06d55d3e186abd442a81ce8d2461\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99c04aabd8efb2c5519d8f52ac68b591a12f06d55d3e186abd442a81ce8d2461\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99de55232a7fc6b42f26ab0ce288da3cfadac6a950e9138032df1647198446c8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"99de55232a7fc6b42f26ab0ce288da3cfadac6a950e9138032df1647198446c8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9a08ed8c04586931c290272ece669475358cf2f77bf755c2cdaf6cc9c3536a85\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9a1b8b8f337770317f8b8f3ef555f2940ff06d5688c90d4a7d0f40163812a517\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9a731ceef4d0a084fa06f3bd4e49d4d4ff4a4fec70db7ffc90bc9972386833dc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9a731ceef4d0a084fa06f3bd4e49d4d4ff4a4fec70db7ffc90bc9972386833dc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9aab7d19824f70181766e0eb2656f415557ba71a3185173c41c08a142f5fd2e5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9ad16daec8f9de33895305754859028993ebf3801552ae38bc88f20342dabe74\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9ad6403e3d82b33a48cb96ae7af73cc2cc3406d070535f4c348443207148a4de\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9ad6403e3d82b33a48cb96ae7af73cc2cc3406d070535f4c348443207148a4de\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b2fad5c6cd158e209a0f3f15a4f83bb22b79493893100ce2f05075bcb7cf572\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b2fad5c6cd158e209a0f3f15a4f83bb22b79493893100ce2f05075bcb7cf572\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b45979f1bbea7a9706e149bf0efe723ebb46cadc7816b1d1fedb43667e18f07\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b45979f1bbea7a9706e149bf0efe723ebb46cadc7816b1d1fedb43667e18f07\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b49d44aa9b7032782bd0e44303d8f8b08518b43af8e60e458e66ae1c192fc2b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b6d96fb7663a94fec0fb84898f066a9c6811fa047f8afa63d8f70ba6f67f3fc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b73cf6e01f775b3afb6f8ec10102653726cdd8a091190c60a1da03ef3227e26\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b73cf6e01f775b3afb6f8ec10102653726cdd8a091190c60a1da03ef3227e26\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9b7db5b76b6d4b158193904a2b366509689bc655e5edef11831b441718a60071\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bc597f389d9802379250b4ebd989ded9fa054f3184b0f17bd4aab6f5b79ac1f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bc597f389d9802379250b4ebd989ded9fa054f3184b0f17bd4aab6f5b79ac1f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bc946f72e5bf19fc5ce1613a6c9f810247b5913b74bc8522ae70835b8b5812a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bc946f72e5bf19fc5ce1613a6c9f810247b5913b74bc8522ae70835b8b5812a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bcb62c0f2979b6bfb86249a5a606962a05f6146753f2ea95e83da0b33d72385\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bcb62c0f2979b6bfb86249a5a606962a05f6146753f2ea95e83da0b33d72385\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bd8903fb8bb64f659777019eb8c7c8181913a816bbf595ae83c26aa99e6f74a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9be54f301af3b5f2ce391b84b32689174cfc835bd9092d67e4826250a8b3b8b4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9be54f301af3b5f2ce391b84b32689174cfc835bd9092d67e4826250a8b3b8b4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bfd904d20b458c9f2c6dad2f2f2c5fc76aaea16c6e49aa31e62a8e42e627920\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bfd904d20b458c9f2c6dad2f2f2c5fc76aaea16c6e49aa31e62a8e42e627920\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9bfff64bbcf2bf73aa7c7b6358a7d858b5ddc83b19b619e74e35942e0f636505\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9c1571b5589b1681a47d2b02c3531702ebb7d466476fd0062a92a3ce12a6e835\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9c2bdc667c4a8a5ed0d71bc3cfe299182ce5676e139dcf7a0706fbc2377c72ac\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9c2bdc667c4a8a5ed0d71bc3cfe299182ce5676e139dcf7a0706fbc2377c72ac\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9d1f6ff2e2e56d8b56f8d92a5474f47860f13d3625ee8bdce14f3cbc955c595f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9d493a1dd3914989bc2ba3673dd5c9b17587059c1ae62f75c4c85a145bcfd940\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9d9427938b52114be9f67a17ba6b34d61cbf2e082f3bec7f961fd305664f1d41\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9da96c251bccb6378b0d4d87f3594b5ea314a26b18a7937cea0517e4967493d4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9da96c251bccb6378b0d4d87f3594b5ea314a26b18a7937cea0517e4967493d4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9df4adb6cc5f7610024dabe9635e2ae8eda58ffe64f7076d01cdcf7a0887a61b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9df4adb6cc5f7610024dabe9635e2ae8eda58ffe64f7076d01cdcf7a0887a61b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9e0f2050079eeb149e37209bcc6e99c111f4c25f7acf0d516b884234aa92cec1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9e2435d8b8362c29f89b99ba41036a127d1bf8ab92ec0014301e7dc8c991adaa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9e2435d8b8362c29f89b99ba41036a127d1bf8ab92ec0014301e7dc8c991adaa\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9e9c645a3d70e6a36353ffd50b3ec189c935dd71e67e8495f3184d17aa6cf694\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9e9db48c147c52ad17a5b4fc061d0271b27a595e82b31124437b55d8785337f2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9e9db48c147c52ad17a5b4fc061d0271b27a595e82b31124437b55d8785337f2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9eb216d271c30702016518e385e60b01f85fdbe3c7d895a65ff69b336f825832\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9ecd5f5a65f394d4c0c4ca15720bd921c75c9872f69429c9f66348129c9e62ef\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9ecd5f5a65f394d4c0c4ca15720bd921c75c9872f69429c9f66348129c9e62ef\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9f02cd2f75557b4a6828f380713866af3ceb9adf6a5bfa86e03e5e6de4499146\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9f505e538cbe5fde83ffec8451ee7504f97904cb23cfcb4b9c477fcade8cee95\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9f505e538cbe5fde83ffec8451ee7504f97904cb23cfcb4b9c477fcade8cee95\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9f7aecdfe133935e62d0ae7b3635fa46b9e4ad37ec7331471cb842ce0e28fedb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9f7aecdfe133935e62d0ae7b3635fa46b9e4ad37ec7331471cb842ce0e28fedb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9f8680d54c4d0bc9d6cab09251116c75194ad2b4831ca600f43a5d32249fa6ae\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"9f8680d54c4d0bc9d6cab09251116c75194ad2b4831ca600f43a5d32249fa6ae\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a0050cda9c4eb183a8f61172d629bd46049f4a0644f656f244b4ff5f87ee734c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a01b2b6d91324c0311cf2ca5f999fb785e56c41e1ace8d001603185477eb558e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a01b2b6d91324c0311cf2ca5f999fb785e56c41e1ace8d001603185477eb558e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a03093b69670a7da46c1791ff9fc878462cc1e4c2199cc6590a5e779dd8c9f2b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a03093b69670a7da46c1791ff9fc878462cc1e4c2199cc6590a5e779dd8c9f2b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a096fe6e67040329ef3cb2d0700d72d582ff266ce896736f0ead9b5b3ee75e4e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a0c09e73fd8712f3518093b655ce2bd8addcd576fa535be03ae2e7d1789db2b6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a0c09e73fd8712f3518093b655ce2bd8addcd576fa535be03ae2e7d1789db2b6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a1365d3de681150177c616185ea3b177ebbe2380cc3a996bfff1918b720f8985\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a221125f67135f8911deda466cdf04d1f0d427709fdc0a5593952cac96710a79\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a221125f67135f8911deda466cdf04d1f0d427709fdc0a5593952cac96710a79\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a241a9a8fa3e707a0ae7ec8338dc1882c2a2dc483c74c82861a6f43a83265d3e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a36925323012601afad090c115879c26cf13463ad72799abb118d72dafcc0db0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a36925323012601afad090c115879c26cf13463ad72799abb118d72dafcc0db0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a387bfaf79a959e2d01178d03bd3c5db897405a425cdbb28f9c897353588036a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a3a819f687663c5f7ef51185da8bdf80e39d28e309786465544133f3fe42a507\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a3a819f687663c5f7ef51185da8bdf80e39d28e309786465544133f3fe42a507\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a3f3f38715d12bc2cfae5b9436c5d167cc31d4d0517d30fda9180189739cbbc8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a3f3f38715d12bc2cfae5b9436c5d167cc31d4d0517d30fda9180189739cbbc8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a43b66ed29f27c1a23452668dcef172bc14949000fc73e1f4cc0b05b14d5b0ed\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a43b66ed29f27c1a23452668dcef172bc14949000fc73e1f4cc0b05b14d5b0ed\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a4cb494da978d469f21c5f833ec8cc6099496c23be7e2d3b0dfe8664b634c660\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a4cb494da978d469f21c5f833ec8cc6099496c23be7e2d3b0dfe8664b634c660\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a4ed9a4290cc71715f33300740ea12e41151dfd51aca34283a1edb2bfed8a3ff\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a4ed9a4290cc71715f33300740ea12e41151dfd51aca34283a1edb2bfed8a3ff\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a50a2088a34ead7648f741f1e31eb5db9125e0d52075b56c4de2324382544094\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a50a2088a34ead7648f741f1e31eb5db9125e0d52075b56c4de2324382544094\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a53b2fcb5a64f6bcfe2dd7d643d9dc32ec8f8f297fe7e52c70b1fec94ee2cac1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a53b2fcb5a64f6bcfe2dd7d643d9dc32ec8f8f297fe7e52c70b1fec94ee2cac1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a584cd123b4ff5a838c28fb8f457c7caaad6e5c57ea65c7e11488aee936fcdf5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a584cd123b4ff5a838c28fb8f457c7caaad6e5c57ea65c7e11488aee936fcdf5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a5856f046635f2738d944a840a2fc9219f61db3cd56d298fa731b00ea240fe24\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a5856f046635f2738d944a840a2fc9219f61db3cd56d298fa731b00ea240fe24\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a5a30ff7cd68dad335f7920f32e9c167ff320264550c2eda5a1e260c8fa09d31\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a5d75b7f99edfc8259580285999197eb755b7e20342cfa0731b09f5b0b3635a7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a5d75b7f99edfc8259580285999197eb755b7e20342cfa0731b09f5b0b3635a7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a604c5b7aba60b1cbbcf1c7eb238a3004474269a7f909276e775fc613b9ffc42\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a696c99d14a137e488a33e1fb43e968b361e2b721d43a9d08e90c0e15fadfd5e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a696c99d14a137e488a33e1fb43e968b361e2b721d43a9d08e90c0e15fadfd5e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a6a24d42e32a5c8494d1f85827bcf448a3a34561fec7c58ab4f75cdf7ae97a97\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a6a24d42e32a5c8494d1f85827bcf448a3a34561fec7c58ab4f75cdf7ae97a97\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a6df1d401691587652f121c224c5d092e23306b2250afebb8e89c9956e0ee20c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a6df1d401691587652f121c224c5d092e23306b2250afebb8e89c9956e0ee20c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a6e1c305f5467e3f2586e682576e98668ad39ed0ebc88eed0bc8a535bcc4c625\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a6f0458546b1bf81fc3ca27b08ac594be6e1a03771c7c748b527ba2f91ab0409\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a716aa42cc7c39aa132d3b1be001f17227096c0213101f3ed9242c068e631ca5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a716aa42cc7c39aa132d3b1be001f17227096c0213101f3ed9242c068e631ca5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a79978cf20ebb26a8922f7b3d127890170f2798536743be6e61c8bfe0216ed9b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a7ddcee8b5497d97f52944d0960adc5c304d87318d91521aeec5c8668dba3206\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a80ac1efe83ee257fea41999f12c9d883f4fddadb3e06927bee1a3eca1d19af6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a80ac1efe83ee257fea41999f12c9d883f4fddadb3e06927bee1a3eca1d19af6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a813125dc76d576690b4d8c145cb37bd2f6d2f45079ef69fbe5a84619727e12b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a813125dc76d576690b4d8c145cb37bd2f6d2f45079ef69fbe5a84619727e12b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a88baa5db0855e6e6e2d7992b645c3e8440e06883232650cb4652f616bda44dd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a89852c0e5a59147d11ceb766417d8393f9b9cad207cddd1e32eec724e484446\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a89852c0e5a59147d11ceb766417d8393f9b9cad207cddd1e32eec724e484446\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a8ed2bca36d7d5336417189b42e7f2c326144959fd6446449e9d1d900f3edf94\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a8ed2bca36d7d5336417189b42e7f2c326144959fd6446449e9d1d900f3edf94\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a8f96842a48580747e35131ca35df8ab24a8dcb863b4628c6cf612b06e6932a0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a8f9f78fa9821254967bc1bec6d5761bdb7f70383a378c6f4636ec75297e0d0b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a8f9f78fa9821254967bc1bec6d5761bdb7f70383a378c6f4636ec75297e0d0b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a90607a69b81e9fc903b36bfbb165ef125b94ce3a997a39ce8fdd5bdb80f8a52\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a910426b67b8457c1ef4c06a8ae59afcefee37d8d8bd7226f96fe06e4e47012c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a9461384072083f90f8ca51b121030ac75c63111c7f037474d8b244796185bc0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a9461384072083f90f8ca51b121030ac75c63111c7f037474d8b244796185bc0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a978aabaa9771b07279153920e1428ab4300416e87b3173a92ab61f1d69d2ffe\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a978aabaa9771b07279153920e1428ab4300416e87b3173a92ab61f1d69d2ffe\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"a980d197c6f9ffae90152e91e1f57d002f4993793084d3c1465ab423a1c10c21\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"aa1fa52c55078fd26b654b398f8b67505e05bfcaaa6d56d24c854a7e2887f97e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"aa1fa52c55078fd26b654b398f8b67505e05bfcaaa6d56d24c854a7e2887f97e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"aacebbabf46073e3bcce0f68f4f87905655448e7d8701d7761ef188e26464136\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"aaf75023618fb7a8dce3cb4e3738304791255912d026bc8d470cfec00d0fb5aa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ab552312967c8122d40332c7541ccf987f92bc306dfbe65d4120a7e55426790a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"abc9acf8b5d0e3354fd4e6c24a2cbc17c46fb1ce0980f7af4fad295e5a88fe46\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"abc9acf8b5d0e3354fd4e6c24a2cbc17c46fb1ce0980f7af4fad295e5a88fe46\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"abcd9d6cc5710ddb438445ac21a633fbabdccfef70210a37c8166fbb20fadb47\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"abf71224c81a3e898998218a31051a90f139594746260f6003b81a479074d4d0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"abf71224c81a3e898998218a31051a90f139594746260f6003b81a479074d4d0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ac0067502beb16a07232266ddce50474527f4783e3f8fcf44b19aadcdb22ef92\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ac0067502beb16a07232266ddce50474527f4783e3f8fcf44b19aadcdb22ef92\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ac2f4c1722cfda11e2af1899e50e6d60088702447d44cf423f3ee4e2e7f62fdf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ac6f0cc6b92030c420d1539c3714aafdc9cd624d889ced2240a6136b92eef61f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ac7627e96c65c5376687667311100e10584cc6f4b9aca8b905d0e2a0391f7216\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ac7627e96c65c5376687667311100e10584cc6f4b9aca8b905d0e2a0391f7216\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ad4c70a297cd8c5b957573cb24c749b880b0f368f6e2de5da8b633bdcf5013ab\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ad4c70a297cd8c5b957573cb24c749b880b0f368f6e2de5da8b633bdcf5013ab\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ad5a3178a54124465c248c0fb661b4ee5cb925fbef0be5105b283d32fbf15a1b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ad5a3178a54124465c248c0fb661b4ee5cb925fbef0be5105b283d32fbf15a1b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ae04a3ad33ae5921641b3ebdf63404d5a74b3286935e721147841cec2fedc816\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ae5e4247a2961097f366fda62d9b0ed4104b106e9c4783d841617c49546a8bab\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ae5e4247a2961097f366fda62d9b0ed4104b106e9c4783d841617c49546a8bab\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ae63eda1add69d4a372b7a1996375a0110b07ae8c0a19283cd3da04cac33063b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ae63eda1add69d4a372b7a1996375a0110b07ae8c0a19283cd3da04cac33063b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"af0ec6c24987a4da4dc5c5b795f325229bdb00064e87db8c63b17b91145a58f5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"af0ec6c24987a4da4dc5c5b795f325229bdb00064e87db8c63b17b91145a58f5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"af4ac127005b6ab3548638dda6da8dcbe8ddb8a2c139d1766de907b34ab75d29\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"af4ac127005b6ab3548638dda6da8dcbe8ddb8a2c139d1766de907b34ab75d29\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"af6db883ae117063a76b00a36757ba9656d88311dac1ec8228d5456197a6ee7a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b018e10d28f9b078a4b9e90225f633487dcfe2ffdb6d1dd28fabc70c520a38fd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b018e10d28f9b078a4b9e90225f633487dcfe2ffdb6d1dd28fabc70c520a38fd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b06e76b6317585626d348e799847d4f9cedd86e677076fd9117d5fb67e79a4e0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b07006b1221af5b2a3ffd255db9b59b8ccbc9f81122d933d98bfda7feb696de4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b095be90160dea1ecb5fc109a5830aab173e280bb133cfd36e5de48545abaf78\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b0b94dd3dd8480939dbee300412961f20633f6d86db3ccabf2050c4ebb7006f5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b1063bda261988af8b7bb6c9809bc827ed1e607757e49815d7a935bd792c7b23\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b15083cec87c0c17c95d37190847ebb94357a068c2e5b4b6b5be10877a61a79d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b15083cec87c0c17c95d37190847ebb94357a068c2e5b4b6b5be10877a61a79d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b1a74afd501322dda231fc9a0fcdde416b26e0c847f269784da2411d94a7f5d0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b1d23ec12c279bd2b5e35800b54970f1bdf1750a0bc10b58a46ccfcbc5694bb1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b1d6cae38b455aeca550fd0ad1597ed18e2750eeae36803ada54329e8d237a71\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b224b423bdfc465b6327cfeb9caf2c85573366ea7c369a50aa946603057c1540\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b224b423bdfc465b6327cfeb9caf2c85573366ea7c369a50aa946603057c1540\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b2c0bde3696f8a654001c5a70a2424878745cbb055a55a0cbaa802201e0e7ad0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b2c0bde3696f8a654001c5a70a2424878745cbb055a55a0cbaa802201e0e7ad0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b2cb314586787e7b2ffc9ace5d6592ad21e746ea75998f2c6fb4beb27c7d86e7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b2cb314586787e7b2ffc9ace5d6592ad21e746ea75998f2c6fb4beb27c7d86e7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b2de81c1b7935c8cb5625327f283642d695a19e06af2c635ef87c84785380852\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b2de81c1b7935c8cb5625327f283642d695a19e06af2c635ef87c84785380852\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b33817c3565f6699be4f7466fe71c03396725222ce9a57702536832593fbdc77\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b33817c3565f6699be4f7466fe71c03396725222ce9a57702536832593fbdc77\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b34954420f7f26190828e2f966b836e7f6fe9ba64bf34d9ec69e51a90b6ee1de\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b3a745848b4f9878bce42c7eb0ec1afe7725844a2fdfbb0373fb9f9624b9ebbd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b3cd3a9fb78054e584bb73734129c0ae6ef542de97be3b5807acf6cbe08db5f1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b3cd3a9fb78054e584bb73734129c0ae6ef542de97be3b5807acf6cbe08db5f1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b3cd6283f8cdfdc9a8a09b884a77e5dc8eb1ab4e50b20cbe18a87dcac59ca588\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b3cd6283f8cdfdc9a8a09b884a77e5dc8eb1ab4e50b20cbe18a87dcac59ca588\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b3d89e99e26d7051ccbfd6b95cd4b6962bc5d7bb41740c0ddc417494d53dcf36\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b3d89e99e26d7051ccbfd6b95cd4b6962bc5d7bb41740c0ddc417494d53dcf36\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b426a470293e28c94587d9635bbe99d80b6b8980510b28baec34b88f17822af8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b45add1669563b46bfa2f7bc2bc2faefeb190448e2c434d5221f387ee16bf4cb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b45add1669563b46bfa2f7bc2bc2faefeb190448e2c434d5221f387ee16bf4cb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b45bc84185d05773b96be450ca41f551f6390f1638de17e9e9087c33dc107530\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b46dafc3a62fac3b560e8edd9564588944e325014afce45a428ed00c21d22165\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b46dafc3a62fac3b560e8edd9564588944e325014afce45a428ed00c21d22165\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b48b048cd808a7b24d690988ff84cb70db34d15eb8d3c25005c54ad3b29ee9cc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b49671affc884dc5ede0c156e669618e2edcde1fced956c7e92eea62ee49e983\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b49671affc884dc5ede0c156e669618e2edcde1fced956c7e92eea62ee49e983\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b4b1a514ac84da09adcfec5514e40a1c0f731e780c399da33c7b5ad80a001211\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b4b1a514ac84da09adcfec5514e40a1c0f731e780c399da33c7b5ad80a001211\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b4e786a3a96f9cc24fbd330c0a6abc7a44fdf2a3916e589ed06b653517b61375\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b53d3c1684bc3b95017d989be3936f9cdf9d535aef81fc78753db2d34c263d9a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b55d3aa4315df8588abe7de95abcc4583197d731311b11a62b149033a116669b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b56e14004540e55c04b666c25a9bd53e51d618d8fb0285e7caed7d8e040e2296\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b56e14004540e55c04b666c25a9bd53e51d618d8fb0285e7caed7d8e040e2296\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b56e5b9560f4d8939a73d0a6d72cde189daffeb512ba0b5c03af533ddd3eebe1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b5aa8ab6303fe01f1733936550c8269e26ff4e19b89e3732df671e1e97427806\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b5b601b5b73faffc8f9663d8a966b7d06addbe35e247daa073e3142709a2a8c2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b5b601b5b73faffc8f9663d8a966b7d06addbe35e247daa073e3142709a2a8c2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b5d8961c153194bc3331e8c165c9942ab7897d644ce8ffcc898ff9919b7a273f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b62b09a067dde81d6bacb59b0aab6f772678e97074a8625ded566c8da335a165\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b62b09a067dde81d6bacb59b0aab6f772678e97074a8625ded566c8da335a165\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b67e52cac7bb7a51e9d8a41332f9aba833c15e3cd5896675ecd927706bb72011\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b67fb2258f1cd76d574e12ef2ef4b1c9ac3bc522aedcece20a229bbaadfa7394\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b6d3a190ee7d9c22fe618cd43df4283d2f9b7f9eee988201eeb5abdaf9254b8a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b6d3a190ee7d9c22fe618cd43df4283d2f9b7f9eee988201eeb5abdaf9254b8a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b708bda582cb3c453b8a0ff341c31d5ff2316db79418060880bcdca96d4905a3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b743c030780658e545254049cf912040e0bbfe3d7c01db9cd373fb712e0fdfe3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b766d5e507fe4a8da54d0b9899aefe18ea4a5969a0ee477d74c50ee937593e2e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b766d5e507fe4a8da54d0b9899aefe18ea4a5969a0ee477d74c50ee937593e2e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b774b9cc1794163bc39cbcab5dc7faaa89d1f182af3b6ebe76fc4102cd5e1d90\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b774b9cc1794163bc39cbcab5dc7faaa89d1f182af3b6ebe76fc4102cd5e1d90\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b787110bee085ee57e4b5c1094ec5908e2f4c848d85ab1049791b114f9557f2f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b787110bee085ee57e4b5c1094ec5908e2f4c848d85ab1049791b114f9557f2f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b7ab2a4d72b9d76c3fdf5da8ea80d1d788c13482ae91646cadedc3c3fa04b351\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b7ab2a4d72b9d76c3fdf5da8ea80d1d788c13482ae91646cadedc3c3fa04b351\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b810f8b10e66549e6352aef85c3e91a368620830f79fc2f0c1d8f02623171c5b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b810f8b10e66549e6352aef85c3e91a368620830f79fc2f0c1d8f02623171c5b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b829f89bb21eeb80def156e234b073e2d32b73656f5b40055b574f703504f6b6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b829f89bb21eeb80def156e234b073e2d32b73656f5b40055b574f703504f6b6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b83324c9c95a814faf2b8edbcaf8ecc0b527627d577df8ed3d8ac8690d802b2c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b87a2777a26a6704bc9a78e636556e756cfe10e830bddec094d3321cfa606c66\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b8d97619bf9aa796f886039e860f5df15a06783b3992c09f2da0f3c59b4eea7b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b985f0a236f8fa618da05cf7f41bea134778c7f5634dc093deae024ae00d1673\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b9b1dbc073cd884e43de60a54740ac2a933bb72fc67418a78471225ebce090c3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b9c684e7ac76819af0d48bf512f15584461e975105986e410a5b70f27abd76ae\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b9e8c669cd0632c5caab476baf1e92c0b2eba6ee5fe42d55fd7ace2dd34e3ce0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b9f7a239c5354c61d1908288657bed1db2c75735fdec2e8735cba71dddf082d9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"b9f7a239c5354c61d1908288657bed1db2c75735fdec2e8735cba71dddf082d9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ba8420e86ac64e832fedf277ae96f993c31a2dd763a6e1751b551214f47adf9e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ba8420e86ac64e832fedf277ae96f993c31a2dd763a6e1751b551214f47adf9e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bb17bb3e92c64253a2efd2ca5a6440e534ca5a315a473e9453a2bbccca4a56ac\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bb1884975a6052d6d4349af2cb9191436823e62b416e253518341be4ed9876d1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bb1884975a6052d6d4349af2cb9191436823e62b416e253518341be4ed9876d1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bb18e778e6399de6d09264cb56af2377ff95422b109f2ee768ce24f3b3a04e25\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bb18e778e6399de6d09264cb56af2377ff95422b109f2ee768ce24f3b3a04e25\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bbcc99724217e318fe3eaf4026cb1232758547f9548efe85c369ec4a26a37a85\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bbcc99724217e318fe3eaf4026cb1232758547f9548efe85c369ec4a26a37a85\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bc06be26e5799ee3c37db58d6e75130b0942d427ca49a7e3d3bd77266d9dbe64\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bccdbf464dd63d979e940f52e56aa23e5b17daa212b9bbf10fec3dcd3b58b8c6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bcdad12a62679cf86849e628934070015d00121a46e578ed0e0feeb3fa95fe9b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bcdad12a62679cf86849e628934070015d00121a46e578ed0e0feeb3fa95fe9b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bd058cd6a2be72c35da186d629aaef878ea886d351cccfdfff9ee2809864fc7e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bd058cd6a2be72c35da186d629aaef878ea886d351cccfdfff9ee2809864fc7e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bd1a00c318c94718801cb07548090af2f8894b460f577e31fbefcfabc5c6c758\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bd1a00c318c94718801cb07548090af2f8894b460f577e31fbefcfabc5c6c758\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bd73bcbb8d393adc4f5120c676f4d67bd53dcc5d8b3a070745c94287db0a07a5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bd73bcbb8d393adc4f5120c676f4d67bd53dcc5d8b3a070745c94287db0a07a5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bdc16073ac24c9872eaa6a98b651361f648149442e11ce3943b381c05582e949\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bdd19b3eecdf791e711be15206ce6a15706fd96a280aa6f6eac220bc31025459\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bdd19b3eecdf791e711be15206ce6a15706fd96a280aa6f6eac220bc31025459\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bdfa051092d2babc9300f8e4cd7dd9bfe6a4997d6c1e07e9143178f9580a0481\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bdfa051092d2babc9300f8e4cd7dd9bfe6a4997d6c1e07e9143178f9580a0481\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"be17de87dc6cc7ce502b3d520bea286347f5b10c5adac50263e75f951362cbb8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"be17de87dc6cc7ce502b3d520bea286347f5b10c5adac50263e75f951362cbb8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"be26967b810b7fb9ded92f4680e73187514b47f71a7bfcf030dcf56ae4354ec4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"be5b1cf2281e0e9a1b103e18ee725939d436d3a7d1a7ab5d1251ebaf7ad93cc7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"be5b1cf2281e0e9a1b103e18ee725939d436d3a7d1a7ab5d1251ebaf7ad93cc7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bebd8cae739717fa4d7310d43392800d6a909848ad6db670d69f39d31b65f24c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bebd8cae739717fa4d7310d43392800d6a909848ad6db670d69f39d31b65f24c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"becad120746afbd01c3ef82573c4ac6a4cba9f9923058f573ea61e29f60bef9c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"beeb92632f365fe4c66c99e779f2a2023c5327d1cc48fdd15c9181de206c9bb5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bf0a9913cace279d3af6cce68d812b882220263cd7fd71db06f98184285820dc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bf5c70d8885ff9277ec3288db6a73bcef1bc0d8543324214f464bdc1945406a3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bf5c70d8885ff9277ec3288db6a73bcef1bc0d8543324214f464bdc1945406a3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bf694f11fd359fb79778de9aab9be32761f4677cb006ee4a98cf306d06586b4c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bf694f11fd359fb79778de9aab9be32761f4677cb006ee4a98cf306d06586b4c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfa66f05f098539a0adf3ef352165ab924d6a6ef4f0d237b7e8c87d769dfec1b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfa66f05f098539a0adf3ef352165ab924d6a6ef4f0d237b7e8c87d769dfec1b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfad3de231296e59d577dda7ea989f8ef3ec7c06bee3c8ceab3f6a6a3bb2b9b1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfc76a529ce1925c33fccfe3d12ffc6c08345442791503ec172889dd4bec27e9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfc76a529ce1925c33fccfe3d12ffc6c08345442791503ec172889dd4bec27e9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfdd597d3710daebdd8d2a624cab25f0af3c9780d84748dcd2f753bf87cd27c5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfdd597d3710daebdd8d2a624cab25f0af3c9780d84748dcd2f753bf87cd27c5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"bfe410bf701133744e8630380b6efebe601fb6c53aef92de723c219c9c7bd7f9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c0e0740c3e13754ed94cea9038ee42b78b8286b9e8b5e92d71f10908db787254\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c1390606a734274e8f175f55e6c0ad62c8c9c6fbb9856f2067db107c15835681\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c1390606a734274e8f175f55e6c0ad62c8c9c6fbb9856f2067db107c15835681\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c18e0e0cfd53d38cf65fb811a8a54af6a08f36a6fea1638052e8643f8b12b6a4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c18e0e0cfd53d38cf65fb811a8a54af6a08f36a6fea1638052e8643f8b12b6a4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c195f015d88a6eff5f8f099d06a7570a5d055a83df1b1a32113cbb0eacd10bce\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c1b8e5839a60e9d19dd8d5773daf5ad552698df17d95a4f539fbf0ae2b841050\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c1b8e5839a60e9d19dd8d5773daf5ad552698df17d95a4f539fbf0ae2b841050\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c1c452bacc0004c8b058b1beb6d97038a95749c357297a3f5cebba2f0a5feb63\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c1c452bacc0004c8b058b1beb6d97038a95749c357297a3f5cebba2f0a5feb63\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c219f090a8c38a00035b7071e18ca19e9b36f38895ade8b8fcee0cd127358aa5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c219f090a8c38a00035b7071e18ca19e9b36f38895ade8b8fcee0cd127358aa5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c22c3ef6229d9a225f62e09cab34398436aa5dc20da80c979262905465e5f109\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c26d391f7401643f07dcf950f8742844278c168cbbdfc140709957c4670503e6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c26d391f7401643f07dcf950f8742844278c168cbbdfc140709957c4670503e6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c27a29db4de3a70f40b485a8cc5e806698e8dcdd944fbcfc97b1e27a1cb682ed\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c27a29db4de3a70f40b485a8cc5e806698e8dcdd944fbcfc97b1e27a1cb682ed\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c2a3abc6b085765c074c60af17b92c76dccb6566bb3aa3215ebf1b01f13092f1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c2a3abc6b085765c074c60af17b92c76dccb6566bb3aa3215ebf1b01f13092f1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c2c730d2714a6c30d24fd2e0bdd0e7964312c8fd1cabadee23e2c14c4c9b4e16\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c2c730d2714a6c30d24fd2e0bdd0e7964312c8fd1cabadee23e2c14c4c9b4e16\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c3538f527c0167ab34baa366aefc27e95bb69a651c07d3f8f34f070c21f6d8f4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c3538f527c0167ab34baa366aefc27e95bb69a651c07d3f8f34f070c21f6d8f4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c36522995d12d5a05a8ede4b6db764c5767d27f549c003b4589f8d7ac3cdf05d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c36522995d12d5a05a8ede4b6db764c5767d27f549c003b4589f8d7ac3cdf05d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c4333b74d1a5d07be3b697bfbaa3f11cfcf894431bddda5f1278d8640347b57e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c43aec554fa65cdc2b1ccdaa467c7b9ea33aaa37503e00cc41f6ca38255a9db2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c43aec554fa65cdc2b1ccdaa467c7b9ea33aaa37503e00cc41f6ca38255a9db2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c4861cc6ccdf538d44444ab422be8e2f33c4bade36f6847dcc8fc114d6d0e1c9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c4add2bc61ffe21158912b43614c234b0b4ef937bc532a961041e05f823e466a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c4dc132629f6e7e4ec1ef35ae6d4efec060292dba5b187f2bdc004f54283d0bb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c51a96f8b0ce6d000b267316d8bdbfe733e8d4e2a4165871a9fe9a71109c74b1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c51a96f8b0ce6d000b267316d8bdbfe733e8d4e2a4165871a9fe9a71109c74b1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c52bfafb9e23350846391149691c5bedab066adf2ab7bec407de492125024124\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c596a8815125072fff1ff577f66a3a772520258b7fe9aa7eae380031b61d8c73\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c596a8815125072fff1ff577f66a3a772520258b7fe9aa7eae380031b61d8c73\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c628a737aed380f79be65e9dc151963bf1cf13b398eb714dd6d0fbbd67f424b7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c69f4f37fdc4b1b58d69413d3b85fe7743706a7c1d5bcea45e9b6222e1600998\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c69f4f37fdc4b1b58d69413d3b85fe7743706a7c1d5bcea45e9b6222e1600998\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c6a6d79116d7bae68c5fcc4e752a9ba4000ceac6ce05bed43cd23e6addc29bc7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c6a6d79116d7bae68c5fcc4e752a9ba4000ceac6ce05bed43cd23e6addc29bc7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c6ba421b1fed9d1127f68a628235cdd5c7d3e7ed30b4e539b70ac40b94814d84\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c6ba421b1fed9d1127f68a628235cdd5c7d3e7ed30b4e539b70ac40b94814d84\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c6c443d49b41af350f10a4ef3f2d59783bceb56605e0252ba18d17c2fd67fb8c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c6c443d49b41af350f10a4ef3f2d59783bceb56605e0252ba18d17c2fd67fb8c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c6d1d3cb34c514190a99213b0601de612af42ac477ff5cffbc3641742540785c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c7244a0c1c142739267639d8cc3fda3c7396a95873df132126da4ddd2fee4075\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c73ce0cb4673eb1405eb68b1c6063e04e2a5ee1e301232cd803bda860e45b2e8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c75e5c5646efc15b227508eb0c1f57cf006254e74890558ff359378641ef5dc3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c80446a75b926ee0a35adbb58953911c844c05f54c93cbda734c2419b726dcf1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c80446a75b926ee0a35adbb58953911c844c05f54c93cbda734c2419b726dcf1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c811d237e4e24c5e84bc69807eb23f9a3d56fcd862937d4e87a0cd01f21a2564\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c83fc7ab4b6b0860545c1d06d5cbf0754e19b283adab6d301c80aa962ae084e5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c88a7d807f95a03e94fc0f8da6c1fecbb9f3d32f4e414846b502fdb37238f480\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c88a7d807f95a03e94fc0f8da6c1fecbb9f3d32f4e414846b502fdb37238f480\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c89751a65975168177aeea2c15778b50142ffa572291448e0aeec09e1d2ef572\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c89751a65975168177aeea2c15778b50142ffa572291448e0aeec09e1d2ef572\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c8c52830f536f0c95cc8ac94fc02fb723457ef4cd702c812eda32666d1c05f17\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c8c52830f536f0c95cc8ac94fc02fb723457ef4cd702c812eda32666d1c05f17\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c8d298fc3d2ea7c7954e0afc0b5c918b0ab685b077a223f0de87e66ac2e683b7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c8d298fc3d2ea7c7954e0afc0b5c918b0ab685b077a223f0de87e66ac2e683b7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c8e9f1f9d6e69f4def12da6cd92c4f07a7c1f08ab0047e664abe45295f05142a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c8e9f1f9d6e69f4def12da6cd92c4f07a7c1f08ab0047e664abe45295f05142a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c90ef905c7f29ba823c208b0cda2cd09646bceef523a0a91f04210649c8f6c0f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"c90ef905c7f29ba823c208b0cda2cd09646bceef523a0a91f04210649c8f6c0f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ca1e645af1f7340ded2d71410a54bdb07932c0e1a84f2bf31a60c7ddf552fa3d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ca49119b314a7557370ce1d0db4b15a3bb8c5f313e34a45cbecc2048485dfaa3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ca49119b314a7557370ce1d0db4b15a3bb8c5f313e34a45cbecc2048485dfaa3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ca94eb10b4fc9e70826964060712a64989acb2cc21e3db0d1c5f8153e8647b73\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ca94eb10b4fc9e70826964060712a64989acb2cc21e3db0d1c5f8153e8647b73\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"caa2275e034bd11d8d464ea3b613c585044504b4583450e527d5681976a6b009\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"caa2275e034bd11d8d464ea3b613c585044504b4583450e527d5681976a6b009\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cb098e4a084189fa762357bbfdef9998a008557599b7a431c9c6ad6189df69e7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cb0d426f88887d4034ae7e507da54f0764dfdd027b04ce1bb5a6eb40b8ffbb7e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cb0d426f88887d4034ae7e507da54f0764dfdd027b04ce1bb5a6eb40b8ffbb7e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cb3daf843f1c09fcc41573e776f59329661077afaec038755c0a0a6a9b78ac7d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cb7b5dbd1eea03dee6ed77da080a8bb737b78ea8b0b68afbacd82bde1a447985\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cbb89f66196879b92e8a4145835026fd261c313739158e15aa439c09830a8875\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cbb89f66196879b92e8a4145835026fd261c313739158e15aa439c09830a8875\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cbc8b1ffdf1fd3dc8e79328723f0fc75996deae69d8c36be2c315663c0d0da79\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cbc8b1ffdf1fd3dc8e79328723f0fc75996deae69d8c36be2c315663c0d0da79\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ccf0ec5a3c5af3ab5807346922f85b7e0adbe3594e6561c77d3a80f43f51cbdd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ccf0ec5a3c5af3ab5807346922f85b7e0adbe3594e6561c77d3a80f43f51cbdd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd43a3185b9c63c74ef3c51e75f7958875f0ea7623fda47955364f3320acf6b6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd43a3185b9c63c74ef3c51e75f7958875f0ea7623fda47955364f3320acf6b6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd4f629d985fabfb1658db5fce2319f6374432344fe55674a84d4dfbe3887f3a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd4f629d985fabfb1658db5fce2319f6374432344fe55674a84d4dfbe3887f3a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd584797eff833d1eeca42e7226f67caaa8ae4fa1fd77cb09a720e472f38bea6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd584797eff833d1eeca42e7226f67caaa8ae4fa1fd77cb09a720e472f38bea6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd5dea3a9f11a68a4ca38de01814268ec0cd3349e20a075ba6d9a9600021d70a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd5dea3a9f11a68a4ca38de01814268ec0cd3349e20a075ba6d9a9600021d70a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd9c7de770746850a5c826527151f7b38c2b8cb9fe1c202ec4380161bd532381\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cd9c7de770746850a5c826527151f7b38c2b8cb9fe1c202ec4380161bd532381\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cdb7e430981358a356131c77d93f2db1219ff9c0473077494a55d8fc5679b1f2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cdb7e430981358a356131c77d93f2db1219ff9c0473077494a55d8fc5679b1f2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cdd83d7d843fe2b7bac04fbcaf0bbaea155661b7ded34c0e1b67d39890f2d038\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ce0287a5b058492d25ff0bd6635540b953f19cefa95ea880054e8162ac1f228c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ce9a1294400da1a2a434e31ba07e86e15b1bbfdbce7f67eb6f8f044c296b50a3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ce9a1294400da1a2a434e31ba07e86e15b1bbfdbce7f67eb6f8f044c296b50a3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ceb514a72f2ae9599fcb22ee30162ba8833a39160e2dc21a2f03296ebbc6c6c5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cec2c1e893366588fe7bd8d7d8f7c4430216890122362fe698fdc5dd7763e27e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cec2c1e893366588fe7bd8d7d8f7c4430216890122362fe698fdc5dd7763e27e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cec6842760cefe0d744be627e45b22a06640984e7d15610eb6f5cf6685844dd8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ceda5647d3259d47de91a79a1b3c559119fe2d4f08dfc24a061291c1dbd45e74\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ceda5647d3259d47de91a79a1b3c559119fe2d4f08dfc24a061291c1dbd45e74\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cee99c73193e17894de50dad3f857be837ee5124e93757c6eb60db99ad9dc783\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cf47d8f022100422f4bc8dfcbdb276f048ac01847020f4ab4ae1cc3eccb70957\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cf47d8f022100422f4bc8dfcbdb276f048ac01847020f4ab4ae1cc3eccb70957\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cf8180211e5a74253931ff031ae6d22c2ea4a278ad271acc64156ae37e489961\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cf8180211e5a74253931ff031ae6d22c2ea4a278ad271acc64156ae37e489961\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cf89118479d1595bf0cb468c18e3b732aa3f298c80c559c5e284dcb32f05dd6e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"cf89118479d1595bf0cb468c18e3b732aa3f298c80c559c5e284dcb32f05dd6e\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d01b9debad7a8f2f7cd9d11e5a1eafd77863b0108a7ec3738377ff255c9aafb3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d01b9debad7a8f2f7cd9d11e5a1eafd77863b0108a7ec3738377ff255c9aafb3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d0b6ec0413d08a2def7e1300c7dfcd71773a54d2addd91448628a22c8e48a6e0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d0b6ec0413d08a2def7e1300c7dfcd71773a54d2addd91448628a22c8e48a6e0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d129b29dd54f4b4a2f7e358148a06ad742235942a2937fac7676fefe1e481f36\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d129b29dd54f4b4a2f7e358148a06ad742235942a2937fac7676fefe1e481f36\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d14b70fbad9e9c0d6276d265d65b28de5891aa25b57770f17ab1f44cdc795db3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d14b70fbad9e9c0d6276d265d65b28de5891aa25b57770f17ab1f44cdc795db3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d20e2b27524ae5e0ae6bb88bda962b6be52f9de3dd01119799983d7bcf63edda\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d20e2b27524ae5e0ae6bb88bda962b6be52f9de3dd01119799983d7bcf63edda\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d21d1be0078efea5354bd7c8be32d1f401f50aa3e3e8fef1f3903d87f2972594\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d21d1be0078efea5354bd7c8be32d1f401f50aa3e3e8fef1f3903d87f2972594\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d26e7c779feac7d034d4458f1efa0483394c4eda3d13c04f1ab0534237441d06\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d2cb1023435f02dfed4b59c3df6c6940b9222ffa7c1c172a41b1260dbe1e03c3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d308e352332ed6e05c806e52b23b5bb50a7349a35d6d72a1b8a5c30f3aa6ba98\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d308e352332ed6e05c806e52b23b5bb50a7349a35d6d72a1b8a5c30f3aa6ba98\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3596c441f818c00dd3364253a0e7665691993873c70a2fc8e60bfc3205157a2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3596c441f818c00dd3364253a0e7665691993873c70a2fc8e60bfc3205157a2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d38f9b57764b36dd20b7fd8302110dadca3532e4e2e03ef17a355d0a5a00df0e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d38f9b57764b36dd20b7fd8302110dadca3532e4e2e03ef17a355d0a5a00df0e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3a1580be28c4eed3d10cc765a7d8100789b42dec383ce7c6307d2845662fe6f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3b1a559f02bb02b1c24e572204899d2191c411341eca5b7ac887fb782ad9e93\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3efce64fe3882c13438f540bdd37d56f53a2d60f590194aa6bf4892eddb776f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3efce64fe3882c13438f540bdd37d56f53a2d60f590194aa6bf4892eddb776f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3fabd32237b179b8cbd04559f52951fe7f102a7e879e20f50a69c6d88a7b49d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d3fabd32237b179b8cbd04559f52951fe7f102a7e879e20f50a69c6d88a7b49d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d40e350bf75c4bbe8a7c6045502ec777e61128b404c13e1576e2005730546d81\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d40e350bf75c4bbe8a7c6045502ec777e61128b404c13e1576e2005730546d81\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d4a149540a6440a00bffe196349aae1c12828399109651a4bf47c178e1b45b27\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d4a21d736af5dad8b3e6ffe3e3a625a24d1ad6ebf2c43ac75314d62627e429e8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d4a21d736af5dad8b3e6ffe3e3a625a24d1ad6ebf2c43ac75314d62627e429e8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d4bda8fb7c36c11fed6ca36f46cb85c55061054da538b84b47e1fcf83023ca13\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d4bda8fb7c36c11fed6ca36f46cb85c55061054da538b84b47e1fcf83023ca13\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d4d4d2fdc6cb51e99a01d491f0e20159caa5172960bc259d050af920fd413b55\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d4d4d2fdc6cb51e99a01d491f0e20159caa5172960bc259d050af920fd413b55\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d53908b8644f3c41c0cb45e6a790e95c5b380b9818e2c59dfc3d6ca40587b0fe\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d53908b8644f3c41c0cb45e6a790e95c5b380b9818e2c59dfc3d6ca40587b0fe\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d54f5ce88490e0da743c2124f335a6f79feeac0dfa52b1566deb88c70dfcfbee\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d550a43130242c6fee4e9ca2883890775dbf70d2e1ff4a42a8f185e92a21df44\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d550a43130242c6fee4e9ca2883890775dbf70d2e1ff4a42a8f185e92a21df44\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d59b5c13af2bf192028567021e93fde8b7b524eb782183363d3a990204dede57\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d59b5c13af2bf192028567021e93fde8b7b524eb782183363d3a990204dede57\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d5d7adb58a54c6f7f210f467d8f55863e88140c075462c4ac622be0ead5a463c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d617bb33082f9cd4074e1994eee3f208c1b3e910590a6213077f57f91d7a7220\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d617bb33082f9cd4074e1994eee3f208c1b3e910590a6213077f57f91d7a7220\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d61eae768d453e45caa2a3bde4ac2c18e5acecff6d062344d339bc8e9024f623\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d61eae768d453e45caa2a3bde4ac2c18e5acecff6d062344d339bc8e9024f623\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d7289dd0f83e5a52582c2273cd20f8b6a131f8d90a07e8014baaf9be7a334b00\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d7289dd0f83e5a52582c2273cd20f8b6a131f8d90a07e8014baaf9be7a334b00\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d76d86ec8a11d7e590620560274a2e8660f3516a9eb21a0632abe7c9c787cd95\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d76d86ec8a11d7e590620560274a2e8660f3516a9eb21a0632abe7c9c787cd95\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d78b3f9366f4a4f5db58818f474cfe4699d0638c45ecfb9715399c5c686e63f6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d7de918fe1bd71ee60118b1ed59ad91d3cfbb1be95bbdff33fb06955551af990\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d7de918fe1bd71ee60118b1ed59ad91d3cfbb1be95bbdff33fb06955551af990\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d7e18e4c093d120549bef64c7745e9dc271c6ae59b96d3d54741446e5a8cbbd2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d7e18e4c093d120549bef64c7745e9dc271c6ae59b96d3d54741446e5a8cbbd2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d8a1c2d72ac8b2076a2eaa7f5a451d89fbff9d422ce7628c96b3dc984ce0ff05\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d93149f195af396f1fc509db8b866b4bf74be7b64308ffba8e1724b3f3848869\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d93149f195af396f1fc509db8b866b4bf74be7b64308ffba8e1724b3f3848869\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d9590bdce161020ee7412d5bcaeac8478be1bade58c1c730f2277ea92588873a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d9590bdce161020ee7412d5bcaeac8478be1bade58c1c730f2277ea92588873a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"d9f8985e249884063c6d5e7ae87155f54b64bd5c6420ef06b68e4e1fa5a5211e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"da284d09b58348556e605d1b0556d86659d94afcbfa48ff34f73bb8244004ad1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"da4a5486633a3da02a17d16436c9f3587c7751e5e0e6c7810faa99eb8a3aea59\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"da4a5486633a3da02a17d16436c9f3587c7751e5e0e6c7810faa99eb8a3aea59\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"da6ecc4a6fef24b06ed14a93dafc8f559a2bcf282b347ef93d4732d1e5ad49a3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"da7f674d51f3bbc1d3cedd48e80f1895d893dc1161d7b840d5a0189202195022\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"da9155a7cf03a2daa0f5208688a356a6bcec979aa9c85f6251ee9b63bb933155\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"da9155a7cf03a2daa0f5208688a356a6bcec979aa9c85f6251ee9b63bb933155\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dabff835bb4aedf7717d5b723d8b0c7325fe522a649c9ceeb52293264020693d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"db3c18efaa65eb30976ebf7ae2072fae9beda2ee5a3456c84cfeb2e657d8981a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"db4377dda3d5281d768b23740abb812ff1ec85089f3f21392918e1112ed4508f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"db4377dda3d5281d768b23740abb812ff1ec85089f3f21392918e1112ed4508f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"db54f0b2d978c68d6619281949ddc445f56c13206a0483d70d6710be3010928f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"db54f0b2d978c68d6619281949ddc445f56c13206a0483d70d6710be3010928f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dbbd0191b33bfcb1352f3f1c9f59753770ffbbfc7fc61c721fc58acdbf3c94ec\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dbc70ed820dc2f0f12f2ccfd949aa65f6674dd5827495b6120b72144ac3ed18a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dbc70ed820dc2f0f12f2ccfd949aa65f6674dd5827495b6120b72144ac3ed18a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dc7fa3fe778c8cd7e345d9dbb9b61c7011f52b7a6671ac4700acecbfd4fbd443\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dca6075f7c5ff80d53d977316d60488e3a654ce917c031e6f04af55779778d50\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dca6075f7c5ff80d53d977316d60488e3a654ce917c031e6f04af55779778d50\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dcc42559e5b2f5ff71d35cb6740790c23c63b5314edc9e0de265f0d9f1d4461f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dcf359021b6d536317f390652b328619d3738b2217bce3b9c27aa81d33bed521\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dcf359021b6d536317f390652b328619d3738b2217bce3b9c27aa81d33bed521\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dd09599622463c502322fd15f55651d5c7c3db7deda6abe0a0792828f7edfb4d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dd09599622463c502322fd15f55651d5c7c3db7deda6abe0a0792828f7edfb4d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dd716f997c988e39e3e4e6848f3efa1a5dfef26040220f140d622579166a17ee\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ddddc29fa950a163b041c92a6b07cd429e824a2e89c7df66cbd3ea85b2692511\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ddddc29fa950a163b041c92a6b07cd429e824a2e89c7df66cbd3ea85b2692511\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ddde91527aa587d9c7095f22480f9639fdc68677dd895ab9127d5340671f0d8d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ddde91527aa587d9c7095f22480f9639fdc68677dd895ab9127d5340671f0d8d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ddea6fdf1d9b1a443e9d5f3164d2e06f9cc1106bd817121b6f96249958084e92\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ddea6fdf1d9b1a443e9d5f3164d2e06f9cc1106bd817121b6f96249958084e92\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"de1ac60603d78fa6b6889870cf01451e7c864503a82d2f52a1b33ad37e849959\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"de1ac60603d78fa6b6889870cf01451e7c864503a82d2f52a1b33ad37e849959\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"de2cc88c885eb34cb2c62e2bd3085f6d683f5c5d94170e5f97842542a9815902\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"de36d28a6e1cb739b7a1e5d90cabe1fe40539912ee9053eb5b09b38d1942f16f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"de36d28a6e1cb739b7a1e5d90cabe1fe40539912ee9053eb5b09b38d1942f16f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"defdd76a23abb5b7875c78c37f068b601eda22c50e0f86e16787085a8629e3c5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df0047b50d1035e471e9d11d1334e6b95cb2eae93dae35e5d79592352373bc02\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df0047b50d1035e471e9d11d1334e6b95cb2eae93dae35e5d79592352373bc02\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df08eb9c7db5f119c84525cdc50aa145f87bcb300ad5bf0e84b8a2cb691b9817\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df2847cec96be42f94818722f41b2db75ce0cbec627eb78d5f617bedb58fe433\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df2847cec96be42f94818722f41b2db75ce0cbec627eb78d5f617bedb58fe433\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df494494825744b0c86c3326a32f204701e34737f1cc05f0a3d493f89a00990f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df494494825744b0c86c3326a32f204701e34737f1cc05f0a3d493f89a00990f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df664562b35697a3282a16f46b7888b83e005e93a94555758bb3c31d25e3f0b1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df7155f1e4dbb734ebe6411bc96f9a4274a4b2069d0d456198836bdd5ccc50cc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"df7155f1e4dbb734ebe6411bc96f9a4274a4b2069d0d456198836bdd5ccc50cc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dffae00e0057727f18fa32eb7039f9b8b0ce42531ac69c1ba3b70b4b2d8c9d83\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"dffae00e0057727f18fa32eb7039f9b8b0ce42531ac69c1ba3b70b4b2d8c9d83\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e04ab336e8f4c7df454f04a76e27533e7b4d48a99279758aa6614e2a0619f7ec\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e06bc37fb1296f87aea6e79d194789d4444a8adbee41407e2af06673e9ed3fd1\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e06bc37fb1296f87aea6e79d194789d4444a8adbee41407e2af06673e9ed3fd1\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e0bfe37c9fed2cfb4babecf3089c9a01ca0b20fb7b6ebb30318b2d7ed159d13c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e0bfe37c9fed2cfb4babecf3089c9a01ca0b20fb7b6ebb30318b2d7ed159d13c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e0c1701b1aa692d7373b4439b58814a2747f862e1cfeed81fb906ed75e03299e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e0c1701b1aa692d7373b4439b58814a2747f862e1cfeed81fb906ed75e03299e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e0f632361a4237b0f67ff890b5027db0d22f812f60a62fade39fb4915d3bca94\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e0f632361a4237b0f67ff890b5027db0d22f812f60a62fade39fb4915d3bca94\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e1392e1583180e67d2ee5337cd3f0c22053943193e0ee9419c109a15707f0ddb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e155228e471f9e58e9d7991e4352dd6d92227c0a2f34888f68a265fe8c0dc033\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e155228e471f9e58e9d7991e4352dd6d92227c0a2f34888f68a265fe8c0dc033\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e19970465d03f9959e01f3b622358bf46a68d471a4f6b701e69e536cb21a614e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e285e1c3a5018eb875a4fadec2b482b88e59546fff8447e43e7e1b12cff6bc8d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2a9acdd1f279ff6a955925c4f41cee2ab0512183ba89c3761acf4a5ace90baa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2a9acdd1f279ff6a955925c4f41cee2ab0512183ba89c3761acf4a5ace90baa\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2b148721bd4afc2b8898e5e0bc68c36f4e639473418d770b676b4d8aa29adcf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2ba402d580acc288d48deb07b5190b36c2bdbb8a74a0195b97c1f837d5bd24c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2bf83855ff1260ddffca69728b79524ecf6804c0935f2c2e584616ecbd7d549\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2bf83855ff1260ddffca69728b79524ecf6804c0935f2c2e584616ecbd7d549\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2e91670786874cd4dcecf1597be5e23b1f9ec533f45670ecb73274fe040da32\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2e91670786874cd4dcecf1597be5e23b1f9ec533f45670ecb73274fe040da32\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2f65f395955aa117b40345232ee5d662fb2b1a99555a846f69a1747a2417b8b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e2f65f395955aa117b40345232ee5d662fb2b1a99555a846f69a1747a2417b8b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e355bed94ee9520895d1cedcc3e9c5f14d962ac1006e4314c190ea26ba229a67\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e355bed94ee9520895d1cedcc3e9c5f14d962ac1006e4314c190ea26ba229a67\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e35f54b7d398c6e3862bd4b052da89c2e867f97b8b9448766290897b30369972\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e371e5394603accbddf9208790ff7599f8d67b5daf0d2a0041c327bf13070bd7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e371e5394603accbddf9208790ff7599f8d67b5daf0d2a0041c327bf13070bd7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e3821d74ab5e7d2f6f08ae1975d9d92451b60dea5fe7875c5a9a5b745d4a90f6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e3821d74ab5e7d2f6f08ae1975d9d92451b60dea5fe7875c5a9a5b745d4a90f6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e38338f78e41e1304c58bf73b7ee3d3f76586b8c909641d929e7d0a595a4044c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e38338f78e41e1304c58bf73b7ee3d3f76586b8c909641d929e7d0a595a4044c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e38bc5d19be4d15493d81655c8077fd5f86ca8ed33258ddad9d561a576f80ffa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e38bc5d19be4d15493d81655c8077fd5f86ca8ed33258ddad9d561a576f80ffa\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e38e99bd62b6b8c178aab34d5cab1334f45fda54fff5b2c9af8bfcb237ff55ca\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e392f1b5877a554954df8b84a349252b91db4f06fe00f9f2b0f38906c6060a0a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e3d4fbc141fd6d9a23c4df2e5a6cb520bcac624b31512ac9d546312d4c957af5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e400c331e876818ab15f74e60292f935995f5fa77bb6619284c1ca5f67f50e1b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e409bfddb916606553c4fa87e1ff030f6f6fa00e3caee03b1ebe371a4d6a07ab\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e438a25429d1a6ad008e808796f231848532acd0ce730436c9136b53c22e73a7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e438a25429d1a6ad008e808796f231848532acd0ce730436c9136b53c22e73a7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e4a765c940afbac650ffe661153b4e719a0326fc1c87d20185a7862ff772e9eb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e4a765c940afbac650ffe661153b4e719a0326fc1c87d20185a7862ff772e9eb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e4efac582d63a964f6a932426fcbf7c7a26072d73803548055a01ac2d64eaad5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e4efac582d63a964f6a932426fcbf7c7a26072d73803548055a01ac2d64eaad5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e5025b2ca865ea2e23e3e71015f29083559a8e67afc3ad6b056f8d24aca55f2d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e507a89623fe0af85de3e5dd62edd00a506277488c97ac9d21aa617986135eba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e507a89623fe0af85de3e5dd62edd00a506277488c97ac9d21aa617986135eba\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e57710c11225e45c173a960221edc25c83f107fd15fc528ee47e10788d4846b9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e57710c11225e45c173a960221edc25c83f107fd15fc528ee47e10788d4846b9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e579d07c3986d83e03fcb029d9f2b10ac088c32f2eab380b775c218fbd380c31\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e579d07c3986d83e03fcb029d9f2b10ac088c32f2eab380b775c218fbd380c31\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e57d393f8b1a5141fcf66149cef2d09c05fecc052b96c126656211df4dcba067\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e57d393f8b1a5141fcf66149cef2d09c05fecc052b96c126656211df4dcba067\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e6f67985a957b67a91044ab2fcc9987cc4ac1ff185610437e5dd7695e318b24b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e6f67985a957b67a91044ab2fcc9987cc4ac1ff185610437e5dd7695e318b24b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e7e16a7df47f41ba1ec3653bb5f4d8e84fbaa6d2ba0696fe675b4781e930899c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e7e16a7df47f41ba1ec3653bb5f4d8e84fbaa6d2ba0696fe675b4781e930899c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e85cbcf8e30ea30f8d3a37ea08da714ab129af104bb08a9e8abeddf4f2626cda\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e87c35505f0adbeb4d8e4af3bb5e1c32075e87660b6d3f1f1c9ba9accc547507\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e87c35505f0adbeb4d8e4af3bb5e1c32075e87660b6d3f1f1c9ba9accc547507\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e89e864b9d18a06be1a32f5876f22874af435a92dbee70c674a09a770ae3fe9b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e89e864b9d18a06be1a32f5876f22874af435a92dbee70c674a09a770ae3fe9b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e8bbd9ba2c2dd5a30062fb45adfdf74004a077e3104a10af8e7f9e7aed259c4e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e8bbd9ba2c2dd5a30062fb45adfdf74004a077e3104a10af8e7f9e7aed259c4e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e8ef4ced962ab8dcd1808c633cc03542f36f94f3e009883da4d956f97bdab072\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e90a8da17dbe955e1e739495073c37e9d17b9d8b5f3c57b7d9e6c9b41b5e7806\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e90a8da17dbe955e1e739495073c37e9d17b9d8b5f3c57b7d9e6c9b41b5e7806\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e92158cfcc390a64415f36fdf17dbdece413e4e55eee017aebb60226e852c1e2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e92158cfcc390a64415f36fdf17dbdece413e4e55eee017aebb60226e852c1e2\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e92fd5c27b38503c286aa3871a0912a7f61b6a253c96e1ff6100247753a0514e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e9c30a8a9c68c776b82a73aa4510cfc53bcfc8ec80ec447abc6e5ac961598cac\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e9c30a8a9c68c776b82a73aa4510cfc53bcfc8ec80ec447abc6e5ac961598cac\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"e9de1d488ce9cdf97f4887d0e98c99ca3cc15ba3df468f040820c3322f156857\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ea069f8ac6096fdb6a0fe13d4a457a20dffec2f69e22469506b3ecbb8c0544eb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ea069f8ac6096fdb6a0fe13d4a457a20dffec2f69e22469506b3ecbb8c0544eb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ea9f1a9004bf61053aa026931fc5c2ec0853c94e418c04c22beb6b88e93dbf4c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ea9f1a9004bf61053aa026931fc5c2ec0853c94e418c04c22beb6b88e93dbf4c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eb394a9bf15fcf34004ea86d4d3517a67ab2fe43d0f4bcadc169f6aba1fd6334\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eb394a9bf15fcf34004ea86d4d3517a67ab2fe43d0f4bcadc169f6aba1fd6334\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eb523a3d692347befa7021a8338dbce56b36d1d03f513503aaaab08da6bdb941\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eb523a3d692347befa7021a8338dbce56b36d1d03f513503aaaab08da6bdb941\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eba6e81f599a55f44a80f2bbc36aa2f5eb6f582c3558b1122f3be5aebdf5a2b4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eba6e81f599a55f44a80f2bbc36aa2f5eb6f582c3558b1122f3be5aebdf5a2b4\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ebab71a510cabb9dd7ba5646ad2706ffd85fd3ef538dff2feb4aeb606df5b03e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ec1a40654a868737cda76b1d77c9a003060ffd7fa938323ead8233f2fbdfa10f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ec1a40654a868737cda76b1d77c9a003060ffd7fa938323ead8233f2fbdfa10f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ec56dd89cec7ebc236d1f127c32357099236b76104c3c2d7f29acc948e67d7ad\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ec56dd89cec7ebc236d1f127c32357099236b76104c3c2d7f29acc948e67d7ad\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ec6889a604d8971591e05f6d01bdc2789615103a86db75a7ea01c7ce7e9d3d56\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ec73649f8cb12c4cadc3fe5f4765feb9d783e0c7f70993a90c88cdcca4fad0ad\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ecbf018ca42347f067082016964bdc63769dd26df9eb24a0d0d2d651fcdb4c17\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ecbf018ca42347f067082016964bdc63769dd26df9eb24a0d0d2d651fcdb4c17\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ecf5c60db8b16686ac68452883ce5a53e7c866e3ebe864d6e17393d082dfc3fd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ecf5c60db8b16686ac68452883ce5a53e7c866e3ebe864d6e17393d082dfc3fd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ed3e1d4485fc2bb02a68e862413b1f52b2fc2ea0ebe52a33bd819e53470c91cd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ed890fb44dee6e293036116d775e281e734d7ac695b7678e68d98f086756d7aa\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ed890fb44dee6e293036116d775e281e734d7ac695b7678e68d98f086756d7aa\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eda3b9a64f9bbb930b6bbff1c1397c88fa6c75ea1cf576a92f84b17e87ecfba5\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eda3b9a64f9bbb930b6bbff1c1397c88fa6c75ea1cf576a92f84b17e87ecfba5\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"edaae0ecac1b1f02273069c95de214bc5116b46d6f5f432b9050924c7c920bf0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"edaae0ecac1b1f02273069c95de214bc5116b46d6f5f432b9050924c7c920bf0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ee2143d0efad27f2af65866218e92e0ce74bbb6a0f72542a5707a553ae4a6cba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ee2143d0efad27f2af65866218e92e0ce74bbb6a0f72542a5707a553ae4a6cba\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ee21e82fb71757839e8bdb0fb14bce747911922402d0680d6122512e45512959\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ee4548d056f0c6f5eecc02fd0d0274a9c5bb6819196e4d2be7183f183e9ea8a8\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ee4548d056f0c6f5eecc02fd0d0274a9c5bb6819196e4d2be7183f183e9ea8a8\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eed388fb3a9423bc64743ef5e61e98d11d3b4e1b2e27cfee0e008aaf646a1f73\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eed388fb3a9423bc64743ef5e61e98d11d3b4e1b2e27cfee0e008aaf646a1f73\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eed937b31de430f26e5983f2c59410ed4368280ee8b916626ed33420db85335a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eeecaa503c50df22a85de6b2298c2a3e39a66d5ad8ee9d177c95d56f7426325b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"eeecaa503c50df22a85de6b2298c2a3e39a66d5ad8ee9d177c95d56f7426325b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ef1ef81237a9dc8ac56ea438e4b7cecf6d1706f79d1c195e35b20d0fca26c931\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f01274450b65dacbe63b1855ae18929c854e6558ff7183eaa2b27ad5ebfee2ba\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f01274450b65dacbe63b1855ae18929c854e6558ff7183eaa2b27ad5ebfee2ba\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f07cbb9a0b0bfdd9b9a6ed25c3528b3d95759a8f23820a73e93dd981ac6acee7\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f07cbb9a0b0bfdd9b9a6ed25c3528b3d95759a8f23820a73e93dd981ac6acee7\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f0f25ff526e1fe78f818d3d6d23230015b88f093858273db9c3b29f63cc69201\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f0f25ff526e1fe78f818d3d6d23230015b88f093858273db9c3b29f63cc69201\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f11d337d96933ecb10d79bf56aad315fa6484af173c87f9c7a9ab05ea34633d9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f11d337d96933ecb10d79bf56aad315fa6484af173c87f9c7a9ab05ea34633d9\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f18db0569cd480c577e5ddc29db43092042c660375de09f10b8a82816132ece2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f1b82ebaace87cd4a9d3f47ad7640665e24dd3cab20409fbff7286d802599357\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f1c25b581bade13be5d9434b4bc4fe601c061bbe8cbf264f72463bfb24256047\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f23d986d803f0470ace110ff85505a316928bd7ee201db3e95632a654293159b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f23d986d803f0470ace110ff85505a316928bd7ee201db3e95632a654293159b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f2a6a406cb9068596378c03c91829020fe8b9b2cd6ca75c563a5fd56daa61412\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f2b4d9b00ec88216e1a5940e62cb758ee8c7d52bbf1c9be7148d2f7b583e0a98\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f2b4d9b00ec88216e1a5940e62cb758ee8c7d52bbf1c9be7148d2f7b583e0a98\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f2ea7df6aae538af9a86ff58e08da1204c49a97b056b078075e39f79cf28a36c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f2ea7df6aae538af9a86ff58e08da1204c49a97b056b078075e39f79cf28a36c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f32214553d4a9f4f931c35e7071bfdf1410da95a92bd22c45fe2241f47f40d08\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f3271e1f6e66125d9cf05f8e0593bb06345e0c0a0524e2f00d240090ae074644\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f3271e1f6e66125d9cf05f8e0593bb06345e0c0a0524e2f00d240090ae074644\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f340868f924d36051265cac75c7d69c77090410a972f4bbcf354a8c4e12c2b38\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f340868f924d36051265cac75c7d69c77090410a972f4bbcf354a8c4e12c2b38\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f34ecafed6eec137553915b3595eab82d38031335bbfdea594e8bd6db2819600\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f34ecafed6eec137553915b3595eab82d38031335bbfdea594e8bd6db2819600\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f3583eb013eac568f51b457c54a050eb450013cfc46ecaa829226efb9ef6ca4d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f3583eb013eac568f51b457c54a050eb450013cfc46ecaa829226efb9ef6ca4d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f3ec8eb0910557a8f996781d2934ad61c179610c2c0d38cc6fbbb1aa008b879f\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f3ec8eb0910557a8f996781d2934ad61c179610c2c0d38cc6fbbb1aa008b879f\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f46ad5e8b73a8d994a8007b4e1a43e125c37dcd9eea4383f463f8bb02bf14483\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f46ad5e8b73a8d994a8007b4e1a43e125c37dcd9eea4383f463f8bb02bf14483\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f4c6fb6a95ea944ec7fdb382ff68c4217b39177cfa2ec426405fcc66174af66a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f4c6fb6a95ea944ec7fdb382ff68c4217b39177cfa2ec426405fcc66174af66a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f4f8610928be83755404771c0d3c799bc864924f92521abd6b813eeb30908b77\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f50cc3f39fed9dc4fa78806101e8e571ee911a3413e839eea848682623a1452c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f50cc3f39fed9dc4fa78806101e8e571ee911a3413e839eea848682623a1452c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f5a0fd710d8ad80cbed09d69ad6f9c5e714cd700964c10ef2156ac1df07e852c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f5a27c5e1e7e8708c23a1d3cf5f0f0b1f70e80639051df1ed3f7a7e1eaa3de37\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f5a27c5e1e7e8708c23a1d3cf5f0f0b1f70e80639051df1ed3f7a7e1eaa3de37\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f62eddb5df36cbe4447f643385aa597a61f5023caa11f3f541563419e95996cf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f66faea1c9ab023562cc8ce32f91821ad62b30a7fe83ef381628b22104d5e798\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f66faea1c9ab023562cc8ce32f91821ad62b30a7fe83ef381628b22104d5e798\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f68c59cfb5cfa5f763ec3d5fcbbe88ccc0a37ebff62d6e229485afc0b32f8667\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f68c59cfb5cfa5f763ec3d5fcbbe88ccc0a37ebff62d6e229485afc0b32f8667\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f6b111b5dd954fbbd6161bd5b181c8de68d0f427c2d3c675ee73c440b31b31d3\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f6b111b5dd954fbbd6161bd5b181c8de68d0f427c2d3c675ee73c440b31b31d3\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f6eef0f05efe5abdf649f176dbaa3c2b7859ac9905403494fb638c20b5c52814\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f6f57f1c4b95cc4a29af777b28056bd0dc57ffae70ed601bb15027094c67242d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f6f57f1c4b95cc4a29af777b28056bd0dc57ffae70ed601bb15027094c67242d\",\n"
-            "    \"n\": 2\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f7504dc2bffaff4af878e48d932739bc6b882cc38f91ec4f1aec38dc93d72dd0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f7504dc2bffaff4af878e48d932739bc6b882cc38f91ec4f1aec38dc93d72dd0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f75b6c0a93ae6ea1871cd96bd050f30f925cb4fda7c26c227e99ebddc5ef2940\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f77729c5aa1294da9fab83d4b4c6ca6317706e216c1ab1b0f33964852068616e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f78d483909e1db4aac2c41eabf8809a81c5882b1d28cbfa37b5ff91714390549\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f78d483909e1db4aac2c41eabf8809a81c5882b1d28cbfa37b5ff91714390549\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f793f8ce409b22e5684e13e43a923cd5e7fa74c853c1d10f52c169a4fff06f78\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f87200e4e44c4bbd4f62ec07448a623a200804ddf79236bc5947896591f2afdd\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f87200e4e44c4bbd4f62ec07448a623a200804ddf79236bc5947896591f2afdd\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f891496db9be5e3aaaa0d9cc0d19d6f7834e820e00d63e2af013af6d16d7395e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f89eba8b9150604add1d26b632bec964027cae464c48940cc9186227186d027d\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f89eba8b9150604add1d26b632bec964027cae464c48940cc9186227186d027d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f922e719d01b7214436afbf272a9c7b2c5e24bb1cc946daaed33c4b2f53d9dcb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f922e719d01b7214436afbf272a9c7b2c5e24bb1cc946daaed33c4b2f53d9dcb\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f9578addf100907492a87a0dee93761953662663dbce8e08a73227847378e9c6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f9578addf100907492a87a0dee93761953662663dbce8e08a73227847378e9c6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f9b4a7de5f85e86c22bd61942e0de7955940e3ec8b5dd3c48cad1b9f0f15ceef\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f9b4a7de5f85e86c22bd61942e0de7955940e3ec8b5dd3c48cad1b9f0f15ceef\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f9b92416eb79387b33e0f56eef435d252b472d8cd38eac8124cdcd94256717da\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f9cfc1b31340a4a16046f61109ac03350f9a475e63c97b306d33f2b82e60d613\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"f9f220823ca5e9010621c9d70bc2bde242f2144f0f9197facdae20c2707c4dfb\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fa2c41d3b5075b470898efe496de7bef1a08170594d7017b512bb6ca5d1fcb8e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fa2c41d3b5075b470898efe496de7bef1a08170594d7017b512bb6ca5d1fcb8e\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fa44afffc0facfbf33220ad2c46d9502c501b6b6832d7ba7e01c92ab12293457\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fa6f52a8685e5653a0c8cf93397947a63b5fe4c204c188ed8c3fe9109b12d669\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fa6f52a8685e5653a0c8cf93397947a63b5fe4c204c188ed8c3fe9109b12d669\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fadb123e439fa3ff8a7af185628f7d7fc6ed14e08408be2460080a9bcb7e0917\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fadb123e439fa3ff8a7af185628f7d7fc6ed14e08408be2460080a9bcb7e0917\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"faefce14269139531a87832181b0cdcc1b9a2b0512de05f8aa4e194cf5a5c0dc\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"faefce14269139531a87832181b0cdcc1b9a2b0512de05f8aa4e194cf5a5c0dc\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"faf98468cba9c2e1f7e8412f98fb0b9d3e283b4899b652c5d022129bdf62445a\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"faf98468cba9c2e1f7e8412f98fb0b9d3e283b4899b652c5d022129bdf62445a\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fb04513b447b3a2dd9a05ee6aaf21a5930e333514900c78ab6bc9fb9f59c4641\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fb04513b447b3a2dd9a05ee6aaf21a5930e333514900c78ab6bc9fb9f59c4641\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbc5c77f09278a0dfcf27850af17cd87ea45cce54a42099f795df46e38494f1e\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbcd0e8d1c4294913e501d2f211b98a26f9cb6f2caee5f85477481e38bffc949\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbcd0e8d1c4294913e501d2f211b98a26f9cb6f2caee5f85477481e38bffc949\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbd2f9ff17ae6044e9dbfc74d5373b952087719388a686d721cf21eddd245293\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbe4873146d77f5906c930401cda16a480713b829e0d04d5a9300861eeea0508\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbe4873146d77f5906c930401cda16a480713b829e0d04d5a9300861eeea0508\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbf0061ec89b2be70dafc78e219c1a68a085f8b5040aecd5295e4dd4270a48a0\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fbf0061ec89b2be70dafc78e219c1a68a085f8b5040aecd5295e4dd4270a48a0\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fc29357f7d5b007fe406dca83c028b2f64f0e641488323fc125a0f98683be3b9\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fc5ed1cad7abda03588ce2c42bc19079e93495d26cc9ea23b3185220bd7b90d6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fc6bdf20d19a29a7badf69d275ae90fcee180e0e1a2c225bada97b4a43004053\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fc6bdf20d19a29a7badf69d275ae90fcee180e0e1a2c225bada97b4a43004053\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fc9539c5c8647da533665a617303cae3598de9ca9602f22f47b403a43f3917bf\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fc9539c5c8647da533665a617303cae3598de9ca9602f22f47b403a43f3917bf\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fcc078f2fd881acc9e59d4cad23e67757ade61155ce0fb1031fd94cd771ab442\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fcc078f2fd881acc9e59d4cad23e67757ade61155ce0fb1031fd94cd771ab442\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fcc697cd0cf8e1d827dd04e2321c67962583d4497f6dad2da2916e416413c697\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fcc697cd0cf8e1d827dd04e2321c67962583d4497f6dad2da2916e416413c697\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd4bb45888a1c05c26f3f5e0a74c72bbf8d8398c8c0b166c5b2013b91aa69894\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd4bb45888a1c05c26f3f5e0a74c72bbf8d8398c8c0b166c5b2013b91aa69894\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd553ba535204e1959ad479d461f897afa1c30c1ba5e433ff695bf439c539072\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd553ba535204e1959ad479d461f897afa1c30c1ba5e433ff695bf439c539072\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd830f72967ce3b18b0e0cb3752971a7345123ddce1fdafab3d4d0d535952578\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd830f72967ce3b18b0e0cb3752971a7345123ddce1fdafab3d4d0d535952578\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd9b287069b1cd37cd6ca3acad9745360188c669f0aea13b8f40607973b42a01\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fd9b287069b1cd37cd6ca3acad9745360188c669f0aea13b8f40607973b42a01\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fdb7217e1c8fb7621c0a301756e53b6603f78e919bfb8380051009134c0e8e4c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fdb7217e1c8fb7621c0a301756e53b6603f78e919bfb8380051009134c0e8e4c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fdf6f835f928c964c3c0c8eae7f38dd5af46bebd767315c3557456773ad44768\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fdf7dcf77f8448d7e7806e0e30b38348882a2773c05e6b18664268e728e790a2\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fe2d16bff14cb0284f8fbc8cbf70645c147c07d0d9ba2a18c6c5efbfddb49d8b\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fe2d16bff14cb0284f8fbc8cbf70645c147c07d0d9ba2a18c6c5efbfddb49d8b\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fe34f4b21f7bdf6d0d17e9f68bb919c44d2921480cfd6441f71a5e61a7418f70\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fe34f4b21f7bdf6d0d17e9f68bb919c44d2921480cfd6441f71a5e61a7418f70\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fe38cd0a2a3110922b1b55c4d8e6f9ecd56c5bac61ec7b8c4e168063c019a403\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fe38cd0a2a3110922b1b55c4d8e6f9ecd56c5bac61ec7b8c4e168063c019a403\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fe8b78fe29f2846e90608d83a975577710fa9c1e94ef713c4866d6680ff96a54\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fee425420215cca74d1eafebcad0dbfb98a3393130a8700e09d2e9f37b22901c\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fee425420215cca74d1eafebcad0dbfb98a3393130a8700e09d2e9f37b22901c\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ff094c52d9dc5908abc6f2106e4c6e824ee1b4dfb1e73f485ef76faa2eac62c6\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ff094c52d9dc5908abc6f2106e4c6e824ee1b4dfb1e73f485ef76faa2eac62c6\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ff6809528d69e1745dd5f979c77f1a7b55f97fc28c4ad937392b45d312d049c4\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ff952cd968917f1e88068743e825371ad2f548e133903a068dd64e10d8ebfa3d\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ffcafd056bbb50b8c37a8205bc8621c7c36bab70939d4d6d6e7c56d8767e8856\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"ffcafd056bbb50b8c37a8205bc8621c7c36bab70939d4d6d6e7c56d8767e8856\",\n"
-            "    \"n\": 1\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fff7164737e3437fd27b3787edeb2650eddd07966c492ffb7e0eb537c0a5b850\",\n"
-            "    \"n\": 0\n"
-            "  },\n"
-            "  {\n"
-            "    \"txid\": \"fff7164737e3437fd27b3787edeb2650eddd07966c492ffb7e0eb537c0a5b850\",\n"
-            "    \"n\": 1\n"
-            "  }\n"
-            "]";
-    return str;
-}
-
-#endif //HOOLIBET_INVALID_OUTPOINTS_JSON_H
@@ -82,6 +82,9 @@ CLevelDBWrapper::~CLevelDBWrapper()
 
 bool CLevelDBWrapper::WriteBatch(CLevelDBBatch& batch, bool fSync) throw(leveldb_error)
 {
+    static CPerfCounter& perfBytesWritten = GetPerfCounter("leveldb.write.bytes");
+    PERF_TIMER("leveldb.write");
+    perfBytesWritten.Add(batch.GetSize());
     leveldb::Status status = pdb->Write(fSync ? syncoptions : writeoptions, &batch.batch);
     HandleError(status);
     return true;
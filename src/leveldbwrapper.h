@@ -6,6 +6,7 @@
 #define BITCOIN_LEVELDBWRAPPER_H
 
 #include "clientversion.h"
+#include "perfstats.h"
 #include "serialize.h"
 #include "streams.h"
 #include "util.h"
@@ -31,8 +32,20 @@ class CLevelDBBatch
 
 private:
     leveldb::WriteBatch batch;
+    size_t nSize;
 
 public:
+    CLevelDBBatch() : nSize(0) {}
+
+    //! Bytes of keys and values queued so far
+    size_t GetSize() const { return nSize; }
+
+    void Clear()
+    {
+        batch.Clear();
+        nSize = 0;
+    }
+
     template <typename K, typename V>
     void Write(const K& key, const V& value)
     {
@@ -47,6 +60,7 @@ public:
         leveldb::Slice slValue(&ssValue[0], ssValue.size());
 
         batch.Put(slKey, slValue);
+        nSize += ssKey.size() + ssValue.size();
     }
 
     template <typename K>
@@ -58,6 +72,7 @@ public:
         leveldb::Slice slKey(&ssKey[0], ssKey.size());
 
         batch.Delete(slKey);
+        nSize += ssKey.size();
     }
 };
 
@@ -92,6 +107,7 @@ public:
     template <typename K, typename V>
     bool Read(const K& key, V& value) const throw(leveldb_error)
     {
+        PERF_TIMER("leveldb.read");
         CDataStream ssKey(SER_DISK, CLIENT_VERSION);
         ssKey.reserve(ssKey.GetSerializeSize(key));
         ssKey << key;
@@ -125,6 +141,7 @@ public:
     template <typename K>
     bool Exists(const K& key) const throw(leveldb_error)
     {
+        PERF_TIMER("leveldb.read");
         CDataStream ssKey(SER_DISK, CLIENT_VERSION);
         ssKey.reserve(ssKey.GetSerializeSize(key));
         ssKey << key;
@@ -168,6 +185,25 @@ public:
     {
         return pdb->NewIterator(iteroptions);
     }
+
+    //! An iterator over the state of the database when the snapshot was taken
+    leveldb::Iterator* NewIterator(const leveldb::Snapshot* snapshot)
+    {
+        leveldb::ReadOptions options = iteroptions;
+        options.snapshot = snapshot;
+        return pdb->NewIterator(options);
+    }
+
+    //! A consistent view of the database, kept until ReleaseSnapshot while writes go on
+    const leveldb::Snapshot* GetSnapshot()
+    {
+        return pdb->GetSnapshot();
+    }
+
+    void ReleaseSnapshot(const leveldb::Snapshot* snapshot)
+    {
+        pdb->ReleaseSnapshot(snapshot);
+    }
 };
 
 #endif // BITCOIN_LEVELDBWRAPPER_H
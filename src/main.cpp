@@ -11,6 +11,9 @@
 #include "accumulatormap.h"
 #include "addrman.h"
 #include "alert.h"
+#include "blockcache.h"
+#include "blockencodings.h"
+#include "blockfilter.h"
 #include "blocksignature.h"
 #include "chainparams.h"
 #include "checkpoints.h"
@@ -23,6 +26,7 @@
 #include "merkleblock.h"
 #include "net.h"
 #include "obfuscation.h"
+#include "perfstats.h"
 #include "pow.h"
 #include "spork.h"
 #include "sporkdb.h"
@@ -74,10 +78,13 @@ int nScriptCheckThreads = 0;
 bool fImporting = false;
 bool fReindex = false;
 bool fTxIndex = true;
+bool fAddressIndex = DEFAULT_ADDRESSINDEX;
+bool fSpentIndex = DEFAULT_SPENTINDEX;
+bool fTimestampIndex = DEFAULT_TIMESTAMPINDEX;
 bool fIsBareMultisigStd = true;
 bool fCheckBlockIndex = false;
 bool fVerifyingBlocks = false;
-unsigned int nCoinCacheSize = 5000;
+size_t nCoinCacheUsage = 5000 * 300;
 bool fAlerts = DEFAULT_ALERTS;
 
 unsigned int nStakeMinAge = 3 * 60 * 60;
@@ -145,6 +152,9 @@ set<CBlockIndex*, CBlockIndexWorkComparator> setBlockIndexCandidates;
 int nSyncStarted = 0;
 /** All pairs A->B, where A (or one if its ancestors) misses transactions, but B has transactions. */
 multimap<CBlockIndex*, CBlockIndex*> mapBlocksUnlinked;
+/** Entries created from a bare header whose proof-of-stake data and stake modifier
+ * are filled in once the block arrives. */
+set<CBlockIndex*> setStakeDataPending;
 
 CCriticalSection cs_LastBlockFile;
 std::vector<CBlockFileInfo> vinfoBlockFile;
@@ -174,6 +184,20 @@ struct QueuedBlock {
 };
 map<uint256, pair<NodeId, list<QueuedBlock>::iterator> > mapBlocksInFlight;
 
+/**
+ * Blocks that arrived during headers-first sync before the data of their parent.
+ * The stake kernel of a proof-of-stake block can only be checked once its parent is
+ * connected, so they wait here and get processed in chain order. Protected by cs_main.
+ */
+struct CBlockAwaitingParent {
+    CBlock block;
+    NodeId nodeid;
+    unsigned int nSize;
+};
+map<uint256, CBlockAwaitingParent> mapBlocksAwaitingParent;
+multimap<uint256, uint256> mapBlocksAwaitingParentByPrev;
+unsigned int nBlocksAwaitingParentSize = 0;
+
 /** Number of blocks in flight with validated headers. */
 int nQueuedValidatedHeaders = 0;
 
@@ -233,6 +257,15 @@ struct CNodeState {
     int nBlocksInFlight;
     //! Whether we consider this a preferred download peer.
     bool fPreferredDownload;
+    //! Whether this peer serves blocks as short transaction IDs (BIP 152).
+    bool fSupportsCompactBlocks;
+    //! The compact block from this peer that waits for a blocktxn reply, if any.
+    std::shared_ptr<PartiallyDownloadedBlock> partialBlock;
+    uint256 hashPartialBlock;
+    //! Proof-of-stake headers this peer announced first, until their blocks arrive.
+    std::vector<CBlockIndex*> vUnconnectedHeaders;
+    //! Whether headers sync with this peer waits for vUnconnectedHeaders to shrink.
+    bool fHeadersCapped;
 
     CNodeState()
     {
@@ -246,6 +279,9 @@ struct CNodeState {
         nStallingSince = 0;
         nBlocksInFlight = 0;
         fPreferredDownload = false;
+        fSupportsCompactBlocks = false;
+        hashPartialBlock = uint256(0);
+        fHeadersCapped = false;
     }
 };
 
@@ -317,6 +353,8 @@ void MarkBlockAsReceived(const uint256& hash)
     map<uint256, pair<NodeId, list<QueuedBlock>::iterator> >::iterator itInFlight = mapBlocksInFlight.find(hash);
     if (itInFlight != mapBlocksInFlight.end()) {
         CNodeState* state = State(itInFlight->second.first);
+        if (state->hashPartialBlock == hash)
+            state->partialBlock.reset();
         nQueuedValidatedHeaders -= itInFlight->second.second->fValidatedHeaders;
         state->vBlocksInFlight.erase(itInFlight->second.second);
         state->nBlocksInFlight--;
@@ -458,6 +496,9 @@ void FindNextBlocksToDownload(NodeId nodeid, unsigned int count, std::vector<CBl
             if (pindex->nStatus & BLOCK_HAVE_DATA) {
                 if (pindex->nChainTx)
                     state->pindexLastCommonBlock = pindex;
+            } else if (mapBlocksAwaitingParent.count(pindex->GetBlockHash())) {
+                // Downloaded already, waiting for the data of its parent.
+                continue;
             } else if (mapBlocksInFlight.count(pindex->GetBlockHash()) == 0) {
                 // The block is not already downloaded, and not yet in flight.
                 if (pindex->nHeight > nWindowEnd) {
@@ -480,6 +521,72 @@ void FindNextBlocksToDownload(NodeId nodeid, unsigned int count, std::vector<CBl
     }
 }
 
+/** Whether to sync with this peer through headers and parallel block download. */
+bool UseHeadersFirst(const CNode* pnode)
+{
+    return Params().HeadersFirstSyncingActive() && pnode->nVersion >= HEADERS_FIRST_VERSION;
+}
+
+/** Keep a block whose parent is still being downloaded. Requires cs_main. */
+bool AddBlockAwaitingParent(const CBlock& block, NodeId nodeid)
+{
+    uint256 hash = block.GetHash();
+    if (mapBlocksAwaitingParent.count(hash))
+        return true;
+
+    unsigned int nSize = ::GetSerializeSize(block, SER_NETWORK, PROTOCOL_VERSION);
+    if (mapBlocksAwaitingParent.size() >= MAX_BLOCKS_AWAITING_PARENT || nBlocksAwaitingParentSize + nSize > MAX_BLOCKS_AWAITING_PARENT_SIZE)
+        return false;
+
+    CBlockAwaitingParent& entry = mapBlocksAwaitingParent[hash];
+    entry.block = block;
+    entry.nodeid = nodeid;
+    entry.nSize = nSize;
+    mapBlocksAwaitingParentByPrev.insert(std::make_pair(block.hashPrevBlock, hash));
+    nBlocksAwaitingParentSize += nSize;
+    return true;
+}
+
+/** Remove the blocks waiting for the given parent and append them to vBlocks. Requires cs_main. */
+void TakeBlocksAwaitingParent(const uint256& hashParent, std::vector<CBlockAwaitingParent>& vBlocks)
+{
+    std::pair<multimap<uint256, uint256>::iterator, multimap<uint256, uint256>::iterator> range = mapBlocksAwaitingParentByPrev.equal_range(hashParent);
+    for (multimap<uint256, uint256>::iterator it = range.first; it != range.second; ++it) {
+        map<uint256, CBlockAwaitingParent>::iterator mi = mapBlocksAwaitingParent.find(it->second);
+        if (mi == mapBlocksAwaitingParent.end())
+            continue;
+        vBlocks.push_back(mi->second);
+        nBlocksAwaitingParentSize -= mi->second.nSize;
+        mapBlocksAwaitingParent.erase(mi);
+    }
+    mapBlocksAwaitingParentByPrev.erase(range.first, range.second);
+}
+
+/**
+ * Drop the blocks waiting for the given parent, and the ones waiting for those, after the
+ * parent turned out invalid. They get downloaded again if their chain is still the best one.
+ * Requires cs_main.
+ */
+void EraseBlocksAwaitingParent(const uint256& hashParent)
+{
+    std::vector<CBlockAwaitingParent> vDropped;
+    TakeBlocksAwaitingParent(hashParent, vDropped);
+    for (unsigned int i = 0; i < vDropped.size(); i++)
+        TakeBlocksAwaitingParent(vDropped[i].block.GetHash(), vDropped);
+}
+
+bool IsHeaderSettled(const CBlockIndex* pindex)
+{
+    return (pindex->nStatus & (BLOCK_HAVE_DATA | BLOCK_FAILED_MASK)) != 0;
+}
+
+/** Forget the unconnected headers of a peer whose blocks arrived or were found invalid. Requires cs_main. */
+void PruneUnconnectedHeaders(CNodeState* state)
+{
+    std::vector<CBlockIndex*>& vHeaders = state->vUnconnectedHeaders;
+    vHeaders.erase(std::remove_if(vHeaders.begin(), vHeaders.end(), IsHeaderSettled), vHeaders.end());
+}
+
 } // anon namespace
 
 bool GetNodeStateStats(NodeId nodeid, CNodeStateStats& stats)
@@ -531,6 +638,7 @@ CBlockIndex* FindForkInGlobalIndex(const CChain& chain, const CBlockLocator& loc
 }
 
 CCoinsViewCache* pcoinsTip = NULL;
+CCoinsViewFlusher* pcoinsflusher = NULL;
 CBlockTreeDB* pblocktree = NULL;
 CZerocoinDB* zerocoinDB = NULL;
 CSporkDB* pSporkDB = NULL;
@@ -540,6 +648,29 @@ CSporkDB* pSporkDB = NULL;
 // mapOrphanTransactions
 //
 
+/**
+ * Transactions outside the mempool that a compact block may refer to: the last
+ * -blockreconstructionextratxn orphans and rejected SwiftTX lock requests,
+ * overwritten oldest first. Requires cs_main.
+ */
+static std::vector<CTransaction> vExtraTxnForCompact;
+static size_t nExtraTxnForCompactIt = 0;
+
+void AddToCompactExtraTransactions(const CTransaction& tx)
+{
+    int64_t nArg = GetArg("-blockreconstructionextratxn", DEFAULT_BLOCK_RECONSTRUCTION_EXTRA_TXN);
+    if (nArg <= 0)
+        return;
+    size_t nMaxExtraTxn = nArg;
+    if (nExtraTxnForCompactIt >= nMaxExtraTxn)
+        nExtraTxnForCompactIt = 0;
+    if (vExtraTxnForCompact.size() < nMaxExtraTxn)
+        vExtraTxnForCompact.push_back(tx);
+    else
+        vExtraTxnForCompact[nExtraTxnForCompactIt] = tx;
+    nExtraTxnForCompactIt = (nExtraTxnForCompactIt + 1) % nMaxExtraTxn;
+}
+
 bool AddOrphanTx(const CTransaction& tx, NodeId peer)
 {
     uint256 hash = tx.GetHash();
@@ -563,6 +694,7 @@ bool AddOrphanTx(const CTransaction& tx, NodeId peer)
     mapOrphanTransactions[hash].fromPeer = peer;
     BOOST_FOREACH (const CTxIn& txin, tx.vin)
         mapOrphanTransactionsByPrev[txin.prevout.hash].insert(hash);
+    AddToCompactExtraTransactions(tx);
 
     LogPrint("mempool", "stored orphan tx %s (mapsz %u prevsz %u)\n", hash.ToString(),
         mapOrphanTransactions.size(), mapOrphanTransactionsByPrev.size());
@@ -950,6 +1082,7 @@ bool ContextualCheckZerocoinMint(const CTransaction& tx, const PublicCoin& coin,
 
 bool ContextualCheckZerocoinSpend(const CTransaction& tx, const CoinSpend& spend, CBlockIndex* pindex, const uint256& hashBlock)
 {
+    PERF_TIMER("zerocoin.spend.contextualcheck");
     //Check to see if the zHBET is properly signed
     if (pindex->nHeight >= Params().Zerocoin_Block_V2_Start()) {
         if (!spend.HasValidSignature())
@@ -982,6 +1115,7 @@ bool ContextualCheckZerocoinSpend(const CTransaction& tx, const CoinSpend& spend
 
 bool CheckZerocoinSpend(const CTransaction& tx, bool fVerifySignature, CValidationState& state)
 {
+    PERF_TIMER("zerocoin.spend.check");
     //max needed non-mint outputs should be 2 - one for redemption address and a possible 2nd for change
     if (tx.vout.size() > 2) {
         int outs = 0;
@@ -1373,7 +1507,7 @@ bool AcceptToMemoryPool(CTxMemPool& pool, CValidationState& state, const CTransa
         CAmount nFees = nValueIn - nValueOut;
         double dPriority = 0;
         if (!tx.IsZerocoinSpend())
-            view.GetPriority(tx, chainActive.Height());
+            dPriority = view.GetPriority(tx, chainActive.Height());
 
         CTxMemPoolEntry entry(tx, nFees, GetTime(), dPriority, chainActive.Height());
         unsigned int nSize = entry.GetTxSize();
@@ -1383,6 +1517,13 @@ bool AcceptToMemoryPool(CTxMemPool& pool, CValidationState& state, const CTransa
         if (mapObfuscationBroadcastTxes.count(hash)) {
             mempool.PrioritiseTransaction(hash, hash.ToString(), 1000, 0.1 * COIN);
         } else if (!ignoreFees) {
+            // Once the mempool has been full, the fee rate of what was evicted is the floor
+            CAmount mempoolRejectFee = pool.GetMinFee(GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000).GetFee(nSize);
+            if (mempoolRejectFee > 0 && nFees < mempoolRejectFee && !tx.IsZerocoinSpend())
+                return state.DoS(0, error("AcceptToMemoryPool : mempool min fee not met %s, %d < %d",
+                                        hash.ToString(), nFees, mempoolRejectFee),
+                    REJECT_INSUFFICIENTFEE, "mempool min fee not met");
+
             CAmount txMinFee = GetMinRelayFee(tx, nSize, true);
             if (fLimitFree && nFees < txMinFee && !tx.IsZerocoinSpend())
                 return state.DoS(0, error("AcceptToMemoryPool : not enough fees %s, %d < %d",
@@ -1445,8 +1586,33 @@ bool AcceptToMemoryPool(CTxMemPool& pool, CValidationState& state, const CTransa
             return error("AcceptToMemoryPool: : BUG! PLEASE REPORT THIS! ConnectInputs failed against MANDATORY but not STANDARD flags %s", hash.ToString());
         }
 
+        // Calculate in-mempool ancestors, up to a limit.
+        CTxMemPool::setEntries setAncestors;
+        size_t nLimitAncestors = GetArg("-limitancestorcount", DEFAULT_ANCESTOR_LIMIT);
+        size_t nLimitDescendants = GetArg("-limitdescendantcount", DEFAULT_DESCENDANT_LIMIT);
+        std::string errString;
+        if (!pool.CalculateMemPoolAncestors(entry, setAncestors, nLimitAncestors, nLimitDescendants, errString))
+            return state.DoS(0, error("AcceptToMemoryPool : too long mempool chain %s: %s", hash.ToString(), errString),
+                REJECT_NONSTANDARD, "too-long-mempool-chain");
+
         // Store transaction in memory
-        pool.addUnchecked(hash, entry);
+        pool.addUnchecked(hash, entry, setAncestors);
+
+        // Trim the mempool and check if tx was trimmed. SwiftTX locked and
+        // obfuscation transactions are not evicted, as losing them breaks the
+        // lock or the mixing session they belong to.
+        size_t nMaxMempool = GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000;
+        if (pool.DynamicMemoryUsage() > nMaxMempool) {
+            std::set<uint256> setKeep;
+            for (map<uint256, CTransactionLock>::const_iterator it = mapTxLocks.begin(); it != mapTxLocks.end(); ++it)
+                setKeep.insert(it->first);
+            for (map<uint256, CObfuscationBroadcastTx>::const_iterator it = mapObfuscationBroadcastTxes.begin(); it != mapObfuscationBroadcastTxes.end(); ++it)
+                setKeep.insert(it->first);
+            pool.TrimToSize(nMaxMempool, setKeep);
+        }
+        if (!pool.exists(hash))
+            return state.DoS(0, error("AcceptToMemoryPool : mempool full, %s not accepted", hash.ToString()),
+                REJECT_INSUFFICIENTFEE, "mempool full");
     }
 
     SyncWithWallets(tx, NULL);
@@ -1672,14 +1838,17 @@ bool GetTransaction(const uint256& hash, CTransaction& txOut, uint256& hashBlock
         if (fTxIndex) {
             CDiskTxPos postx;
             if (pblocktree->ReadTxIndex(hash, postx)) {
-                CAutoFile file(OpenBlockFile(postx, true), SER_DISK, CLIENT_VERSION);
-                if (file.IsNull())
-                    return error("%s: OpenBlockFile failed", __func__);
                 CBlockHeader header;
                 try {
-                    file >> header;
-                    fseek(file.Get(), postx.nTxOffset, SEEK_CUR);
-                    file >> txOut;
+                    if (!IsBlockFileFinalized(postx.nFile) || !blockFileCache.ReadTxFromMappedFile(postx, postx.nTxOffset, header, txOut)) {
+                        CAutoFile file(OpenBlockFile(postx, true), SER_DISK, CLIENT_VERSION);
+                        if (file.IsNull())
+                            return error("%s: OpenBlockFile failed", __func__);
+                        file >> header;
+                        fseek(file.Get(), postx.nTxOffset, SEEK_CUR);
+                        file >> txOut;
+                        blockFileCache.AddBytesRead(::GetSerializeSize(header, SER_DISK, CLIENT_VERSION) + ::GetSerializeSize(txOut, SER_DISK, CLIENT_VERSION));
+                    }
                 } catch (std::exception& e) {
                     return error("%s : Deserialize or I/O error - %s", __func__, e.what());
                 }
@@ -1722,6 +1891,34 @@ bool GetTransaction(const uint256& hash, CTransaction& txOut, uint256& hashBlock
     return false;
 }
 
+bool GetAddressIndex(int nAddressType, const uint160& hashBytes, std::vector<std::pair<CAddressIndexKey, CAmount> >& vAddressIndex, int nStart, int nEnd)
+{
+    if (!fAddressIndex)
+        return error("%s : address index not enabled", __func__);
+    return pblocktree->ReadAddressIndex(nAddressType, hashBytes, vAddressIndex, nStart, nEnd);
+}
+
+bool GetAddressUnspent(int nAddressType, const uint160& hashBytes, std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >& vUnspent)
+{
+    if (!fAddressIndex)
+        return error("%s : address index not enabled", __func__);
+    return pblocktree->ReadAddressUnspentIndex(nAddressType, hashBytes, vUnspent);
+}
+
+bool GetSpentIndex(const CSpentIndexKey& key, CSpentIndexValue& value)
+{
+    if (!fSpentIndex)
+        return false;
+    return pblocktree->ReadSpentIndex(key, value);
+}
+
+bool GetTimestampIndex(unsigned int nHigh, unsigned int nLow, std::vector<uint256>& vHashes)
+{
+    if (!fTimestampIndex)
+        return error("%s : timestamp index not enabled", __func__);
+    return pblocktree->ReadTimestampIndex(nHigh, nLow, vHashes);
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -1749,18 +1946,30 @@ bool WriteBlockToDisk(CBlock& block, CDiskBlockPos& pos)
     return true;
 }
 
+bool IsBlockFileFinalized(int nFile)
+{
+    // Only the last block file is still being appended to
+    LOCK(cs_LastBlockFile);
+    return nFile < nLastBlockFile;
+}
+
 bool ReadBlockFromDisk(CBlock& block, const CDiskBlockPos& pos)
 {
     block.SetNull();
 
-    // Open history file to read
-    CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
-    if (filein.IsNull())
-        return error("ReadBlockFromDisk : OpenBlockFile failed");
+    if (blockFileCache.Lookup(pos, block))
+        return true;
 
-    // Read block
+    // Read block, straight from the memory map when the file is complete
     try {
-        filein >> block;
+        if (!IsBlockFileFinalized(pos.nFile) || !blockFileCache.ReadFromMappedFile(pos, block)) {
+            // Open history file to read
+            CAutoFile filein(OpenBlockFile(pos, true), SER_DISK, CLIENT_VERSION);
+            if (filein.IsNull())
+                return error("ReadBlockFromDisk : OpenBlockFile failed");
+            filein >> block;
+            blockFileCache.AddBytesRead(::GetSerializeSize(block, SER_DISK, CLIENT_VERSION));
+        }
     } catch (std::exception& e) {
         return error("%s : Deserialize or I/O error - %s", __func__, e.what());
     }
@@ -1771,6 +1980,7 @@ bool ReadBlockFromDisk(CBlock& block, const CDiskBlockPos& pos)
             return error("ReadBlockFromDisk : Errors in block header");
     }
 
+    blockFileCache.Insert(pos, block, ::GetSerializeSize(block, SER_DISK, CLIENT_VERSION));
     return true;
 }
 
@@ -2036,6 +2246,7 @@ void static InvalidBlockFound(CBlockIndex* pindex, const CValidationState& state
         pindex->nStatus |= BLOCK_FAILED_VALID;
         setDirtyBlockIndex.insert(pindex);
         setBlockIndexCandidates.erase(pindex);
+        EraseBlocksAwaitingParent(pindex->GetBlockHash());
         InvalidChainFound(pindex);
     }
 }
@@ -2124,7 +2335,7 @@ bool ValidOutPoint(const COutPoint out, int nHeight)
 CAmount GetInvalidUTXOValue()
 {
     CAmount nValue = 0;
-    for (auto out : invalid_out::setInvalidOutPoints) {
+    for (auto out : invalid_out::GetInvalidOutPoints()) {
         bool fSpent = false;
         CCoinsViewCache cache(pcoinsTip);
         const CCoins *coins = cache.AccessCoins(out.hash);
@@ -2238,7 +2449,7 @@ bool CheckInputs(const CTransaction& tx, CValidationState& state, const CCoinsVi
     return true;
 }
 
-bool DisconnectBlock(CBlock& block, CValidationState& state, CBlockIndex* pindex, CCoinsViewCache& view, bool* pfClean)
+bool DisconnectBlock(CBlock& block, CValidationState& state, CBlockIndex* pindex, CCoinsViewCache& view, bool fRollbackIndexes, bool* pfClean)
 {
     if (pindex->GetBlockHash() != view.GetBestBlock())
         LogPrintf("%s : pindex=%s view=%s\n", __func__, pindex->GetBlockHash().GetHex(), view.GetBestBlock().GetHex());
@@ -2259,6 +2470,10 @@ bool DisconnectBlock(CBlock& block, CValidationState& state, CBlockIndex* pindex
     if (blockUndo.vtxundo.size() + 1 != block.vtx.size())
         return error("DisconnectBlock() : block and undo data inconsistent");
 
+    std::vector<std::pair<CAddressIndexKey, CAmount> > vAddressIndex;
+    std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > vAddressUnspentIndex;
+    std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> > vSpentIndex;
+
     // undo transactions in reverse order
     for (int i = block.vtx.size() - 1; i >= 0; i--) {
         const CTransaction& tx = block.vtx[i];
@@ -2306,6 +2521,17 @@ bool DisconnectBlock(CBlock& block, CValidationState& state, CBlockIndex* pindex
 
         uint256 hash = tx.GetHash();
 
+        if (fAddressIndex) {
+            for (unsigned int k = 0; k < tx.vout.size(); k++) {
+                int nAddressType;
+                uint160 hashBytes;
+                if (!GetAddressIndexKey(tx.vout[k].scriptPubKey, nAddressType, hashBytes))
+                    continue;
+                vAddressIndex.push_back(make_pair(CAddressIndexKey(nAddressType, hashBytes, pindex->nHeight, i, hash, k, false), tx.vout[k].nValue));
+                vAddressUnspentIndex.push_back(make_pair(CAddressUnspentKey(nAddressType, hashBytes, hash, k), CAddressUnspentValue()));
+            }
+        }
+
         // Check that all outputs are available and match the outputs in the block itself
         // exactly. Note that transactions with only provably unspendable outputs won't
         // have outputs available even in the block itself, so we handle that case
@@ -2354,10 +2580,34 @@ bool DisconnectBlock(CBlock& block, CValidationState& state, CBlockIndex* pindex
                 if (coins->vout.size() < out.n + 1)
                     coins->vout.resize(out.n + 1);
                 coins->vout[out.n] = undo.txout;
+
+                int nAddressType = ADDRESS_NONE;
+                uint160 hashBytes;
+                bool fAddress = (fAddressIndex || fSpentIndex) && GetAddressIndexKey(undo.txout.scriptPubKey, nAddressType, hashBytes);
+                if (fAddressIndex && fAddress) {
+                    vAddressIndex.push_back(make_pair(CAddressIndexKey(nAddressType, hashBytes, pindex->nHeight, i, hash, j, true), undo.txout.nValue * -1));
+                    vAddressUnspentIndex.push_back(make_pair(CAddressUnspentKey(nAddressType, hashBytes, out.hash, out.n),
+                        CAddressUnspentValue(undo.txout.nValue, undo.txout.scriptPubKey, coins->nHeight)));
+                }
+                if (fSpentIndex)
+                    vSpentIndex.push_back(make_pair(CSpentIndexKey(out.hash, out.n), CSpentIndexValue()));
             }
         }
     }
 
+    if (fRollbackIndexes) {
+        if (fAddressIndex) {
+            if (!pblocktree->EraseAddressIndex(vAddressIndex))
+                return state.Abort("Failed to delete address index");
+            if (!pblocktree->UpdateAddressUnspentIndex(vAddressUnspentIndex))
+                return state.Abort("Failed to write address unspent index");
+        }
+        if (fSpentIndex && !pblocktree->UpdateSpentIndex(vSpentIndex))
+            return state.Abort("Failed to write spent index");
+        if (fTimestampIndex && !pblocktree->EraseTimestampIndex(CTimestampIndexKey(pindex->nTime, pindex->GetBlockHash())))
+            return state.Abort("Failed to delete timestamp index");
+    }
+
     // move best block pointer to prevout block
     view.SetBestBlock(pindex->pprev->GetBlockHash());
 
@@ -2661,6 +2911,11 @@ static int64_t nTimeConnect = 0;
 static int64_t nTimeIndex = 0;
 static int64_t nTimeCallbacks = 0;
 static int64_t nTimeTotal = 0;
+static CPerfHistogram& perfTimeConnect = GetPerfHistogram("validation.connectblock.connect");
+static CPerfHistogram& perfTimeVerify = GetPerfHistogram("validation.connectblock.verify");
+static CPerfHistogram& perfTimeIndex = GetPerfHistogram("validation.connectblock.index");
+static CPerfHistogram& perfTimeCallbacks = GetPerfHistogram("validation.connectblock.callbacks");
+static CPerfCounter& perfInputs = GetPerfCounter("validation.connectblock.inputs");
 
 bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pindex, CCoinsViewCache& view, bool fJustCheck, bool fAlreadyChecked)
 {
@@ -2732,6 +2987,9 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
     unsigned int nMaxBlockSigOps = MAX_BLOCK_SIGOPS_CURRENT;
     vector<uint256> vSpendsInBlock;
     uint256 hashBlock = block.GetHash();
+    std::vector<std::pair<CAddressIndexKey, CAmount> > vAddressIndex;
+    std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > vAddressUnspentIndex;
+    std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> > vSpentIndex;
     for (unsigned int i = 0; i < block.vtx.size(); i++) {
         const CTransaction& tx = block.vtx[i];
 
@@ -2800,6 +3058,23 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
                 }
             }
 
+            if (fAddressIndex || fSpentIndex) {
+                uint256 txhash = tx.GetHash();
+                for (unsigned int j = 0; j < tx.vin.size(); j++) {
+                    const CTxIn& input = tx.vin[j];
+                    const CTxOut& prevout = view.GetOutputFor(input);
+                    int nAddressType = ADDRESS_NONE;
+                    uint160 hashBytes;
+                    bool fAddress = GetAddressIndexKey(prevout.scriptPubKey, nAddressType, hashBytes);
+                    if (fAddressIndex && fAddress) {
+                        vAddressIndex.push_back(make_pair(CAddressIndexKey(nAddressType, hashBytes, pindex->nHeight, i, txhash, j, true), prevout.nValue * -1));
+                        vAddressUnspentIndex.push_back(make_pair(CAddressUnspentKey(nAddressType, hashBytes, input.prevout.hash, input.prevout.n), CAddressUnspentValue()));
+                    }
+                    if (fSpentIndex)
+                        vSpentIndex.push_back(make_pair(CSpentIndexKey(input.prevout.hash, input.prevout.n), CSpentIndexValue(txhash, j, pindex->nHeight, prevout.nValue, nAddressType, hashBytes)));
+                }
+            }
+
             // Check that zHBET mints are not already known
             if (tx.IsZerocoinMint()) {
                 for (auto& out : tx.vout) {
@@ -2842,6 +3117,19 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
         }
         UpdateCoins(tx, state, view, i == 0 ? undoDummy : blockundo.vtxundo.back(), pindex->nHeight);
 
+        if (fAddressIndex) {
+            uint256 txhash = tx.GetHash();
+            for (unsigned int k = 0; k < tx.vout.size(); k++) {
+                const CTxOut& out = tx.vout[k];
+                int nAddressType;
+                uint160 hashBytes;
+                if (!GetAddressIndexKey(out.scriptPubKey, nAddressType, hashBytes))
+                    continue;
+                vAddressIndex.push_back(make_pair(CAddressIndexKey(nAddressType, hashBytes, pindex->nHeight, i, txhash, k, false), out.nValue));
+                vAddressUnspentIndex.push_back(make_pair(CAddressUnspentKey(nAddressType, hashBytes, txhash, k), CAddressUnspentValue(out.nValue, out.scriptPubKey, pindex->nHeight)));
+            }
+        }
+
         vPos.push_back(std::make_pair(tx.GetHash(), pos));
         pos.nTxOffset += ::GetSerializeSize(tx, SER_DISK, CLIENT_VERSION);
     }
@@ -2869,6 +3157,7 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
 
     int64_t nTime1 = GetTimeMicros();
     nTimeConnect += nTime1 - nTimeStart;
+    perfTimeConnect.Record(nTime1 - nTimeStart);
     LogPrint("bench", "      - Connect %u transactions: %.2fms (%.3fms/tx, %.3fms/txin) [%.2fs]\n", (unsigned)block.vtx.size(), 0.001 * (nTime1 - nTimeStart), 0.001 * (nTime1 - nTimeStart) / block.vtx.size(), nInputs <= 1 ? 0 : 0.001 * (nTime1 - nTimeStart) / (nInputs - 1), nTimeConnect * 0.000001);
 
     //PoW phase redistributed fees to miner. PoS stage destroys fees.
@@ -2893,6 +3182,8 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
         return state.DoS(100, false);
     int64_t nTime2 = GetTimeMicros();
     nTimeVerify += nTime2 - nTimeStart;
+    perfTimeVerify.Record(nTime2 - nTimeStart);
+    perfInputs.Add(nInputs);
     LogPrint("bench", "    - Verify %u txins: %.2fms (%.3fms/txin) [%.2fs]\n", nInputs - 1, 0.001 * (nTime2 - nTimeStart), nInputs <= 1 ? 0 : 0.001 * (nTime2 - nTimeStart) / (nInputs - 1), nTimeVerify * 0.000001);
 
     //IMPORTANT NOTE: Nothing before this point should actually store to disk (or even memory)
@@ -2955,11 +3246,23 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
         if (!pblocktree->WriteTxIndex(vPos))
             return state.Abort("Failed to write transaction index");
 
+    if (fAddressIndex) {
+        if (!pblocktree->WriteAddressIndex(vAddressIndex))
+            return state.Abort("Failed to write address index");
+        if (!pblocktree->UpdateAddressUnspentIndex(vAddressUnspentIndex))
+            return state.Abort("Failed to write address unspent index");
+    }
+    if (fSpentIndex && !pblocktree->UpdateSpentIndex(vSpentIndex))
+        return state.Abort("Failed to write spent index");
+    if (fTimestampIndex && !pblocktree->WriteTimestampIndex(CTimestampIndexKey(pindex->nTime, pindex->GetBlockHash())))
+        return state.Abort("Failed to write timestamp index");
+
     // add this block to the view's block chain
     view.SetBestBlock(pindex->GetBlockHash());
 
     int64_t nTime3 = GetTimeMicros();
     nTimeIndex += nTime3 - nTime2;
+    perfTimeIndex.Record(nTime3 - nTime2);
     LogPrint("bench", "    - Index writing: %.2fms [%.2fs]\n", 0.001 * (nTime3 - nTime2), nTimeIndex * 0.000001);
 
     // Watch for changes to the previous coinbase transaction.
@@ -2969,6 +3272,7 @@ bool ConnectBlock(const CBlock& block, CValidationState& state, CBlockIndex* pin
 
     int64_t nTime4 = GetTimeMicros();
     nTimeCallbacks += nTime4 - nTime3;
+    perfTimeCallbacks.Record(nTime4 - nTime3);
     LogPrint("bench", "    - Callbacks: %.2fms [%.2fs]\n", 0.001 * (nTime4 - nTime3), nTimeCallbacks * 0.000001);
 
     //Continue tracking possible movement of fraudulent funds until they are completely frozen
@@ -2995,15 +3299,19 @@ enum FlushStateMode {
  * Update the on-disk chain state.
  * The caches and indexes are flushed if either they're too large, forceWrite is set, or
  * fast is not set and it's been a while since the last write.
+ * The write itself happens on the pcoinsflusher thread; FLUSH_STATE_ALWAYS waits for it.
  */
 bool static FlushStateToDisk(CValidationState& state, FlushStateMode mode)
 {
     LOCK(cs_main);
     static int64_t nLastWrite = 0;
     try {
+        // While the previous flush is still being written, let the cache grow
+        // to twice its limit before waiting for it.
+        bool fWriting = pcoinsflusher->IsWriting();
         if ((mode == FLUSH_STATE_ALWAYS) ||
-            ((mode == FLUSH_STATE_PERIODIC || mode == FLUSH_STATE_IF_NEEDED) && pcoinsTip->GetCacheSize() > nCoinCacheSize) ||
-            (mode == FLUSH_STATE_PERIODIC && GetTimeMicros() > nLastWrite + DATABASE_WRITE_INTERVAL * 1000000)) {
+            ((mode == FLUSH_STATE_PERIODIC || mode == FLUSH_STATE_IF_NEEDED) && pcoinsTip->DynamicMemoryUsage() > (fWriting ? 2 : 1) * nCoinCacheUsage) ||
+            (mode == FLUSH_STATE_PERIODIC && !fWriting && GetTimeMicros() > nLastWrite + DATABASE_WRITE_INTERVAL * 1000000)) {
             // Typical CCoins structures on disk are around 100 bytes in size.
             // Pushing a new one to the database can cause it to be written
             // twice (once in the log, and once in the tables). This is already
@@ -3013,28 +3321,23 @@ bool static FlushStateToDisk(CValidationState& state, FlushStateMode mode)
                 return state.Error("out of disk space");
             // First make sure all block and undo data is flushed to disk.
             FlushBlockFile();
-            // Then update all block file information (which may refer to block and undo files).
-            bool fileschanged = false;
-            for (set<int>::iterator it = setDirtyFileInfo.begin(); it != setDirtyFileInfo.end();) {
-                if (!pblocktree->WriteBlockFileInfo(*it, vinfoBlockFile[*it])) {
-                    return state.Abort("Failed to write to block index");
-                }
-                fileschanged = true;
-                setDirtyFileInfo.erase(it++);
-            }
-            if (fileschanged && !pblocktree->WriteLastBlockFile(nLastBlockFile)) {
-                return state.Abort("Failed to write to block index");
-            }
-            for (set<CBlockIndex*>::iterator it = setDirtyBlockIndex.begin(); it != setDirtyBlockIndex.end();) {
-                if (!pblocktree->WriteBlockIndex(CDiskBlockIndex(*it))) {
-                    return state.Abort("Failed to write to block index");
-                }
-                setDirtyBlockIndex.erase(it++);
-            }
-            pblocktree->Sync();
-            // Finally flush the chainstate (which may refer to block index entries).
+            // Then snapshot all block file information (which may refer to block and undo files)
+            // and the dirty block index entries, to be written ahead of the chainstate.
+            std::vector<std::pair<int, CBlockFileInfo> > vFileInfo;
+            for (set<int>::iterator it = setDirtyFileInfo.begin(); it != setDirtyFileInfo.end(); it++)
+                vFileInfo.push_back(make_pair(*it, vinfoBlockFile[*it]));
+            setDirtyFileInfo.clear();
+            std::vector<CDiskBlockIndex> vBlockIndex;
+            vBlockIndex.reserve(setDirtyBlockIndex.size());
+            for (set<CBlockIndex*>::iterator it = setDirtyBlockIndex.begin(); it != setDirtyBlockIndex.end(); it++)
+                vBlockIndex.push_back(CDiskBlockIndex(*it));
+            setDirtyBlockIndex.clear();
+            pcoinsflusher->QueueBlockIndex(vFileInfo, nLastBlockFile, vBlockIndex);
+            // Finally hand over the chainstate (which may refer to block index entries).
             if (!pcoinsTip->Flush())
                 return state.Abort("Failed to write to coin database");
+            if (mode == FLUSH_STATE_ALWAYS && !pcoinsflusher->Wait())
+                return state.Abort("Failed to write to coin database");
             // Update best block in wallet (so we can detect restored wallets).
             if (mode != FLUSH_STATE_IF_NEEDED) {
                 GetMainSignals().SetBestChain(chainActive.GetLocator());
@@ -3066,10 +3369,10 @@ void static UpdateTip(CBlockIndex* pindexNew)
     nTimeBestReceived = GetTime();
     mempool.AddTransactionsUpdated(1);
 
-    LogPrintf("UpdateTip: new best=%s  height=%d  log2_work=%.8g  tx=%lu  date=%s progress=%f  cache=%u\n",
+    LogPrintf("UpdateTip: new best=%s  height=%d  log2_work=%.8g  tx=%lu  date=%s progress=%f  cache=%.1fMiB(%utx)\n",
         chainActive.Tip()->GetBlockHash().ToString(), chainActive.Height(), log(chainActive.Tip()->nChainWork.getdouble()) / log(2.0), (unsigned long)chainActive.Tip()->nChainTx,
         DateTimeStrFormat("%Y-%m-%d %H:%M:%S", chainActive.Tip()->GetBlockTime()),
-        Checkpoints::GuessVerificationProgress(chainActive.Tip()), (unsigned int)pcoinsTip->GetCacheSize());
+        Checkpoints::GuessVerificationProgress(chainActive.Tip()), pcoinsTip->DynamicMemoryUsage() * (1.0 / (1 << 20)), (unsigned int)pcoinsTip->GetCacheSize());
 
     cvBlockChange.notify_all();
 
@@ -3108,7 +3411,7 @@ bool static DisconnectTip(CValidationState& state)
     int64_t nStart = GetTimeMicros();
     {
         CCoinsViewCache view(pcoinsTip);
-        if (!DisconnectBlock(block, state, pindexDelete, view))
+        if (!DisconnectBlock(block, state, pindexDelete, view, true))
             return error("DisconnectTip() : DisconnectBlock %s failed", pindexDelete->GetBlockHash().ToString());
         assert(view.Flush());
     }
@@ -3117,17 +3420,24 @@ bool static DisconnectTip(CValidationState& state)
     if (!FlushStateToDisk(state, FLUSH_STATE_ALWAYS))
         return false;
     // Resurrect mempool transactions from the disconnected block.
+    std::vector<uint256> vHashUpdate;
     BOOST_FOREACH (const CTransaction& tx, block.vtx) {
         // ignore validation errors in resurrected transactions
         list<CTransaction> removed;
         CValidationState stateDummy;
         if (tx.IsCoinBase() || tx.IsCoinStake() || !AcceptToMemoryPool(mempool, stateDummy, tx, false, NULL))
             mempool.remove(tx, removed, true);
+        else if (mempool.exists(tx.GetHash()))
+            vHashUpdate.push_back(tx.GetHash());
     }
+    // Transactions already in the mempool may spend outputs of the ones added
+    // back, so the ancestor and descendant totals need fixing up.
+    mempool.UpdateTransactionsFromBlock(vHashUpdate);
     mempool.removeCoinbaseSpends(pcoinsTip, pindexDelete->nHeight);
     mempool.check(pcoinsTip);
     // Update chainActive and related variables.
     UpdateTip(pindexDelete->pprev);
+    BlockFilterIndexDisconnectTip(pindexDelete);
     // Let wallets know transactions went from 1-confirmed to
     // 0-confirmed or conflicted:
     BOOST_FOREACH (const CTransaction& tx, block.vtx) {
@@ -3141,6 +3451,12 @@ static int64_t nTimeConnectTotal = 0;
 static int64_t nTimeFlush = 0;
 static int64_t nTimeChainState = 0;
 static int64_t nTimePostConnect = 0;
+static CPerfHistogram& perfTimeReadFromDisk = GetPerfHistogram("validation.connecttip.read");
+static CPerfHistogram& perfTimeConnectTotal = GetPerfHistogram("validation.connecttip.connect");
+static CPerfHistogram& perfTimeFlush = GetPerfHistogram("validation.connecttip.flush");
+static CPerfHistogram& perfTimeChainState = GetPerfHistogram("validation.connecttip.chainstate");
+static CPerfHistogram& perfTimePostConnect = GetPerfHistogram("validation.connecttip.postconnect");
+static CPerfHistogram& perfTimeTotal = GetPerfHistogram("validation.connecttip.total");
 
 /**
  * Connect a new block to chainActive. pblock is either NULL or a pointer to a CBlock
@@ -3166,6 +3482,7 @@ bool static ConnectTip(CValidationState& state, CBlockIndex* pindexNew, CBlock*
     // Apply the block atomically to the chain state.
     int64_t nTime2 = GetTimeMicros();
     nTimeReadFromDisk += nTime2 - nTime1;
+    perfTimeReadFromDisk.Record(nTime2 - nTime1);
     int64_t nTime3;
     LogPrint("bench", "  - Load block from disk: %.2fms [%.2fs]\n", (nTime2 - nTime1) * 0.001, nTimeReadFromDisk * 0.000001);
     {
@@ -3180,11 +3497,13 @@ bool static ConnectTip(CValidationState& state, CBlockIndex* pindexNew, CBlock*
         mapBlockSource.erase(inv.hash);
         nTime3 = GetTimeMicros();
         nTimeConnectTotal += nTime3 - nTime2;
+        perfTimeConnectTotal.Record(nTime3 - nTime2);
         LogPrint("bench", "  - Connect total: %.2fms [%.2fs]\n", (nTime3 - nTime2) * 0.001, nTimeConnectTotal * 0.000001);
         assert(view.Flush());
     }
     int64_t nTime4 = GetTimeMicros();
     nTimeFlush += nTime4 - nTime3;
+    perfTimeFlush.Record(nTime4 - nTime3);
     LogPrint("bench", "  - Flush: %.2fms [%.2fs]\n", (nTime4 - nTime3) * 0.001, nTimeFlush * 0.000001);
 
     // Write the chain state to disk, if necessary. Always write to disk if this is the first of a new file.
@@ -3195,6 +3514,7 @@ bool static ConnectTip(CValidationState& state, CBlockIndex* pindexNew, CBlock*
         return false;
     int64_t nTime5 = GetTimeMicros();
     nTimeChainState += nTime5 - nTime4;
+    perfTimeChainState.Record(nTime5 - nTime4);
     LogPrint("bench", "  - Writing chainstate: %.2fms [%.2fs]\n", (nTime5 - nTime4) * 0.001, nTimeChainState * 0.000001);
 
     // Remove conflicting transactions from the mempool.
@@ -3203,6 +3523,8 @@ bool static ConnectTip(CValidationState& state, CBlockIndex* pindexNew, CBlock*
     mempool.check(pcoinsTip);
     // Update chainActive & related variables.
     UpdateTip(pindexNew);
+    BlockFilterIndexConnectTip(*pblock, pindexNew);
+    BudgetCollateralConnectTip(*pblock, pindexNew);
     // Tell wallet about transactions that went from mempool
     // to conflicted:
     BOOST_FOREACH (const CTransaction& tx, txConflicted) {
@@ -3216,6 +3538,8 @@ bool static ConnectTip(CValidationState& state, CBlockIndex* pindexNew, CBlock*
     int64_t nTime6 = GetTimeMicros();
     nTimePostConnect += nTime6 - nTime5;
     nTimeTotal += nTime6 - nTime1;
+    perfTimePostConnect.Record(nTime6 - nTime5);
+    perfTimeTotal.Record(nTime6 - nTime1);
     LogPrint("bench", "  - Connect postprocess: %.2fms [%.2fs]\n", (nTime6 - nTime5) * 0.001, nTimePostConnect * 0.000001);
     LogPrint("bench", "- Connect block: %.2fms [%.2fs]\n", (nTime6 - nTime1) * 0.001, nTimeTotal * 0.000001);
     return true;
@@ -3526,6 +3850,7 @@ bool InvalidateBlock(CValidationState& state, CBlockIndex* pindex)
     pindex->nStatus |= BLOCK_FAILED_VALID;
     setDirtyBlockIndex.insert(pindex);
     setBlockIndexCandidates.erase(pindex);
+    EraseBlocksAwaitingParent(pindex->GetBlockHash());
 
     while (chainActive.Contains(pindex)) {
         CBlockIndex* pindexWalk = chainActive.Tip();
@@ -3587,6 +3912,49 @@ bool ReconsiderBlock(CValidationState& state, CBlockIndex* pindex)
     return true;
 }
 
+/** Fill in the proof-of-stake fields and the stake modifier of a block index entry.
+ *  This needs the block's transactions, so entries created from a bare header get
+ *  it from ReceivedBlockTransactions once the block itself has arrived. */
+void static SetBlockIndexStakeData(CBlockIndex* pindexNew, const CBlock& block)
+{
+    uint256 hash = pindexNew->GetBlockHash();
+
+    //mark as PoS seen
+    if (block.IsProofOfStake()) {
+        pindexNew->SetProofOfStake();
+        pindexNew->prevoutStake = block.vtx[1].vin[0].prevout;
+        pindexNew->nStakeTime = block.nTime;
+        setStakeSeen.insert(make_pair(pindexNew->prevoutStake, pindexNew->nStakeTime));
+    }
+
+    if (pindexNew->pprev == NULL)
+        return;
+
+    // ppcoin: compute chain trust score
+    pindexNew->bnChainTrust = pindexNew->pprev->bnChainTrust + pindexNew->GetBlockTrust();
+
+    // ppcoin: compute stake entropy bit for stake modifier
+    if (!pindexNew->SetStakeEntropyBit(pindexNew->GetStakeEntropyBit()))
+        LogPrintf("AddToBlockIndex() : SetStakeEntropyBit() failed \n");
+
+    // ppcoin: record proof-of-stake hash value
+    if (pindexNew->IsProofOfStake()) {
+        if (!mapProofOfStake.count(hash))
+            LogPrintf("AddToBlockIndex() : hashProofOfStake not found in map \n");
+        pindexNew->hashProofOfStake = mapProofOfStake[hash];
+    }
+
+    // ppcoin: compute stake modifier
+    uint64_t nStakeModifier = 0;
+    bool fGeneratedStakeModifier = false;
+    if (!ComputeNextStakeModifier(pindexNew->pprev, nStakeModifier, fGeneratedStakeModifier))
+        LogPrintf("AddToBlockIndex() : ComputeNextStakeModifier() failed \n");
+    pindexNew->SetStakeModifier(nStakeModifier, fGeneratedStakeModifier);
+    pindexNew->nStakeModifierChecksum = GetStakeModifierChecksum(pindexNew);
+    if (!CheckStakeModifierCheckpoints(pindexNew->nHeight, pindexNew->nStakeModifierChecksum))
+        LogPrintf("AddToBlockIndex() : Rejected by stake modifier checkpoint height=%d, modifier=%s \n", pindexNew->nHeight, boost::lexical_cast<std::string>(nStakeModifier));
+}
+
 CBlockIndex* AddToBlockIndex(const CBlock& block)
 {
     // Check for duplicate
@@ -3604,10 +3972,6 @@ CBlockIndex* AddToBlockIndex(const CBlock& block)
     pindexNew->nSequenceId = 0;
     BlockMap::iterator mi = mapBlockIndex.insert(make_pair(hash, pindexNew)).first;
 
-    //mark as PoS seen
-    if (pindexNew->IsProofOfStake())
-        setStakeSeen.insert(make_pair(pindexNew->prevoutStake, pindexNew->nStakeTime));
-
     pindexNew->phashBlock = &((*mi).first);
     BlockMap::iterator miPrev = mapBlockIndex.find(block.hashPrevBlock);
     if (miPrev != mapBlockIndex.end()) {
@@ -3617,31 +3981,18 @@ CBlockIndex* AddToBlockIndex(const CBlock& block)
 
         //update previous block pointer
         pindexNew->pprev->pnext = pindexNew;
+    }
 
-        // ppcoin: compute chain trust score
-        pindexNew->bnChainTrust = (pindexNew->pprev ? pindexNew->pprev->bnChainTrust : 0) + pindexNew->GetBlockTrust();
-
-        // ppcoin: compute stake entropy bit for stake modifier
-        if (!pindexNew->SetStakeEntropyBit(pindexNew->GetStakeEntropyBit()))
-            LogPrintf("AddToBlockIndex() : SetStakeEntropyBit() failed \n");
+    // The hash is at hand here; record the proof of work check so startup need not redo it
+    if (pindexNew->nHeight <= Params().LAST_POW_BLOCK() && CheckProofOfWork(hash, pindexNew->nBits))
+        pindexNew->nStatus |= BLOCK_POW_CHECKED;
 
-        // ppcoin: record proof-of-stake hash value
-        if (pindexNew->IsProofOfStake()) {
-            if (!mapProofOfStake.count(hash))
-                LogPrintf("AddToBlockIndex() : hashProofOfStake not found in map \n");
-            pindexNew->hashProofOfStake = mapProofOfStake[hash];
-        }
+    // A header without transactions can't tell proof-of-stake from proof-of-work
+    if (block.vtx.empty() && hash != Params().HashGenesisBlock())
+        setStakeDataPending.insert(pindexNew);
+    else
+        SetBlockIndexStakeData(pindexNew, block);
 
-        // ppcoin: compute stake modifier
-        uint64_t nStakeModifier = 0;
-        bool fGeneratedStakeModifier = false;
-        if (!ComputeNextStakeModifier(pindexNew->pprev, nStakeModifier, fGeneratedStakeModifier))
-            LogPrintf("AddToBlockIndex() : ComputeNextStakeModifier() failed \n");
-        pindexNew->SetStakeModifier(nStakeModifier, fGeneratedStakeModifier);
-        pindexNew->nStakeModifierChecksum = GetStakeModifierChecksum(pindexNew);
-        if (!CheckStakeModifierCheckpoints(pindexNew->nHeight, pindexNew->nStakeModifierChecksum))
-            LogPrintf("AddToBlockIndex() : Rejected by stake modifier checkpoint height=%d, modifier=%s \n", pindexNew->nHeight, boost::lexical_cast<std::string>(nStakeModifier));
-    }
     pindexNew->nChainWork = (pindexNew->pprev ? pindexNew->pprev->nChainWork : 0) + GetBlockProof(*pindexNew);
     pindexNew->RaiseValidity(BLOCK_VALID_TREE);
     if (pindexBestHeader == NULL || pindexBestHeader->nChainWork < pindexNew->nChainWork)
@@ -3659,6 +4010,8 @@ CBlockIndex* AddToBlockIndex(const CBlock& block)
 /** Mark a block as having its data received and checked (up to BLOCK_VALID_TRANSACTIONS). */
 bool ReceivedBlockTransactions(const CBlock& block, CValidationState& state, CBlockIndex* pindexNew, const CDiskBlockPos& pos)
 {
+    if (setStakeDataPending.erase(pindexNew))
+        SetBlockIndexStakeData(pindexNew, block);
     if (block.IsProofOfStake())
         pindexNew->SetProofOfStake();
     pindexNew->nTx = block.vtx.size();
@@ -4156,6 +4509,18 @@ bool AcceptBlockHeader(const CBlock& block, CValidationState& state, CBlockIndex
     if (!ContextualCheckBlockHeader(block, state, pindexPrev))
         return false;
 
+    // A bare header (headers-first sync) is checked against the expected difficulty, and against
+    // its own hash during the proof-of-work phase. The stake kernel is checked once the block arrives;
+    // until then the "headers" handler bounds how many such headers each peer may add.
+    if (block.vtx.empty() && pindexPrev != NULL) {
+        if (!CheckWork(block, pindexPrev))
+            return state.DoS(50, error("%s : incorrect difficulty in header %s", __func__, hash.ToString()),
+                REJECT_INVALID, "bad-diffbits");
+        if (pindexPrev->nHeight < Params().LAST_POW_BLOCK() && !CheckProofOfWork(hash, block.nBits))
+            return state.DoS(50, error("%s : proof of work failed for header %s", __func__, hash.ToString()),
+                REJECT_INVALID, "high-hash");
+    }
+
     if (pindex == NULL)
         pindex = AddToBlockIndex(block);
 
@@ -4253,6 +4618,7 @@ bool AcceptBlock(CBlock& block, CValidationState& state, CBlockIndex** ppindex,
         if (state.IsInvalid() && !state.CorruptionPossible()) {
             pindex->nStatus |= BLOCK_FAILED_VALID;
             setDirtyBlockIndex.insert(pindex);
+            EraseBlocksAwaitingParent(pindex->GetBlockHash());
         }
         return false;
     }
@@ -4370,7 +4736,10 @@ bool ProcessNewBlock(CValidationState& state, CNode* pfrom, CBlock* pblock, CDis
         //if we get this far, check if the prev block is our prev block, if not then request sync and return false
         BlockMap::iterator mi = mapBlockIndex.find(pblock->hashPrevBlock);
         if (mi == mapBlockIndex.end()) {
-            pfrom->PushMessage("getblocks", chainActive.GetLocator(), uint256(0));
+            if (UseHeadersFirst(pfrom))
+                pfrom->PushMessage("getheaders", chainActive.GetLocator(pindexBestHeader), pblock->GetHash());
+            else
+                pfrom->PushMessage("getblocks", chainActive.GetLocator(), uint256(0));
             return false;
         }
     }
@@ -4450,6 +4819,7 @@ bool AbortNode(const std::string& strMessage, const std::string& userMessage)
 {
     strMiscWarning = strMessage;
     LogPrintf("*** %s\n", strMessage);
+    FlushDebugLog();
     uiInterface.ThreadSafeMessageBox(
         userMessage.empty() ? _("Error: A fatal internal error occured, see debug.log for details") : userMessage,
         "", CClientUIInterface::MSG_ERROR);
@@ -4549,6 +4919,8 @@ bool static LoadBlockIndexDB(string& strError)
     BOOST_FOREACH (const PAIRTYPE(int, CBlockIndex*) & item, vSortedByHeight) {
         CBlockIndex* pindex = item.second;
         pindex->nChainWork = (pindex->pprev ? pindex->pprev->nChainWork : 0) + GetBlockProof(*pindex);
+        if (!(pindex->nStatus & BLOCK_HAVE_DATA) && pindex->pprev)
+            setStakeDataPending.insert(pindex);
         if (pindex->nStatus & BLOCK_HAVE_DATA) {
             if (pindex->pprev) {
                 if (pindex->pprev->nChainTx) {
@@ -4618,6 +4990,14 @@ bool static LoadBlockIndexDB(string& strError)
     pblocktree->ReadFlag("txindex", fTxIndex);
     LogPrintf("LoadBlockIndexDB(): transaction index %s\n", fTxIndex ? "enabled" : "disabled");
 
+    // Check whether we have the address, spent and timestamp indexes
+    pblocktree->ReadFlag("addressindex", fAddressIndex);
+    LogPrintf("LoadBlockIndexDB(): address index %s\n", fAddressIndex ? "enabled" : "disabled");
+    pblocktree->ReadFlag("spentindex", fSpentIndex);
+    LogPrintf("LoadBlockIndexDB(): spent index %s\n", fSpentIndex ? "enabled" : "disabled");
+    pblocktree->ReadFlag("timestampindex", fTimestampIndex);
+    LogPrintf("LoadBlockIndexDB(): timestamp index %s\n", fTimestampIndex ? "enabled" : "disabled");
+
     // If this is written true before the next client init, then we know the shutdown process failed
     pblocktree->WriteFlag("shutdown", false);
 
@@ -4687,9 +5067,9 @@ bool CVerifyDB::VerifyDB(CCoinsView* coinsview, int nCheckLevel, int nCheckDepth
             }
         }
         // check level 3: check for inconsistencies during memory-only disconnect of tip blocks
-        if (nCheckLevel >= 3 && pindex == pindexState && (coins.GetCacheSize() + pcoinsTip->GetCacheSize()) <= nCoinCacheSize) {
+        if (nCheckLevel >= 3 && pindex == pindexState && (coins.DynamicMemoryUsage() + pcoinsTip->DynamicMemoryUsage()) <= nCoinCacheUsage) {
             bool fClean = true;
-            if (!DisconnectBlock(block, state, pindex, coins, &fClean))
+            if (!DisconnectBlock(block, state, pindex, coins, false, &fClean))
                 return error("VerifyDB() : *** irrecoverable inconsistency in block data at %d, hash=%s", pindex->nHeight, pindex->GetBlockHash().ToString());
             pindexState = pindex->pprev;
             if (!fClean) {
@@ -4726,6 +5106,8 @@ bool CVerifyDB::VerifyDB(CCoinsView* coinsview, int nCheckLevel, int nCheckDepth
 
 void UnloadBlockIndex()
 {
+    blockFileCache.Clear();
+    setStakeDataPending.clear();
     mapBlockIndex.clear();
     setBlockIndexCandidates.clear();
     chainActive.SetTip(NULL);
@@ -4751,6 +5133,12 @@ bool InitBlockIndex()
     // Use the provided setting for -txindex in the new database
     fTxIndex = GetBoolArg("-txindex", true);
     pblocktree->WriteFlag("txindex", fTxIndex);
+    fAddressIndex = GetBoolArg("-addressindex", DEFAULT_ADDRESSINDEX);
+    pblocktree->WriteFlag("addressindex", fAddressIndex);
+    fSpentIndex = GetBoolArg("-spentindex", DEFAULT_SPENTINDEX);
+    pblocktree->WriteFlag("spentindex", fSpentIndex);
+    fTimestampIndex = GetBoolArg("-timestampindex", DEFAULT_TIMESTAMPINDEX);
+    pblocktree->WriteFlag("timestampindex", fTimestampIndex);
     LogPrintf("Initializing databases...\n");
 
     // Only add the genesis block if not reindexing (in which case we reuse the one already on disk)
@@ -5164,7 +5552,7 @@ void static ProcessGetData(CNode* pfrom)
             boost::this_thread::interruption_point();
             it++;
 
-            if (inv.type == MSG_BLOCK || inv.type == MSG_FILTERED_BLOCK) {
+            if (inv.type == MSG_BLOCK || inv.type == MSG_FILTERED_BLOCK || inv.type == MSG_CMPCT_BLOCK) {
                 bool send = false;
                 BlockMap::iterator mi = mapBlockIndex.find(inv.hash);
                 if (mi != mapBlockIndex.end()) {
@@ -5189,7 +5577,13 @@ void static ProcessGetData(CNode* pfrom)
                         assert(!"cannot load block from disk");
                     if (inv.type == MSG_BLOCK)
                         pfrom->PushMessage("block", block);
-                    else // MSG_FILTERED_BLOCK)
+                    else if (inv.type == MSG_CMPCT_BLOCK) {
+                        // Older blocks are unlikely to be rebuilt from the peer's mempool
+                        if (mi->second->nHeight >= chainActive.Height() - MAX_CMPCTBLOCK_DEPTH)
+                            pfrom->PushMessage("cmpctblock", CBlockHeaderAndShortTxIDs(block));
+                        else
+                            pfrom->PushMessage("block", block);
+                    } else // MSG_FILTERED_BLOCK)
                     {
                         LOCK(pfrom->cs_filter);
                         if (pfrom->pfilter) {
@@ -5202,9 +5596,15 @@ void static ProcessGetData(CNode* pfrom)
                             // Thus, the protocol spec specified allows for us to provide duplicate txn here,
                             // however we MUST always provide at least what the remote peer needs
                             typedef std::pair<unsigned int, uint256> PairType;
-                            BOOST_FOREACH (PairType& pair, merkleBlock.vMatchedTxn)
-                                if (!pfrom->setInventoryKnown.count(CInv(MSG_TX, pair.second)))
+                            BOOST_FOREACH (PairType& pair, merkleBlock.vMatchedTxn) {
+                                bool fKnown;
+                                {
+                                    LOCK(pfrom->cs_inventory);
+                                    fKnown = pfrom->HasInventoryKnown(CInv(MSG_TX, pair.second));
+                                }
+                                if (!fKnown)
                                     pfrom->PushMessage("tx", block.vtx[pair.first]);
+                            }
                         }
                         // else
                         // no response
@@ -5359,7 +5759,7 @@ void static ProcessGetData(CNode* pfrom)
             // Track requests for our stuff.
             GetMainSignals().Inventory(inv.hash);
 
-            if (inv.type == MSG_BLOCK || inv.type == MSG_FILTERED_BLOCK)
+            if (inv.type == MSG_BLOCK || inv.type == MSG_FILTERED_BLOCK || inv.type == MSG_CMPCT_BLOCK)
                 break;
         }
     }
@@ -5379,6 +5779,127 @@ void static ProcessGetData(CNode* pfrom)
 }
 
 bool fRequestedSporksIDB = false;
+/** Process the blocks that were waiting for hashParent, then the blocks waiting for those. */
+void static ProcessBlocksAwaitingParent(const uint256& hashParent)
+{
+    std::deque<uint256> queue;
+    queue.push_back(hashParent);
+    while (!queue.empty()) {
+        std::vector<CBlockAwaitingParent> vBlocks;
+        {
+            LOCK(cs_main);
+            TakeBlocksAwaitingParent(queue.front(), vBlocks);
+        }
+        queue.pop_front();
+
+        BOOST_FOREACH (CBlockAwaitingParent& entry, vBlocks) {
+            uint256 hash = entry.block.GetHash();
+            {
+                LOCK(cs_main);
+                mapBlockSource[hash] = entry.nodeid;
+            }
+
+            CValidationState state;
+            bool fAccepted = ProcessNewBlock(state, NULL, &entry.block);
+            int nDoS;
+            if (state.IsInvalid(nDoS) && nDoS > 0) {
+                LOCK(cs_main);
+                Misbehaving(entry.nodeid, nDoS);
+            }
+
+            if (fAccepted) {
+                queue.push_back(hash);
+            } else {
+                // Descendants of a block we could not accept are dropped as well
+                LOCK(cs_main);
+                EraseBlocksAwaitingParent(hash);
+            }
+        }
+    }
+}
+
+/** Handle a block received from a peer, sent in full or rebuilt from a compact block. */
+void static ProcessBlockMessage(CNode* pfrom, CBlock& block)
+{
+    uint256 hashBlock = block.GetHash();
+    CInv inv(MSG_BLOCK, hashBlock);
+    LogPrint("net", "received block %s peer=%d\n", inv.hash.ToString(), pfrom->id);
+
+    bool fAwaitingParent;
+    {
+        LOCK(cs_main);
+        BlockMap::iterator miPrev = mapBlockIndex.find(block.hashPrevBlock);
+        if (miPrev == mapBlockIndex.end() && UseHeadersFirst(pfrom)) {
+            // Connect the headers up to this block first, it is downloaded again afterwards
+            pfrom->PushMessage("getheaders", chainActive.GetLocator(pindexBestHeader), hashBlock);
+            return;
+        }
+        //sometimes we will be sent their most recent block and its not the one we want, in that case tell where we are
+        if (miPrev == mapBlockIndex.end()) {
+            if (find(pfrom->vBlockRequested.begin(), pfrom->vBlockRequested.end(), hashBlock) != pfrom->vBlockRequested.end()) {
+                //we already asked for this block, so lets work backwards and ask for the previous block
+                pfrom->PushMessage("getblocks", chainActive.GetLocator(), block.hashPrevBlock);
+                pfrom->vBlockRequested.push_back(block.hashPrevBlock);
+            } else {
+                //ask to sync to this block
+                pfrom->PushMessage("getblocks", chainActive.GetLocator(), hashBlock);
+                pfrom->vBlockRequested.push_back(hashBlock);
+            }
+            return;
+        }
+
+        pfrom->AddInventoryKnown(inv);
+        fAwaitingParent = !(miPrev->second->nStatus & BLOCK_HAVE_DATA) && UseHeadersFirst(pfrom);
+        if (!fAwaitingParent) {
+            BlockMap::iterator mi = mapBlockIndex.find(hashBlock);
+            if (mi != mapBlockIndex.end() && (mi->second->nStatus & BLOCK_HAVE_DATA)) {
+                LogPrint("net", "%s : Already processed block %s, skipping ProcessNewBlock()\n", __func__, hashBlock.GetHex());
+                return;
+            }
+        }
+    }
+
+    if (fAwaitingParent) {
+        // Downloaded ahead of its parent; keep it until the parent is connected. Only keep a
+        // copy that passes the checks needing no context, as a bad copy would shadow the good
+        // one. The block signature is checked separately because the hash does not cover it.
+        CValidationState state;
+        bool fValid = CheckBlock(block, state);
+        if (fValid && !CheckBlockSignature(block))
+            fValid = state.DoS(100, error("%s : bad block signature", __func__), REJECT_INVALID, "bad-blk-sig");
+
+        LOCK(cs_main);
+        MarkBlockAsReceived(hashBlock);
+        if (!fValid) {
+            int nDoS;
+            if (state.IsInvalid(nDoS)) {
+                pfrom->PushMessage("reject", std::string("block"), state.GetRejectCode(),
+                                   state.GetRejectReason().substr(0, MAX_REJECT_MESSAGE_LENGTH), inv.hash);
+                if (nDoS > 0)
+                    Misbehaving(pfrom->GetId(), nDoS);
+            }
+        } else if (!AddBlockAwaitingParent(block, pfrom->GetId())) {
+            LogPrint("net", "%s : no room to keep block %s until its parent arrives\n", __func__, hashBlock.ToString());
+        }
+        return;
+    }
+
+    CValidationState state;
+    if (ProcessNewBlock(state, pfrom, &block))
+        ProcessBlocksAwaitingParent(hashBlock);
+    int nDoS;
+    if(state.IsInvalid(nDoS)) {
+        pfrom->PushMessage("reject", std::string("block"), state.GetRejectCode(),
+                           state.GetRejectReason().substr(0, MAX_REJECT_MESSAGE_LENGTH), inv.hash);
+        if(nDoS > 0) {
+            TRY_LOCK(cs_main, lockMain);
+            if(lockMain) Misbehaving(pfrom->GetId(), nDoS);
+        }
+    }
+    //disconnect this node if its old protocol version
+    pfrom->DisconnectOldProtocol(ActiveProtocol(), "block");
+}
+
 bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv, int64_t nTimeReceived)
 {
     RandAddSeedPerfmon();
@@ -5524,6 +6045,14 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
             LOCK(cs_main);
             State(pfrom->GetId())->fCurrentlyConnected = true;
         }
+
+        if (pfrom->nVersion >= SHORT_IDS_BLOCKS_VERSION) {
+            // Tell the peer we can serve compact blocks (BIP 152). We don't ask it to
+            // announce new blocks as cmpctblock, it keeps announcing them by inv.
+            bool fAnnounceUsingCMPCTBLOCK = false;
+            uint64_t nCMPCTBLOCKVersion = 1;
+            pfrom->PushMessage("sendcmpct", fAnnounceUsingCMPCTBLOCK, nCMPCTBLOCKVersion);
+        }
     }
 
 
@@ -5602,6 +6131,9 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
         LOCK(cs_main);
 
         std::vector<CInv> vToFetch;
+        uint256 hashLastUnknownBlock = 0;
+        // Near the tip most transactions of a new block are in our mempool already
+        int nFetchBlockType = State(pfrom->GetId())->fSupportsCompactBlocks && !IsInitialBlockDownload() ? MSG_CMPCT_BLOCK : MSG_BLOCK;
 
         for (unsigned int nInv = 0; nInv < vInv.size(); nInv++) {
             const CInv& inv = vInv[nInv];
@@ -5618,9 +6150,20 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
 
             if (inv.type == MSG_BLOCK) {
                 UpdateBlockAvailability(pfrom->GetId(), inv.hash);
-                if (!fAlreadyHave && !fImporting && !fReindex && !mapBlocksInFlight.count(inv.hash)) {
+                if (!fAlreadyHave && !fImporting && !fReindex && UseHeadersFirst(pfrom)) {
+                    // The headers preceding the last announced block are requested below; block
+                    // download then happens in SendMessages. Near the tip, ask for the block right away.
+                    hashLastUnknownBlock = inv.hash;
+                    if (chainActive.Tip()->GetBlockTime() > GetAdjustedTime() - Params().TargetSpacing() * 20 && !mapBlocksInFlight.count(inv.hash)) {
+                        vToFetch.push_back(CInv(nFetchBlockType, inv.hash));
+                        MarkBlockAsInFlight(pfrom->GetId(), inv.hash);
+                    }
+                } else if (!fAlreadyHave && !fImporting && !fReindex && !mapBlocksInFlight.count(inv.hash)) {
                     // Add this to the list of blocks to request
-                    vToFetch.push_back(inv);
+                    vToFetch.push_back(CInv(nFetchBlockType, inv.hash));
+                    // A cmpctblock reply is only accepted for a block in flight from its sender
+                    if (nFetchBlockType == MSG_CMPCT_BLOCK)
+                        MarkBlockAsInFlight(pfrom->GetId(), inv.hash);
                     LogPrint("net", "getblocks (%d) %s to peer=%d\n", pindexBestHeader->nHeight, inv.hash.ToString(), pfrom->id);
                 }
             }
@@ -5634,6 +6177,11 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
             }
         }
 
+        if (hashLastUnknownBlock != 0) {
+            LogPrint("net", "getheaders (%d) %s to peer=%d\n", pindexBestHeader->nHeight, hashLastUnknownBlock.ToString(), pfrom->id);
+            pfrom->PushMessage("getheaders", chainActive.GetLocator(pindexBestHeader), hashLastUnknownBlock);
+        }
+
         if (!vToFetch.empty())
             pfrom->PushMessage("getdata", vToFetch);
     }
@@ -5659,7 +6207,7 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
     }
 
 
-    else if (strCommand == "getblocks" || strCommand == "getheaders") {
+    else if (strCommand == "getblocks" || (strCommand == "getheaders" && !UseHeadersFirst(pfrom))) {
         CBlockLocator locator;
         uint256 hashStop;
         vRecv >> locator >> hashStop;
@@ -5691,7 +6239,7 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
     }
 
 
-    else if (strCommand == "headers" && Params().HeadersFirstSyncingActive()) {
+    else if (strCommand == "getheaders") {
         CBlockLocator locator;
         uint256 hashStop;
         vRecv >> locator >> hashStop;
@@ -5887,7 +6435,7 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
     }
 
 
-    else if (strCommand == "headers" && Params().HeadersFirstSyncingActive() && !fImporting && !fReindex) // Ignore headers received while importing
+    else if (strCommand == "headers" && UseHeadersFirst(pfrom) && !fImporting && !fReindex) // Ignore headers received while importing
     {
         std::vector<CBlockHeader> headers;
 
@@ -5910,6 +6458,8 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
             // Nothing interesting. Stop asking this peers for more headers.
             return true;
         }
+        CNodeState* nodestate = State(pfrom->GetId());
+        PruneUnconnectedHeaders(nodestate);
         CBlockIndex* pindexLast = NULL;
         BOOST_FOREACH (const CBlockHeader& header, headers) {
             CValidationState state;
@@ -5918,10 +6468,22 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
                 return error("non-continuous headers sequence");
             }
 
-            /*TODO: this has a CBlock cast on it so that it will compile. There should be a solution for this
-             * before headers are reimplemented on mainnet
-             */
-            if (!AcceptBlockHeader((CBlock)header, state, &pindexLast)) {
+            // The stake of a proof-of-stake header is only checked once its block arrives, so a
+            // peer gets to add a limited number of them ahead of the blocks it actually serves
+            bool fNewStakeHeader = false;
+            if (!mapBlockIndex.count(header.GetHash())) {
+                BlockMap::iterator miPrev = mapBlockIndex.find(header.hashPrevBlock);
+                fNewStakeHeader = miPrev != mapBlockIndex.end() && miPrev->second->nHeight >= Params().LAST_POW_BLOCK();
+            }
+            if (fNewStakeHeader && nodestate->vUnconnectedHeaders.size() >= MAX_UNCONNECTED_HEADERS_PER_PEER) {
+                LogPrint("net", "peer=%d has %u headers without blocks, waiting for those before taking more\n",
+                    pfrom->id, nodestate->vUnconnectedHeaders.size());
+                nodestate->fHeadersCapped = true;
+                break;
+            }
+
+            // A header carries no transactions, AcceptBlockHeader only applies the header checks to it
+            if (!AcceptBlockHeader(CBlock(header), state, &pindexLast)) {
                 int nDoS;
                 if (state.IsInvalid(nDoS)) {
                     if (nDoS > 0)
@@ -5930,12 +6492,14 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
                     return error(strError.c_str());
                 }
             }
+            if (fNewStakeHeader && pindexLast)
+                nodestate->vUnconnectedHeaders.push_back(pindexLast);
         }
 
         if (pindexLast)
             UpdateBlockAvailability(pfrom->GetId(), pindexLast->GetBlockHash());
 
-        if (nCount == MAX_HEADERS_RESULTS && pindexLast) {
+        if (nCount == MAX_HEADERS_RESULTS && pindexLast && !nodestate->fHeadersCapped) {
             // Headers message had its maximum size; the peer may have more headers.
             // TODO: optimize: if pindexLast is an ancestor of chainActive.Tip or pindexBestHeader, continue
             // from there instead.
@@ -5950,42 +6514,160 @@ bool static ProcessMessage(CNode* pfrom, string strCommand, CDataStream& vRecv,
     {
         CBlock block;
         vRecv >> block;
-        uint256 hashBlock = block.GetHash();
-        CInv inv(MSG_BLOCK, hashBlock);
-        LogPrint("net", "received block %s peer=%d\n", inv.hash.ToString(), pfrom->id);
+        ProcessBlockMessage(pfrom, block);
+    }
 
-        //sometimes we will be sent their most recent block and its not the one we want, in that case tell where we are
-        if (!mapBlockIndex.count(block.hashPrevBlock)) {
-            if (find(pfrom->vBlockRequested.begin(), pfrom->vBlockRequested.end(), hashBlock) != pfrom->vBlockRequested.end()) {
-                //we already asked for this block, so lets work backwards and ask for the previous block
-                pfrom->PushMessage("getblocks", chainActive.GetLocator(), block.hashPrevBlock);
-                pfrom->vBlockRequested.push_back(block.hashPrevBlock);
-            } else {
-                //ask to sync to this block
-                pfrom->PushMessage("getblocks", chainActive.GetLocator(), hashBlock);
-                pfrom->vBlockRequested.push_back(hashBlock);
+
+    else if (strCommand == "sendcmpct") {
+        bool fAnnounceUsingCMPCTBLOCK = false;
+        uint64_t nCMPCTBLOCKVersion = 0;
+        vRecv >> fAnnounceUsingCMPCTBLOCK >> nCMPCTBLOCKVersion;
+        // Blocks are always announced by inv; only the request side of BIP 152 is used
+        if (nCMPCTBLOCKVersion == 1) {
+            LOCK(cs_main);
+            State(pfrom->GetId())->fSupportsCompactBlocks = true;
+        }
+    }
+
+
+    else if (strCommand == "getblocktxn") {
+        BlockTransactionsRequest req;
+        vRecv >> req;
+
+        LOCK(cs_main);
+        BlockMap::iterator mi = mapBlockIndex.find(req.blockhash);
+        if (mi == mapBlockIndex.end() || !(mi->second->nStatus & BLOCK_HAVE_DATA)) {
+            LogPrint("net", "Peer %d sent us a getblocktxn for a block we don't have\n", pfrom->id);
+            return true;
+        }
+
+        if (mi->second->nHeight < chainActive.Height() - MAX_BLOCKTXN_DEPTH) {
+            // Serve deep blocks in full, through the regular getdata path
+            LogPrint("net", "Peer %d sent us a getblocktxn for a block > %i deep\n", pfrom->id, MAX_BLOCKTXN_DEPTH);
+            pfrom->vRecvGetData.push_back(CInv(MSG_BLOCK, req.blockhash));
+            ProcessGetData(pfrom);
+            return true;
+        }
+
+        CBlock block;
+        if (!ReadBlockFromDisk(block, mi->second))
+            return error("getblocktxn : cannot load block %s from disk", req.blockhash.ToString());
+
+        BlockTransactions resp(req);
+        for (size_t i = 0; i < req.indexes.size(); i++) {
+            if (req.indexes[i] >= block.vtx.size()) {
+                Misbehaving(pfrom->GetId(), 100);
+                return error("Peer %d sent us a getblocktxn with out-of-bounds tx indices", pfrom->id);
             }
-        } else {
+            resp.txn[i] = block.vtx[req.indexes[i]];
+        }
+        pfrom->PushMessage("blocktxn", resp);
+    }
+
+
+    else if (strCommand == "cmpctblock" && !fImporting && !fReindex) // Ignore blocks received while importing
+    {
+        CBlockHeaderAndShortTxIDs cmpctblock;
+        vRecv >> cmpctblock;
+
+        uint256 hashBlock = cmpctblock.header.GetHash();
+        CInv inv(MSG_BLOCK, hashBlock);
+        LogPrint("net", "received compact block %s peer=%d\n", hashBlock.ToString(), pfrom->id);
+
+        CBlock block;
+        {
+            LOCK(cs_main);
             pfrom->AddInventoryKnown(inv);
 
-            CValidationState state;
-            if (!mapBlockIndex.count(block.GetHash())) {
-                ProcessNewBlock(state, pfrom, &block);
-                int nDoS;
-                if(state.IsInvalid(nDoS)) {
-                    pfrom->PushMessage("reject", strCommand, state.GetRejectCode(),
-                                       state.GetRejectReason().substr(0, MAX_REJECT_MESSAGE_LENGTH), inv.hash);
-                    if(nDoS > 0) {
-                        TRY_LOCK(cs_main, lockMain);
-                        if(lockMain) Misbehaving(pfrom->GetId(), nDoS);
-                    }
-                }
-                //disconnect this node if its old protocol version
-                pfrom->DisconnectOldProtocol(ActiveProtocol(), strCommand);
-            } else {
-                LogPrint("net", "%s : Already processed block %s, skipping ProcessNewBlock()\n", __func__, block.GetHash().GetHex());
+            BlockMap::iterator mi = mapBlockIndex.find(hashBlock);
+            if (mi != mapBlockIndex.end() && (mi->second->nStatus & BLOCK_HAVE_DATA))
+                return true;
+
+            // Rebuilding scans the whole mempool for the short IDs, so only do it for
+            // blocks we asked this peer for. We never ask for high-bandwidth mode, so
+            // a peer has no reason to send one unasked.
+            map<uint256, pair<NodeId, list<QueuedBlock>::iterator> >::iterator itInFlight = mapBlocksInFlight.find(hashBlock);
+            if (itInFlight == mapBlocksInFlight.end() || itInFlight->second.first != pfrom->GetId()) {
+                LogPrint("net", "Peer %d sent us a compact block we didn't request\n", pfrom->id);
+                return true;
+            }
+
+            // Only rebuild blocks on top of a block we have. For anything else ask for the
+            // full block, whose handler knows how to catch up to it.
+            BlockMap::iterator miPrev = mapBlockIndex.find(cmpctblock.header.hashPrevBlock);
+            if (miPrev == mapBlockIndex.end() || !(miPrev->second->nStatus & BLOCK_HAVE_DATA)) {
+                pfrom->PushMessage("getdata", std::vector<CInv>(1, inv));
+                return true;
+            }
+
+            std::shared_ptr<PartiallyDownloadedBlock> partialBlock(new PartiallyDownloadedBlock(&mempool));
+            ReadStatus status = partialBlock->InitData(cmpctblock, vExtraTxnForCompact);
+            if (status == READ_STATUS_INVALID) {
+                Misbehaving(pfrom->GetId(), 100);
+                return error("Peer %d sent us invalid compact block", pfrom->id);
+            } else if (status == READ_STATUS_FAILED) {
+                // Duplicate short IDs, fall back to the full block
+                pfrom->PushMessage("getdata", std::vector<CInv>(1, inv));
+                return true;
+            }
+
+            BlockTransactionsRequest req;
+            for (size_t i = 0; i < cmpctblock.BlockTxCount(); i++) {
+                if (!partialBlock->IsTxAvailable(i))
+                    req.indexes.push_back(i);
+            }
+            if (!req.indexes.empty()) {
+                CNodeState* nodestate = State(pfrom->GetId());
+                nodestate->partialBlock = partialBlock;
+                nodestate->hashPartialBlock = hashBlock;
+                req.blockhash = hashBlock;
+                pfrom->PushMessage("getblocktxn", req);
+                return true;
+            }
+
+            if (partialBlock->FillBlock(block, std::vector<CTransaction>()) != READ_STATUS_OK) {
+                pfrom->PushMessage("getdata", std::vector<CInv>(1, inv));
+                return true;
             }
         }
+        ProcessBlockMessage(pfrom, block);
+    }
+
+
+    else if (strCommand == "blocktxn" && !fImporting && !fReindex) // Ignore blocks received while importing
+    {
+        BlockTransactions resp;
+        vRecv >> resp;
+
+        CBlock block;
+        {
+            LOCK(cs_main);
+            CNodeState* nodestate = State(pfrom->GetId());
+            if (!nodestate->partialBlock || nodestate->hashPartialBlock != resp.blockhash) {
+                LogPrint("net", "Peer %d sent us block transactions for block we weren't expecting\n", pfrom->id);
+                return true;
+            }
+            // The block may have come from elsewhere, or the request timed out, since the getblocktxn
+            map<uint256, pair<NodeId, list<QueuedBlock>::iterator> >::iterator itInFlight = mapBlocksInFlight.find(resp.blockhash);
+            if (itInFlight == mapBlocksInFlight.end() || itInFlight->second.first != pfrom->GetId()) {
+                LogPrint("net", "Peer %d sent us block transactions for block we no longer wait for\n", pfrom->id);
+                nodestate->partialBlock.reset();
+                return true;
+            }
+
+            std::shared_ptr<PartiallyDownloadedBlock> partialBlock = nodestate->partialBlock;
+            nodestate->partialBlock.reset();
+            ReadStatus status = partialBlock->FillBlock(block, resp.txn);
+            if (status == READ_STATUS_INVALID) {
+                Misbehaving(pfrom->GetId(), 100);
+                return error("Peer %d sent us invalid compact block/non-matching block transactions", pfrom->id);
+            } else if (status == READ_STATUS_FAILED) {
+                // Might have collided, fall back to the full block
+                pfrom->PushMessage("getdata", std::vector<CInv>(1, CInv(MSG_BLOCK, resp.blockhash)));
+                return true;
+            }
+        }
+        ProcessBlockMessage(pfrom, block);
     }
 
 
@@ -6239,6 +6921,37 @@ int ActiveProtocol()
     return MIN_PEER_PROTO_VERSION_BEFORE_ENFORCEMENT;
 }
 
+/**
+ * The commands ProcessMessage and the masternode, budget, spork and SwiftTX handlers
+ * know. Anything else a peer sends is timed as net.msg.other, so that peers cannot
+ * grow the perf registry or crowd out the real commands.
+ */
+static const char* const pszPerfMessageCommands[] = {
+    "addr", "alert", "block", "blocktxn", "cmpctblock", "dstx", "filteradd", "filterclear",
+    "filterload", "getaddr", "getblocks", "getblocktxn", "getdata", "getheaders", "headers",
+    "inv", "mempool", "ping", "pong", "reject", "sendcmpct", "tx", "verack", "version",
+    "dsa", "dsc", "dsee", "dseep", "dseg", "dsf", "dsi", "dsq", "dss", "dssu",
+    "fbs", "fbvote", "getsporks", "ix", "mnb", "mnget", "mnp", "mnvs", "mnw", "mprop",
+    "mvote", "spork", "ssc", "txlvote"};
+
+static CPerfHistogram& GetMessagePerfHistogram(const std::string& strCommand)
+{
+    static boost::mutex csCommands;
+    static std::map<std::string, CPerfHistogram*> mapCommands;
+    boost::mutex::scoped_lock lock(csCommands);
+    std::map<std::string, CPerfHistogram*>::iterator it = mapCommands.find(strCommand);
+    if (it != mapCommands.end())
+        return *it->second;
+    for (unsigned int i = 0; i < ARRAYLEN(pszPerfMessageCommands); i++) {
+        if (strCommand == pszPerfMessageCommands[i]) {
+            CPerfHistogram* phistogram = &GetPerfHistogram("net.msg." + strCommand);
+            mapCommands.insert(std::make_pair(strCommand, phistogram));
+            return *phistogram;
+        }
+    }
+    return GetPerfHistogram("net.msg.other");
+}
+
 // requires LOCK(cs_vRecvMsg)
 bool ProcessMessages(CNode* pfrom)
 {
@@ -6314,6 +7027,7 @@ bool ProcessMessages(CNode* pfrom)
         // Process message
         bool fRet = false;
         try {
+            CPerfTimer perfTimer(GetMessagePerfHistogram(strCommand));
             fRet = ProcessMessage(pfrom, strCommand, vRecv, msg.nTime);
             boost::this_thread::interruption_point();
         } catch (std::ios_base::failure& e) {
@@ -6446,6 +7160,15 @@ bool SendMessages(CNode* pto, bool fSendTrickle)
             pto->PushMessage("reject", (string) "block", reject.chRejectCode, reject.strRejectReason, reject.hashBlock);
         state.rejects.clear();
 
+        // Resume headers sync with a peer that had too many headers without blocks, once most arrived
+        if (state.fHeadersCapped) {
+            PruneUnconnectedHeaders(&state);
+            if (state.vUnconnectedHeaders.size() < MAX_UNCONNECTED_HEADERS_PER_PEER / 2) {
+                state.fHeadersCapped = false;
+                pto->PushMessage("getheaders", chainActive.GetLocator(pindexBestHeader), uint256(0));
+            }
+        }
+
         // Start block sync
         if (pindexBestHeader == NULL)
             pindexBestHeader = chainActive.Tip();
@@ -6455,10 +7178,13 @@ bool SendMessages(CNode* pto, bool fSendTrickle)
             if (nSyncStarted == 0 || pindexBestHeader->GetBlockTime() > GetAdjustedTime() - 6 * 60 * 60) { // NOTE: was "close to today" and 24h in Bitcoin
                 state.fSyncStarted = true;
                 nSyncStarted++;
-                //CBlockIndex *pindexStart = pindexBestHeader->pprev ? pindexBestHeader->pprev : pindexBestHeader;
-                //LogPrint("net", "initial getheaders (%d) to peer=%d (startheight:%d)\n", pindexStart->nHeight, pto->id, pto->nStartingHeight);
-                //pto->PushMessage("getheaders", chainActive.GetLocator(pindexStart), uint256(0));
-                pto->PushMessage("getblocks", chainActive.GetLocator(chainActive.Tip()), uint256(0));
+                if (UseHeadersFirst(pto)) {
+                    CBlockIndex* pindexStart = pindexBestHeader->pprev ? pindexBestHeader->pprev : pindexBestHeader;
+                    LogPrint("net", "initial getheaders (%d) to peer=%d (startheight:%d)\n", pindexStart->nHeight, pto->id, pto->nStartingHeight);
+                    pto->PushMessage("getheaders", chainActive.GetLocator(pindexStart), uint256(0));
+                } else {
+                    pto->PushMessage("getblocks", chainActive.GetLocator(chainActive.Tip()), uint256(0));
+                }
             }
         }
 
@@ -6473,41 +7199,69 @@ bool SendMessages(CNode* pto, bool fSendTrickle)
         // Message: inventory
         //
         vector<CInv> vInv;
-        vector<CInv> vInvWait;
         {
             LOCK(pto->cs_inventory);
-            vInv.reserve(pto->vInventoryToSend.size());
-            vInvWait.reserve(pto->vInventoryToSend.size());
-            BOOST_FOREACH (const CInv& inv, pto->vInventoryToSend) {
-                if (pto->setInventoryKnown.count(inv))
-                    continue;
+            vInv.reserve(std::min<size_t>(1000, pto->vInventoryBlockToSend.size() + pto->mapInventoryToSend.size() * INVENTORY_BROADCAST_MAX));
 
-                // trickle out tx inv to protect privacy
-                if (inv.type == MSG_TX && !fSendTrickle) {
-                    // 1/4 of tx invs blast to all immediately
-                    static uint256 hashSalt;
-                    if (hashSalt == 0)
-                        hashSalt = GetRandHash();
-                    uint256 hashRand = inv.hash ^ hashSalt;
-                    hashRand = Hash(BEGIN(hashRand), END(hashRand));
-                    bool fTrickleWait = ((hashRand & 3) != 0);
-
-                    if (fTrickleWait) {
-                        vInvWait.push_back(inv);
+            // Blocks go out right away, in order
+            BOOST_FOREACH (const uint256& hash, pto->vInventoryBlockToSend) {
+                CInv inv(MSG_BLOCK, hash);
+                if (pto->HasInventoryKnown(inv))
+                    continue;
+                pto->SetInventoryKnown(inv);
+                vInv.push_back(inv);
+                if (vInv.size() >= 1000) {
+                    pto->PushMessage("inv", vInv);
+                    vInv.clear();
+                }
+            }
+            pto->vInventoryBlockToSend.clear();
+
+            // Everything else is announced per type, at most INVENTORY_BROADCAST_MAX items
+            // of a type per pass, so a burst of masternode or budget messages is spread out
+            // instead of crowding out the other queues.
+            map<int, set<uint256> >::iterator mi = pto->mapInventoryToSend.begin();
+            while (mi != pto->mapInventoryToSend.end()) {
+                set<uint256>& setHashes = mi->second;
+                unsigned int nSent = 0;
+                set<uint256>::iterator it = setHashes.begin();
+                while (it != setHashes.end() && nSent < INVENTORY_BROADCAST_MAX) {
+                    CInv inv(mi->first, *it);
+                    if (pto->HasInventoryKnown(inv)) {
+                        setHashes.erase(it++);
                         continue;
                     }
-                }
 
-                // returns true if wasn't already contained in the set
-                if (pto->setInventoryKnown.insert(inv).second) {
+                    // trickle out tx inv to protect privacy
+                    if (mi->first == MSG_TX && !fSendTrickle) {
+                        // 1/4 of tx invs blast to all immediately
+                        static uint256 hashSalt;
+                        if (hashSalt == 0)
+                            hashSalt = GetRandHash();
+                        uint256 hashRand = *it ^ hashSalt;
+                        hashRand = Hash(BEGIN(hashRand), END(hashRand));
+                        bool fTrickleWait = ((hashRand & 3) != 0);
+
+                        if (fTrickleWait) {
+                            ++it;
+                            continue;
+                        }
+                    }
+
+                    pto->SetInventoryKnown(inv);
                     vInv.push_back(inv);
+                    nSent++;
+                    setHashes.erase(it++);
                     if (vInv.size() >= 1000) {
                         pto->PushMessage("inv", vInv);
                         vInv.clear();
                     }
                 }
+                if (setHashes.empty())
+                    pto->mapInventoryToSend.erase(mi++);
+                else
+                    ++mi;
             }
-            pto->vInventoryToSend = vInvWait;
         }
         if (!vInv.empty())
             pto->PushMessage("inv", vInv);
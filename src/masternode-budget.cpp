@@ -12,6 +12,7 @@
 #include "masternode.h"
 #include "masternodeman.h"
 #include "obfuscation.h"
+#include "perfstats.h"
 #include "util.h"
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
@@ -20,8 +21,12 @@ CBudgetManager budget;
 CCriticalSection cs_budget;
 
 std::map<uint256, int64_t> askedForSourceProposalOrBudget;
-std::vector<CBudgetProposalBroadcast> vecImmatureBudgetProposals;
-std::vector<CFinalizedBudgetBroadcast> vecImmatureFinalizedBudgets;
+std::multimap<int, CBudgetProposalBroadcast> mapImmatureBudgetProposals;
+std::multimap<int, CFinalizedBudgetBroadcast> mapImmatureFinalizedBudgets;
+
+// fee transactions by txid, filled as blocks connect and on the first lookup of older ones
+static CCriticalSection cs_budgetCollateral;
+static std::map<uint256, CBudgetCollateral> mapBudgetCollateral;
 
 int nSubmittedFinalBudget;
 
@@ -34,54 +39,95 @@ int GetBudgetPaymentCycleBlocks()
     return 144; //ten times per day
 }
 
-bool IsBudgetCollateralValid(uint256 nTxCollateralHash, uint256 nExpectedHash, std::string& strError, int64_t& nTime, int& nConf, bool fBudgetFinalization)
+CBudgetCollateral::CBudgetCollateral(const CTransaction& tx, const CBlockIndex* pindexIn)
 {
-    CTransaction txCollateral;
+    pindex = pindexIn;
+    fStandard = (tx.nLockTime == 0);
+
+    BOOST_FOREACH (const CTxOut& o, tx.vout) {
+        const CScript& script = o.scriptPubKey;
+        if (!script.IsNormalPaymentScript() && !script.IsUnspendable())
+            fStandard = false;
+        // OP_RETURN followed by a push of the 32 byte hash of the budget object
+        if (script.size() == 34 && script[0] == OP_RETURN && script[1] == 32 &&
+            o.nValue >= std::min(BUDGET_FEE_TX, PROPOSAL_FEE_TX)) {
+            vFees.push_back(make_pair(uint256(std::vector<unsigned char>(script.begin() + 2, script.end())), o.nValue));
+        }
+    }
+}
+
+void BudgetCollateralConnectTip(const CBlock& block, const CBlockIndex* pindex)
+{
+    AssertLockHeld(cs_main);
+
+    BOOST_FOREACH (const CTransaction& tx, block.vtx) {
+        CBudgetCollateral collateral(tx, pindex);
+        if (collateral.vFees.empty()) continue;
+
+        LOCK(cs_budgetCollateral);
+        mapBudgetCollateral[tx.GetHash()] = collateral;
+    }
+}
+
+static bool FindBudgetCollateral(const uint256& txid, CBudgetCollateral& collateral)
+{
+    {
+        LOCK(cs_budgetCollateral);
+        std::map<uint256, CBudgetCollateral>::const_iterator it = mapBudgetCollateral.find(txid);
+        // entries of blocks that were reorganized away are looked up again
+        if (it != mapBudgetCollateral.end() && chainActive.Contains(it->second.pindex)) {
+            collateral = it->second;
+            return true;
+        }
+    }
+
+    CTransaction tx;
     uint256 nBlockHash;
-    if (!GetTransaction(nTxCollateralHash, txCollateral, nBlockHash, true)) {
-        strError = strprintf("Can't find collateral tx %s", txCollateral.ToString());
+    if (!GetTransaction(txid, tx, nBlockHash, true))
+        return false;
+
+    const CBlockIndex* pindex = NULL;
+    if (nBlockHash != uint256(0)) {
+        BlockMap::iterator mi = mapBlockIndex.find(nBlockHash);
+        if (mi != mapBlockIndex.end() && (*mi).second && chainActive.Contains((*mi).second))
+            pindex = (*mi).second;
+    }
+
+    collateral = CBudgetCollateral(tx, pindex);
+    if (pindex && !collateral.vFees.empty()) {
+        LOCK(cs_budgetCollateral);
+        mapBudgetCollateral[txid] = collateral;
+    }
+    return true;
+}
+
+bool IsBudgetCollateralValid(uint256 nTxCollateralHash, uint256 nExpectedHash, std::string& strError, int64_t& nTime, int& nConf, bool fBudgetFinalization)
+{
+    CBudgetCollateral collateral;
+    if (!FindBudgetCollateral(nTxCollateralHash, collateral)) {
+        strError = strprintf("Can't find collateral tx %s", nTxCollateralHash.ToString());
         LogPrint("mnbudget","CBudgetProposalBroadcast::IsBudgetCollateralValid - %s\n", strError);
         return false;
     }
 
-    if (txCollateral.vout.size() < 1) return false;
-    if (txCollateral.nLockTime != 0) return false;
+    if (!collateral.fStandard) {
+        strError = strprintf("Invalid Script or nLockTime %s", nTxCollateralHash.ToString());
+        LogPrint("mnbudget","CBudgetProposalBroadcast::IsBudgetCollateralValid - %s\n", strError);
+        return false;
+    }
 
-    CScript findScript;
-    findScript << OP_RETURN << ToByteVector(nExpectedHash);
+    // Collateral for budget finalization
+    // Note: there are still old valid budgets out there, but the check for the new 5 HBET finalization collateral
+    //       will also cover the old 50 HBET finalization collateral.
+    CAmount nFeeRequired = fBudgetFinalization ? BUDGET_FEE_TX : PROPOSAL_FEE_TX;
 
     bool foundOpReturn = false;
-    BOOST_FOREACH (const CTxOut o, txCollateral.vout) {
-        if (!o.scriptPubKey.IsNormalPaymentScript() && !o.scriptPubKey.IsUnspendable()) {
-            strError = strprintf("Invalid Script %s", txCollateral.ToString());
-            LogPrint("mnbudget","CBudgetProposalBroadcast::IsBudgetCollateralValid - %s\n", strError);
-            return false;
-        }
-        if (fBudgetFinalization) {
-            // Collateral for budget finalization
-            // Note: there are still old valid budgets out there, but the check for the new 5 HBET finalization collateral
-            //       will also cover the old 50 HBET finalization collateral.
-            LogPrint("mnbudget", "Final Budget: o.scriptPubKey(%s) == findScript(%s) ?\n", o.scriptPubKey.ToString(), findScript.ToString());
-            if (o.scriptPubKey == findScript) {
-                LogPrint("mnbudget", "Final Budget: o.nValue(%ld) >= BUDGET_FEE_TX(%ld) ?\n", o.nValue, BUDGET_FEE_TX);
-                if(o.nValue >= BUDGET_FEE_TX) {
-                    foundOpReturn = true;
-                }
-            }
-        }
-        else {
-            // Collateral for normal budget proposal
-            LogPrint("mnbudget", "Normal Budget: o.scriptPubKey(%s) == findScript(%s) ?\n", o.scriptPubKey.ToString(), findScript.ToString());
-            if (o.scriptPubKey == findScript) {
-                LogPrint("mnbudget", "Normal Budget: o.nValue(%ld) >= PROPOSAL_FEE_TX(%ld) ?\n", o.nValue, PROPOSAL_FEE_TX);
-                if(o.nValue >= PROPOSAL_FEE_TX) {
-                    foundOpReturn = true;
-                }
-            }
-        }
+    for (unsigned int i = 0; i < collateral.vFees.size(); i++) {
+        if (collateral.vFees[i].first == nExpectedHash && collateral.vFees[i].second >= nFeeRequired)
+            foundOpReturn = true;
     }
     if (!foundOpReturn) {
-        strError = strprintf("Couldn't find opReturn %s in %s", nExpectedHash.ToString(), txCollateral.ToString());
+        strError = strprintf("Couldn't find opReturn %s in %s", nExpectedHash.ToString(), nTxCollateralHash.ToString());
         LogPrint("mnbudget","CBudgetProposalBroadcast::IsBudgetCollateralValid - %s\n", strError);
         return false;
     }
@@ -93,15 +139,9 @@ bool IsBudgetCollateralValid(uint256 nTxCollateralHash, uint256 nExpectedHash, s
     */
 
     int conf = GetIXConfirmations(nTxCollateralHash);
-    if (nBlockHash != uint256(0)) {
-        BlockMap::iterator mi = mapBlockIndex.find(nBlockHash);
-        if (mi != mapBlockIndex.end() && (*mi).second) {
-            CBlockIndex* pindex = (*mi).second;
-            if (chainActive.Contains(pindex)) {
-                conf += chainActive.Height() - pindex->nHeight + 1;
-                nTime = pindex->nTime;
-            }
-        }
+    if (collateral.pindex) {
+        conf += chainActive.Height() - collateral.pindex->nHeight + 1;
+        nTime = collateral.pindex->nTime;
     }
 
     nConf = conf;
@@ -381,6 +421,10 @@ CBudgetDB::ReadResult CBudgetDB::Read(CBudgetManager& objToLoad, bool fDryRun)
             return IncorrectMagicNumber;
         }
 
+        // A dry run only checks that the file is intact and ours, without loading it
+        if (fDryRun)
+            return Ok;
+
         // de-serialize data into CBudgetManager object
         ssObj >> objToLoad;
     } catch (std::exception& e) {
@@ -391,12 +435,6 @@ CBudgetDB::ReadResult CBudgetDB::Read(CBudgetManager& objToLoad, bool fDryRun)
 
     LogPrint("mnbudget","Loaded info from budget.dat  %dms\n", GetTimeMillis() - nStart);
     LogPrint("mnbudget","  %s\n", objToLoad.ToString());
-    if (!fDryRun) {
-        LogPrint("mnbudget","Budget manager - cleaning....\n");
-        objToLoad.CheckAndRemove();
-        LogPrint("mnbudget","Budget manager - result:\n");
-        LogPrint("mnbudget","  %s\n", objToLoad.ToString());
-    }
 
     return Ok;
 }
@@ -455,12 +493,14 @@ bool CBudgetManager::AddProposal(CBudgetProposal& budgetProposal)
     }
 
     mapProposals.insert(make_pair(budgetProposal.GetHash(), budgetProposal));
+    nProposalsVersion++;
     LogPrint("mnbudget","CBudgetManager::AddProposal - proposal %s added\n", budgetProposal.GetName ().c_str ());
     return true;
 }
 
 void CBudgetManager::CheckAndRemove()
 {
+    PERF_TIMER("budget.checkandremove");
     int nHeight = 0;
 
     // Add some verbosity once loading blocks from files has finished
@@ -525,6 +565,7 @@ void CBudgetManager::CheckAndRemove()
     // Remove invalid entries by overwriting complete map
     mapFinalizedBudgets.swap(tmpMapFinalizedBudgets);
     mapProposals.swap(tmpMapProposals);
+    nProposalsVersion++;
 
     // clang doesn't accept copy assignemnts :-/
     // mapFinalizedBudgets = tmpMapFinalizedBudgets;
@@ -779,13 +820,34 @@ std::vector<CBudgetProposal*> CBudgetManager::GetBudget()
 {
     LOCK(cs);
 
+    int nEstablished = 0;
+    std::map<uint256, CBudgetProposal>::iterator it = mapProposals.begin();
+    while (it != mapProposals.end()) {
+        (*it).second.CleanAndRemove(false);
+        if ((*it).second.IsEstablished()) nEstablished++;
+        ++it;
+    }
+
+    CBlockIndex* pindexPrev = chainActive.Tip();
+    if (pindexPrev == NULL) return std::vector<CBudgetProposal*>();
+
+    int nBlockStart = pindexPrev->nHeight - pindexPrev->nHeight % GetBudgetPaymentCycleBlocks() + GetBudgetPaymentCycleBlocks();
+    int nBlockEnd = nBlockStart + GetBudgetPaymentCycleBlocks() - 1;
+    int nThreshold = mnodeman.CountEnabled(ActiveProtocol()) / 10;
+    unsigned int nListVersion = mnodeman.GetListVersion();
+
+    // The ranking only changes with the cycle, the votes, the masternode list or proposals coming of age
+    if (nRankedProposalsVersion == nProposalsVersion && nRankedBlockStart == nBlockStart &&
+        nRankedListVersion == nListVersion && nRankedThreshold == nThreshold && nRankedEstablished == nEstablished) {
+        return vRankedBudget;
+    }
+
     // ------- Sort budgets by Yes Count
 
     std::vector<std::pair<CBudgetProposal*, int> > vBudgetPorposalsSort;
 
-    std::map<uint256, CBudgetProposal>::iterator it = mapProposals.begin();
+    it = mapProposals.begin();
     while (it != mapProposals.end()) {
-        (*it).second.CleanAndRemove(false);
         vBudgetPorposalsSort.push_back(make_pair(&((*it).second), (*it).second.GetYeas() - (*it).second.GetNays()));
         ++it;
     }
@@ -797,11 +859,6 @@ std::vector<CBudgetProposal*> CBudgetManager::GetBudget()
     std::vector<CBudgetProposal*> vBudgetProposalsRet;
 
     CAmount nBudgetAllocated = 0;
-    CBlockIndex* pindexPrev = chainActive.Tip();
-    if (pindexPrev == NULL) return vBudgetProposalsRet;
-
-    int nBlockStart = pindexPrev->nHeight - pindexPrev->nHeight % GetBudgetPaymentCycleBlocks() + GetBudgetPaymentCycleBlocks();
-    int nBlockEnd = nBlockStart + GetBudgetPaymentCycleBlocks() - 1;
     CAmount nTotalBudget = GetTotalBudget(nBlockStart);
 
 
@@ -813,12 +870,12 @@ std::vector<CBudgetProposal*> CBudgetManager::GetBudget()
         //prop start/end should be inside this period
         if (pbudgetProposal->fValid && pbudgetProposal->nBlockStart <= nBlockStart &&
             pbudgetProposal->nBlockEnd >= nBlockEnd &&
-            pbudgetProposal->GetYeas() - pbudgetProposal->GetNays() > mnodeman.CountEnabled(ActiveProtocol()) / 10 &&
+            pbudgetProposal->GetYeas() - pbudgetProposal->GetNays() > nThreshold &&
             pbudgetProposal->IsEstablished()) {
 
             LogPrint("mnbudget","CBudgetManager::GetBudget() -   Check 1 passed: valid=%d | %ld <= %ld | %ld >= %ld | Yeas=%d Nays=%d Count=%d | established=%d\n",
                       pbudgetProposal->fValid, pbudgetProposal->nBlockStart, nBlockStart, pbudgetProposal->nBlockEnd,
-                      nBlockEnd, pbudgetProposal->GetYeas(), pbudgetProposal->GetNays(), mnodeman.CountEnabled(ActiveProtocol()) / 10,
+                      nBlockEnd, pbudgetProposal->GetYeas(), pbudgetProposal->GetNays(), nThreshold,
                       pbudgetProposal->IsEstablished());
 
             if (pbudgetProposal->GetAmount() + nBudgetAllocated <= nTotalBudget) {
@@ -834,13 +891,20 @@ std::vector<CBudgetProposal*> CBudgetManager::GetBudget()
         else {
             LogPrint("mnbudget","CBudgetManager::GetBudget() -   Check 1 failed: valid=%d | %ld <= %ld | %ld >= %ld | Yeas=%d Nays=%d Count=%d | established=%d\n",
                       pbudgetProposal->fValid, pbudgetProposal->nBlockStart, nBlockStart, pbudgetProposal->nBlockEnd,
-                      nBlockEnd, pbudgetProposal->GetYeas(), pbudgetProposal->GetNays(), mnodeman.CountEnabled(ActiveProtocol()) / 10,
+                      nBlockEnd, pbudgetProposal->GetYeas(), pbudgetProposal->GetNays(), nThreshold,
                       pbudgetProposal->IsEstablished());
         }
 
         ++it2;
     }
 
+    vRankedBudget = vBudgetProposalsRet;
+    nRankedBlockStart = nBlockStart;
+    nRankedProposalsVersion = nProposalsVersion;
+    nRankedListVersion = nListVersion;
+    nRankedThreshold = nThreshold;
+    nRankedEstablished = nEstablished;
+
     return vBudgetProposalsRet;
 }
 
@@ -957,6 +1021,7 @@ CAmount CBudgetManager::GetTotalBudget(int nHeight)
 
 void CBudgetManager::NewBlock()
 {
+    PERF_TIMER("budget.newblock");
     TRY_LOCK(cs, fBudgetNewBlock);
     if (!fBudgetNewBlock) return;
 
@@ -1014,55 +1079,61 @@ void CBudgetManager::NewBlock()
         ++it3;
     }
 
-    LogPrint("mnbudget","CBudgetManager::NewBlock - vecImmatureBudgetProposals cleanup - size: %d\n", vecImmatureBudgetProposals.size());
-    std::vector<CBudgetProposalBroadcast>::iterator it4 = vecImmatureBudgetProposals.begin();
-    while (it4 != vecImmatureBudgetProposals.end()) {
+    // Only look at the objects whose collateral should have enough confirmations by now
+    int nHeight = chainActive.Height();
+
+    LogPrint("mnbudget","CBudgetManager::NewBlock - mapImmatureBudgetProposals cleanup - size: %d\n", mapImmatureBudgetProposals.size());
+    std::multimap<int, CBudgetProposalBroadcast>::iterator it4 = mapImmatureBudgetProposals.begin();
+    while (it4 != mapImmatureBudgetProposals.end() && (*it4).first <= nHeight) {
         std::string strError = "";
         int nConf = 0;
-        if (!IsBudgetCollateralValid((*it4).nFeeTXHash, (*it4).GetHash(), strError, (*it4).nTime, nConf)) {
-            ++it4;
+        if (!IsBudgetCollateralValid((*it4).second.nFeeTXHash, (*it4).second.GetHash(), strError, (*it4).second.nTime, nConf)) {
+            // the collateral went back in a reorganization, wait for the blocks it is still missing
+            mapImmatureBudgetProposals.insert(make_pair(nHeight + std::max<int64_t>(1, Params().Budget_Fee_Confirmations() - nConf), (*it4).second));
+            mapImmatureBudgetProposals.erase(it4++);
             continue;
         }
 
-        if (!(*it4).IsValid(strError)) {
+        if (!(*it4).second.IsValid(strError)) {
             LogPrint("mnbudget","mprop (immature) - invalid budget proposal - %s\n", strError);
-            it4 = vecImmatureBudgetProposals.erase(it4);
+            mapImmatureBudgetProposals.erase(it4++);
             continue;
         }
 
-        CBudgetProposal budgetProposal((*it4));
+        CBudgetProposal budgetProposal((*it4).second);
         if (AddProposal(budgetProposal)) {
-            (*it4).Relay();
+            (*it4).second.Relay();
         }
 
-        LogPrint("mnbudget","mprop (immature) - new budget - %s\n", (*it4).GetHash().ToString());
-        it4 = vecImmatureBudgetProposals.erase(it4);
+        LogPrint("mnbudget","mprop (immature) - new budget - %s\n", (*it4).second.GetHash().ToString());
+        mapImmatureBudgetProposals.erase(it4++);
     }
 
-    LogPrint("mnbudget","CBudgetManager::NewBlock - vecImmatureFinalizedBudgets cleanup - size: %d\n", vecImmatureFinalizedBudgets.size());
-    std::vector<CFinalizedBudgetBroadcast>::iterator it5 = vecImmatureFinalizedBudgets.begin();
-    while (it5 != vecImmatureFinalizedBudgets.end()) {
+    LogPrint("mnbudget","CBudgetManager::NewBlock - mapImmatureFinalizedBudgets cleanup - size: %d\n", mapImmatureFinalizedBudgets.size());
+    std::multimap<int, CFinalizedBudgetBroadcast>::iterator it5 = mapImmatureFinalizedBudgets.begin();
+    while (it5 != mapImmatureFinalizedBudgets.end() && (*it5).first <= nHeight) {
         std::string strError = "";
         int nConf = 0;
-        if (!IsBudgetCollateralValid((*it5).nFeeTXHash, (*it5).GetHash(), strError, (*it5).nTime, nConf, true)) {
-            ++it5;
+        if (!IsBudgetCollateralValid((*it5).second.nFeeTXHash, (*it5).second.GetHash(), strError, (*it5).second.nTime, nConf, true)) {
+            mapImmatureFinalizedBudgets.insert(make_pair(nHeight + std::max<int64_t>(1, Params().Budget_Fee_Confirmations() - nConf), (*it5).second));
+            mapImmatureFinalizedBudgets.erase(it5++);
             continue;
         }
 
-        if (!(*it5).IsValid(strError)) {
+        if (!(*it5).second.IsValid(strError)) {
             LogPrint("mnbudget","fbs (immature) - invalid finalized budget - %s\n", strError);
-            it5 = vecImmatureFinalizedBudgets.erase(it5);
+            mapImmatureFinalizedBudgets.erase(it5++);
             continue;
         }
 
-        LogPrint("mnbudget","fbs (immature) - new finalized budget - %s\n", (*it5).GetHash().ToString());
+        LogPrint("mnbudget","fbs (immature) - new finalized budget - %s\n", (*it5).second.GetHash().ToString());
 
-        CFinalizedBudget finalizedBudget((*it5));
+        CFinalizedBudget finalizedBudget((*it5).second);
         if (AddFinalizedBudget(finalizedBudget)) {
-            (*it5).Relay();
+            (*it5).second.Relay();
         }
 
-        it5 = vecImmatureFinalizedBudgets.erase(it5);
+        mapImmatureFinalizedBudgets.erase(it5++);
     }
     LogPrint("mnbudget","CBudgetManager::NewBlock - PASSED\n");
 }
@@ -1107,7 +1178,7 @@ void CBudgetManager::ProcessMessage(CNode* pfrom, std::string& strCommand, CData
         int nConf = 0;
         if (!IsBudgetCollateralValid(budgetProposalBroadcast.nFeeTXHash, budgetProposalBroadcast.GetHash(), strError, budgetProposalBroadcast.nTime, nConf)) {
             LogPrint("mnbudget","Proposal FeeTX is not valid - %s - %s\n", budgetProposalBroadcast.nFeeTXHash.ToString(), strError);
-            if (nConf >= 1) vecImmatureBudgetProposals.push_back(budgetProposalBroadcast);
+            if (nConf >= 1) mapImmatureBudgetProposals.insert(make_pair(chainActive.Height() + Params().Budget_Fee_Confirmations() - nConf, budgetProposalBroadcast));
             return;
         }
 
@@ -1182,7 +1253,7 @@ void CBudgetManager::ProcessMessage(CNode* pfrom, std::string& strCommand, CData
         if (!IsBudgetCollateralValid(finalizedBudgetBroadcast.nFeeTXHash, finalizedBudgetBroadcast.GetHash(), strError, finalizedBudgetBroadcast.nTime, nConf, true)) {
             LogPrint("mnbudget","fbs - Finalized Budget FeeTX is not valid - %s - %s\n", finalizedBudgetBroadcast.nFeeTXHash.ToString(), strError);
 
-            if (nConf >= 1) vecImmatureFinalizedBudgets.push_back(finalizedBudgetBroadcast);
+            if (nConf >= 1) mapImmatureFinalizedBudgets.insert(make_pair(chainActive.Height() + Params().Budget_Fee_Confirmations() - nConf, finalizedBudgetBroadcast));
             return;
         }
 
@@ -1420,7 +1491,11 @@ bool CBudgetManager::UpdateProposal(CBudgetVote& vote, CNode* pfrom, std::string
     }
 
 
-    return mapProposals[vote.nProposalHash].AddOrUpdateVote(vote, strError);
+    if (!mapProposals[vote.nProposalHash].AddOrUpdateVote(vote, strError))
+        return false;
+
+    nProposalsVersion++;
+    return true;
 }
 
 bool CBudgetManager::UpdateFinalizedBudget(CFinalizedBudgetVote& vote, CNode* pfrom, std::string& strError)
@@ -1457,6 +1532,10 @@ CBudgetProposal::CBudgetProposal()
     nAmount = 0;
     nTime = 0;
     fValid = true;
+    nYeas = 0;
+    nNays = 0;
+    nAbstains = 0;
+    nVotesCheckedVersion = 0;
 }
 
 CBudgetProposal::CBudgetProposal(std::string strProposalNameIn, std::string strURLIn, int nBlockStartIn, int nBlockEndIn, CScript addressIn, CAmount nAmountIn, uint256 nFeeTXHashIn)
@@ -1469,6 +1548,10 @@ CBudgetProposal::CBudgetProposal(std::string strProposalNameIn, std::string strU
     nAmount = nAmountIn;
     nFeeTXHash = nFeeTXHashIn;
     fValid = true;
+    nYeas = 0;
+    nNays = 0;
+    nAbstains = 0;
+    nVotesCheckedVersion = 0;
 }
 
 CBudgetProposal::CBudgetProposal(const CBudgetProposal& other)
@@ -1483,6 +1566,10 @@ CBudgetProposal::CBudgetProposal(const CBudgetProposal& other)
     nFeeTXHash = other.nFeeTXHash;
     mapVotes = other.mapVotes;
     fValid = true;
+    nYeas = other.nYeas;
+    nNays = other.nNays;
+    nAbstains = other.nAbstains;
+    nVotesCheckedVersion = other.nVotesCheckedVersion;
 }
 
 bool CBudgetProposal::IsValid(std::string& strError, bool fCheckCollateral)
@@ -1565,6 +1652,8 @@ bool CBudgetProposal::IsValid(std::string& strError, bool fCheckCollateral)
 bool CBudgetProposal::AddOrUpdateVote(CBudgetVote& vote, std::string& strError)
 {
     std::string strAction = "New vote inserted:";
+    // Judge the vote the way CleanAndRemove(false) would, so the tallies stay valid for the current masternode list
+    vote.fValid = vote.SignatureValid(false);
     LOCK(cs);
 
     uint256 hash = vote.vin.prevout.GetHash();
@@ -1589,7 +1678,22 @@ bool CBudgetProposal::AddOrUpdateVote(CBudgetVote& vote, std::string& strError)
         return false;
     }
 
-    mapVotes[hash] = vote;
+    std::map<uint256, CBudgetVote>::iterator it = mapVotes.find(hash);
+    if (it != mapVotes.end()) {
+        if ((*it).second.fValid) {
+            if ((*it).second.nVote == VOTE_YES) nYeas--;
+            if ((*it).second.nVote == VOTE_NO) nNays--;
+            if ((*it).second.nVote == VOTE_ABSTAIN) nAbstains--;
+        }
+        (*it).second = vote;
+    } else {
+        mapVotes.insert(make_pair(hash, vote));
+    }
+    if (vote.fValid) {
+        if (vote.nVote == VOTE_YES) nYeas++;
+        if (vote.nVote == VOTE_NO) nNays++;
+        if (vote.nVote == VOTE_ABSTAIN) nAbstains++;
+    }
     LogPrint("mnbudget", "CBudgetProposal::AddOrUpdateVote - %s %s\n", strAction.c_str(), vote.GetHash().ToString().c_str());
 
     return true;
@@ -1598,12 +1702,38 @@ bool CBudgetProposal::AddOrUpdateVote(CBudgetVote& vote, std::string& strError)
 // If masternode voted for a proposal, but is now invalid -- remove the vote
 void CBudgetProposal::CleanAndRemove(bool fSignatureCheck)
 {
+    LOCK(cs);
+
+    // without signature checks a vote only turns invalid when its masternode leaves the list
+    unsigned int nListVersion = mnodeman.GetListVersion();
+    if (!fSignatureCheck && nVotesCheckedVersion == nListVersion) return;
+
     std::map<uint256, CBudgetVote>::iterator it = mapVotes.begin();
 
     while (it != mapVotes.end()) {
         (*it).second.fValid = (*it).second.SignatureValid(fSignatureCheck);
         ++it;
     }
+
+    nVotesCheckedVersion = nListVersion;
+    CountVotes();
+}
+
+void CBudgetProposal::CountVotes()
+{
+    nYeas = 0;
+    nNays = 0;
+    nAbstains = 0;
+
+    std::map<uint256, CBudgetVote>::iterator it = mapVotes.begin();
+    while (it != mapVotes.end()) {
+        if ((*it).second.fValid) {
+            if ((*it).second.nVote == VOTE_YES) nYeas++;
+            if ((*it).second.nVote == VOTE_NO) nNays++;
+            if ((*it).second.nVote == VOTE_ABSTAIN) nAbstains++;
+        }
+        ++it;
+    }
 }
 
 double CBudgetProposal::GetRatio()
@@ -1626,41 +1756,17 @@ double CBudgetProposal::GetRatio()
 
 int CBudgetProposal::GetYeas()
 {
-    int ret = 0;
-
-    std::map<uint256, CBudgetVote>::iterator it = mapVotes.begin();
-    while (it != mapVotes.end()) {
-        if ((*it).second.nVote == VOTE_YES && (*it).second.fValid) ret++;
-        ++it;
-    }
-
-    return ret;
+    return nYeas;
 }
 
 int CBudgetProposal::GetNays()
 {
-    int ret = 0;
-
-    std::map<uint256, CBudgetVote>::iterator it = mapVotes.begin();
-    while (it != mapVotes.end()) {
-        if ((*it).second.nVote == VOTE_NO && (*it).second.fValid) ret++;
-        ++it;
-    }
-
-    return ret;
+    return nNays;
 }
 
 int CBudgetProposal::GetAbstains()
 {
-    int ret = 0;
-
-    std::map<uint256, CBudgetVote>::iterator it = mapVotes.begin();
-    while (it != mapVotes.end()) {
-        if ((*it).second.nVote == VOTE_ABSTAIN && (*it).second.fValid) ret++;
-        ++it;
-    }
-
-    return ret;
+    return nAbstains;
 }
 
 int CBudgetProposal::GetBlockStartCycle()
@@ -1816,6 +1922,7 @@ CFinalizedBudget::CFinalizedBudget()
     nTime = 0;
     fValid = true;
     fAutoChecked = false;
+    nVotesCheckedVersion = 0;
 }
 
 CFinalizedBudget::CFinalizedBudget(const CFinalizedBudget& other)
@@ -1828,10 +1935,13 @@ CFinalizedBudget::CFinalizedBudget(const CFinalizedBudget& other)
     nTime = other.nTime;
     fValid = true;
     fAutoChecked = false;
+    nVotesCheckedVersion = other.nVotesCheckedVersion;
 }
 
 bool CFinalizedBudget::AddOrUpdateVote(CFinalizedBudgetVote& vote, std::string& strError)
 {
+    // Judge the vote the way CleanAndRemove(false) would, see CBudgetProposal::AddOrUpdateVote
+    vote.fValid = vote.SignatureValid(false);
     LOCK(cs);
 
     uint256 hash = vote.vin.prevout.GetHash();
@@ -1946,12 +2056,19 @@ void CFinalizedBudget::AutoCheck()
 // If masternode voted for a proposal, but is now invalid -- remove the vote
 void CFinalizedBudget::CleanAndRemove(bool fSignatureCheck)
 {
+    LOCK(cs);
+
+    unsigned int nListVersion = mnodeman.GetListVersion();
+    if (!fSignatureCheck && nVotesCheckedVersion == nListVersion) return;
+
     std::map<uint256, CFinalizedBudgetVote>::iterator it = mapVotes.begin();
 
     while (it != mapVotes.end()) {
         (*it).second.fValid = (*it).second.SignatureValid(fSignatureCheck);
         ++it;
     }
+
+    nVotesCheckedVersion = nListVersion;
 }
 
 
@@ -44,8 +44,9 @@ static const CAmount BUDGET_FEE_TX = (5 * COIN);
 static const int64_t BUDGET_VOTE_UPDATE_MIN = 60 * 60;
 static map<uint256, int> mapPayment_History;
 
-extern std::vector<CBudgetProposalBroadcast> vecImmatureBudgetProposals;
-extern std::vector<CFinalizedBudgetBroadcast> vecImmatureFinalizedBudgets;
+// budget objects waiting for their collateral to confirm, keyed by the height it should be deep enough at
+extern std::multimap<int, CBudgetProposalBroadcast> mapImmatureBudgetProposals;
+extern std::multimap<int, CFinalizedBudgetBroadcast> mapImmatureFinalizedBudgets;
 
 extern CBudgetManager budget;
 void DumpBudgets();
@@ -53,6 +54,21 @@ void DumpBudgets();
 // Define amount of blocks in budget payment cycle
 int GetBudgetPaymentCycleBlocks();
 
+/** A budget fee transaction as found in the chain: its block and the OP_RETURN <hash> outputs it pays */
+class CBudgetCollateral
+{
+public:
+    const CBlockIndex* pindex; //NULL while it is only in the mempool
+    bool fStandard;            //nLockTime of 0 and only normal payment or unspendable outputs
+    std::vector<std::pair<uint256, CAmount> > vFees;
+
+    CBudgetCollateral() : pindex(NULL), fStandard(false) {}
+    CBudgetCollateral(const CTransaction& tx, const CBlockIndex* pindexIn);
+};
+
+/** Index the fee transactions of a block as it connects, so checking collateral needs no disk reads; called with cs_main held */
+void BudgetCollateralConnectTip(const CBlock& block, const CBlockIndex* pindex);
+
 //Check the collateral transaction for the budget proposal/finalized budget
 bool IsBudgetCollateralValid(uint256 nTxCollateralHash, uint256 nExpectedHash, std::string& strError, int64_t& nTime, int& nConf, bool fBudgetFinalization=false);
 
@@ -172,6 +188,7 @@ public:
 
     CBudgetDB();
     bool Write(const CBudgetManager& objToSave);
+    //! Load without checking the entries (see ThreadCheckMasternodeCaches); a dry run only verifies the file
     ReadResult Read(CBudgetManager& objToLoad, bool fDryRun = false);
 };
 
@@ -186,6 +203,17 @@ private:
     // XX42    map<uint256, CTransaction> mapCollateral;
     map<uint256, uint256> mapCollateralTxids;
 
+    // bumped whenever proposals are added or removed or their votes change
+    unsigned int nProposalsVersion;
+
+    // last GetBudget result and the state it was ranked from
+    std::vector<CBudgetProposal*> vRankedBudget;
+    int nRankedBlockStart;
+    unsigned int nRankedProposalsVersion;
+    unsigned int nRankedListVersion;
+    int nRankedThreshold;
+    int nRankedEstablished;
+
 public:
     // critical section to protect the inner data structures
     mutable CCriticalSection cs;
@@ -205,6 +233,8 @@ public:
     {
         mapProposals.clear();
         mapFinalizedBudgets.clear();
+        nProposalsVersion = 1;
+        nRankedProposalsVersion = 0;
     }
 
     void ClearSeen()
@@ -260,6 +290,7 @@ public:
         mapSeenFinalizedBudgetVotes.clear();
         mapOrphanMasternodeBudgetVotes.clear();
         mapOrphanFinalizedBudgetVotes.clear();
+        nProposalsVersion++;
     }
     void CheckAndRemove();
     std::string ToString() const;
@@ -279,6 +310,8 @@ public:
 
         READWRITE(mapProposals);
         READWRITE(mapFinalizedBudgets);
+        if (ser_action.ForRead())
+            nProposalsVersion++;
     }
 };
 
@@ -320,6 +353,10 @@ private:
     mutable CCriticalSection cs;
     bool fAutoChecked; //If it matches what we see, we'll auto vote for it (masternode only)
 
+protected:
+    // masternode list version the votes were last validated against, 0 if never
+    unsigned int nVotesCheckedVersion;
+
 public:
     bool fValid;
     std::string strBudgetName;
@@ -403,6 +440,8 @@ public:
         READWRITE(fAutoChecked);
 
         READWRITE(mapVotes);
+        if (ser_action.ForRead())
+            nVotesCheckedVersion = 0;
     }
 };
 
@@ -430,6 +469,7 @@ public:
         first.vecBudgetPayments.swap(second.vecBudgetPayments);
         swap(first.nFeeTXHash, second.nFeeTXHash);
         swap(first.nTime, second.nTime);
+        swap(first.nVotesCheckedVersion, second.nVotesCheckedVersion);
     }
 
     CFinalizedBudgetBroadcast& operator=(CFinalizedBudgetBroadcast from)
@@ -466,6 +506,16 @@ private:
     mutable CCriticalSection cs;
     CAmount nAlloted;
 
+protected:
+    // tallies of the valid votes in mapVotes, kept current by AddOrUpdateVote and CleanAndRemove
+    int nYeas;
+    int nNays;
+    int nAbstains;
+    // masternode list version the votes were last validated against, 0 if never
+    unsigned int nVotesCheckedVersion;
+
+    void CountVotes();
+
 public:
     bool fValid;
     std::string strProposalName;
@@ -557,6 +607,10 @@ public:
 
         //for saving to the serialized db
         READWRITE(mapVotes);
+        if (ser_action.ForRead()) {
+            nVotesCheckedVersion = 0;
+            CountVotes();
+        }
     }
 };
 
@@ -585,6 +639,10 @@ public:
         swap(first.nTime, second.nTime);
         swap(first.nFeeTXHash, second.nFeeTXHash);
         first.mapVotes.swap(second.mapVotes);
+        swap(first.nYeas, second.nYeas);
+        swap(first.nNays, second.nNays);
+        swap(first.nAbstains, second.nAbstains);
+        swap(first.nVotesCheckedVersion, second.nVotesCheckedVersion);
     }
 
     CBudgetProposalBroadcast& operator=(CBudgetProposalBroadcast from)
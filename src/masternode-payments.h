@@ -55,6 +55,7 @@ public:
 
     CMasternodePaymentDB();
     bool Write(const CMasternodePayments& objToSave);
+    //! Load without checking the entries (see ThreadCheckMasternodeCaches); a dry run only verifies the file
     ReadResult Read(CMasternodePayments& objToLoad, bool fDryRun = false);
 };
 
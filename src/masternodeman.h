@@ -45,6 +45,7 @@ public:
 
     CMasternodeDB();
     bool Write(const CMasternodeMan& mnodemanToSave);
+    //! Load without checking the entries (see ThreadCheckMasternodeCaches); a dry run only verifies the file
     ReadResult Read(CMasternodeMan& mnodemanToLoad, bool fDryRun = false);
 };
 
@@ -65,6 +66,8 @@ private:
     std::map<CNetAddr, int64_t> mWeAskedForMasternodeList;
     // which Masternodes we've asked for
     std::map<COutPoint, int64_t> mWeAskedForMasternodeListEntry;
+    // bumped whenever a Masternode is added to or removed from the list
+    unsigned int nListVersion;
 
 public:
     // Keep track of all broadcasts I've seen
@@ -89,6 +92,8 @@ public:
 
         READWRITE(mapSeenMasternodeBroadcast);
         READWRITE(mapSeenMasternodePing);
+        if (ser_action.ForRead())
+            nListVersion++;
     }
 
     CMasternodeMan();
@@ -109,6 +114,13 @@ public:
     /// Clear Masternode vector
     void Clear();
 
+    /// Changes whenever the set of listed Masternodes does, so lookups by vin can be cached against it
+    unsigned int GetListVersion()
+    {
+        LOCK(cs);
+        return nListVersion;
+    }
+
     int CountEnabled(int protocolVersion = -1);
 
     void CountNetworks(int protocolVersion, int& ipv4, int& ipv6, int& onion);
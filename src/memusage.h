@@ -0,0 +1,41 @@
+// Copyright (c) 2015 The Bitcoin developers
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_MEMUSAGE_H
+#define BITCOIN_MEMUSAGE_H
+
+#include <stddef.h>
+#include <vector>
+
+namespace memusage
+{
+/**
+ * Compute the memory malloc actually uses for an allocation of the given
+ * size: the request plus a header, rounded up to the allocator's granularity.
+ */
+static inline size_t MallocUsage(size_t alloc)
+{
+    // Measured on libc6 2.19 on Linux.
+    if (alloc == 0) {
+        return 0;
+    } else if (sizeof(void*) == 8) {
+        return ((alloc + 31) >> 4) << 4;
+    } else if (sizeof(void*) == 4) {
+        return ((alloc + 15) >> 3) << 3;
+    } else {
+        return alloc;
+    }
+}
+
+/** Heap memory owned by a vector, not counting what its elements own */
+template <typename X>
+static inline size_t DynamicUsage(const std::vector<X>& v)
+{
+    return MallocUsage(v.capacity() * sizeof(X));
+}
+
+} // namespace memusage
+
+#endif // BITCOIN_MEMUSAGE_H
@@ -31,7 +31,8 @@
 
 
 #include <boost/thread.hpp>
-#include <boost/tuple/tuple.hpp>
+
+#include <limits>
 
 using namespace std;
 
@@ -40,54 +41,258 @@ using namespace std;
 // HooliBetMiner
 //
 
-//
-// Unconfirmed transactions in the memory pool often depend on other
-// transactions in the memory pool. When we select transactions from the
-// pool, we select by highest priority or fee rate, so we might consider
-// transactions that depend on transactions that aren't yet in the block.
-// The COrphan class keeps track of these 'temporary orphans' while
-// CreateBlock is figuring out which transactions to include.
-//
-class COrphan
+uint64_t nLastBlockTx = 0;
+uint64_t nLastBlockSize = 0;
+int64_t nLastCoinStakeSearchInterval = 0;
+
+// We want to sort transactions by priority in the priority part of the block:
+typedef std::pair<double, CTxMemPool::txiter> TxCoinAgePriority;
+class TxCoinAgePriorityCompare
 {
 public:
-    const CTransaction* ptx;
-    set<uint256> setDependsOn;
-    CFeeRate feeRate;
-    double dPriority;
+    bool operator()(const TxCoinAgePriority& a, const TxCoinAgePriority& b)
+    {
+        if (a.first == b.first)
+            return CompareTxMemPoolEntryByAncestorFee()(*(b.second), *(a.second)); //Reverse order to make sort less than
+        return a.first < b.first;
+    }
+};
 
-    COrphan(const CTransaction* ptxIn) : ptx(ptxIn), feeRate(0), dPriority(0)
+struct CompareByAncestorCount {
+    bool operator()(const CTxMemPool::txiter& a, const CTxMemPool::txiter& b) const
     {
+        return a->GetCountWithAncestors() < b->GetCountWithAncestors();
     }
 };
 
-uint64_t nLastBlockTx = 0;
-uint64_t nLastBlockSize = 0;
-int64_t nLastCoinStakeSearchInterval = 0;
+/** Running totals of a block template while it is filled from the mempool */
+struct CBlockFill {
+    CBlockTemplate* pblocktemplate;
+    int nHeight;
+    uint64_t nBlockSize;
+    uint64_t nBlockTx;
+    unsigned int nBlockSigOps;
+    CAmount nFees;
+    CTxMemPool::setEntries inBlock;
+    vector<CBigNum> vBlockSerials;
+};
 
-// We want to sort transactions by priority and fee rate, so:
-typedef boost::tuple<double, CFeeRate, const CTransaction*> TxPriority;
-class TxPriorityCompare
-{
-    bool byFee;
+/**
+ * A mempool entry some of whose ancestors are in the block already. Its totals
+ * leave those out, so its package is scored by what it still has to add.
+ */
+struct CTxMemPoolModifiedEntry {
+    CTxMemPoolModifiedEntry(CTxMemPool::txiter entry) : iter(entry), nSizeWithAncestors(entry->GetSizeWithAncestors()), nModFeesWithAncestors(entry->GetModFeesWithAncestors()) {}
 
-public:
-    TxPriorityCompare(bool _byFee) : byFee(_byFee) {}
+    const CTransaction& GetTx() const { return iter->GetTx(); }
+    uint64_t GetSizeWithAncestors() const { return nSizeWithAncestors; }
+    CAmount GetModFeesWithAncestors() const { return nModFeesWithAncestors; }
+
+    CTxMemPool::txiter iter;
+    uint64_t nSizeWithAncestors;
+    CAmount nModFeesWithAncestors;
+};
 
-    bool operator()(const TxPriority& a, const TxPriority& b)
+struct modifiedentry_iter {
+    typedef CTxMemPool::txiter result_type;
+    result_type operator()(const CTxMemPoolModifiedEntry& entry) const
     {
-        if (byFee) {
-            if (a.get<1>() == b.get<1>())
-                return a.get<0>() < b.get<0>();
-            return a.get<1>() < b.get<1>();
-        } else {
-            if (a.get<0>() == b.get<0>())
-                return a.get<1>() < b.get<1>();
-            return a.get<0>() < b.get<0>();
-        }
+        return entry.iter;
+    }
+};
+
+typedef boost::multi_index_container<
+    CTxMemPoolModifiedEntry,
+    boost::multi_index::indexed_by<
+        // sorted by mempool entry
+        boost::multi_index::ordered_unique<
+            modifiedentry_iter,
+            CTxMemPool::CompareIteratorByHash>,
+        // sorted by fee rate with the remaining ancestors
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ancestor_score>,
+            boost::multi_index::identity<CTxMemPoolModifiedEntry>,
+            CompareTxMemPoolEntryByAncestorFee> > >
+    indexed_modified_transaction_set;
+
+typedef indexed_modified_transaction_set::nth_index<0>::type::iterator modtxiter;
+typedef indexed_modified_transaction_set::index<ancestor_score>::type::iterator modtxscoreiter;
+
+struct update_for_parent_inclusion {
+    update_for_parent_inclusion(CTxMemPool::txiter it) : iter(it) {}
+
+    void operator()(CTxMemPoolModifiedEntry& e)
+    {
+        e.nModFeesWithAncestors -= iter->GetModifiedFee();
+        e.nSizeWithAncestors -= iter->GetTxSize();
     }
+
+private:
+    CTxMemPool::txiter iter;
 };
 
+/**
+ * Take the transactions just added to the block out of the ancestor totals of
+ * their descendants in mapModifiedTx, adding the descendants not there yet.
+ */
+static void UpdatePackagesForAdded(const CTxMemPool::setEntries& alreadyAdded, indexed_modified_transaction_set& mapModifiedTx)
+{
+    BOOST_FOREACH (CTxMemPool::txiter it, alreadyAdded) {
+        CTxMemPool::setEntries descendants;
+        mempool.CalculateDescendants(it, descendants);
+        BOOST_FOREACH (CTxMemPool::txiter desc, descendants) {
+            if (alreadyAdded.count(desc))
+                continue;
+            modtxiter mit = mapModifiedTx.find(desc);
+            if (mit == mapModifiedTx.end()) {
+                CTxMemPoolModifiedEntry modEntry(desc);
+                modEntry.nSizeWithAncestors -= it->GetTxSize();
+                modEntry.nModFeesWithAncestors -= it->GetModifiedFee();
+                mapModifiedTx.insert(modEntry);
+            } else {
+                mapModifiedTx.modify(mit, update_for_parent_inclusion(it));
+            }
+        }
+    }
+}
+
+/**
+ * Zerocoin spends get a priority that grows with the time they have waited in
+ * the mempool and with their value, so that they make it into the next block.
+ */
+static double GetZerocoinSpendPriority(const CTransaction& tx)
+{
+    //Priority = (age^6+100000)*amount - gives higher priority to zhbets that have been in mempool long
+    //and higher priority to zhbets that are large in value
+    int64_t nTimeSeen = GetAdjustedTime();
+    double nConfs = 100000;
+
+    auto it = mapZerocoinspends.find(tx.GetHash());
+    if (it != mapZerocoinspends.end()) {
+        nTimeSeen = it->second;
+    } else {
+        //for some reason not in map, add it
+        mapZerocoinspends[tx.GetHash()] = nTimeSeen;
+    }
+
+    double nTimePriority = std::pow(GetAdjustedTime() - nTimeSeen, 6);
+
+    // zHBET spends can have very large priority, use non-overflowing safe functions
+    double dPriority = double_safe_addition(0, (nTimePriority * nConfs));
+    dPriority = double_safe_multiplication(dPriority, tx.GetZerocoinSpent());
+    return tx.ComputePriority(dPriority, ::GetSerializeSize(tx, SER_NETWORK, PROTOCOL_VERSION));
+}
+
+/**
+ * Check that tx is valid on top of view and the transactions already in the
+ * block, and apply it to view. The zerocoin serials it spends go to vSerials.
+ */
+static bool TestTxForBlock(const CBlockFill& fill, const CTransaction& tx, CCoinsViewCache& view, unsigned int& nTxSigOps, CAmount& nTxFees, vector<CBigNum>& vSerials)
+{
+    if (tx.IsCoinBase() || tx.IsCoinStake() || !IsFinalTx(tx, fill.nHeight))
+        return false;
+
+    if (!view.HaveInputs(tx))
+        return false;
+
+    //Check for invalid/fraudulent inputs. They shouldn't make it through mempool, but check anyways.
+    if (!tx.IsZerocoinSpend()) {
+        for (const CTxIn& txin : tx.vin) {
+            if (invalid_out::ContainsOutPoint(txin.prevout)) {
+                LogPrintf("%s : found invalid input %s in tx %s", __func__, txin.prevout.ToString(), tx.GetHash().ToString());
+                return false;
+            }
+        }
+    }
+
+    // double check that there are no double spent zHBET spends in this block or tx
+    if (tx.IsZerocoinSpend()) {
+        int nHeightTx = 0;
+        if (IsTransactionInChain(tx.GetHash(), nHeightTx))
+            return false;
+
+        for (const CTxIn& txIn : tx.vin) {
+            if (!txIn.scriptSig.IsZerocoinSpend())
+                continue;
+            libzerocoin::CoinSpend spend = TxInToZerocoinSpend(txIn);
+            bool fUseV1Params = libzerocoin::ExtractVersionFromSerial(spend.getCoinSerialNumber()) < libzerocoin::PrivateCoin::PUBKEY_VERSION;
+            if (!spend.HasValidSerial(Params().Zerocoin_Params(fUseV1Params)))
+                return false;
+            //This zHBET serial has already been included in the block, do not add this tx.
+            if (count(fill.vBlockSerials.begin(), fill.vBlockSerials.end(), spend.getCoinSerialNumber()))
+                return false;
+            if (count(vSerials.begin(), vSerials.end(), spend.getCoinSerialNumber()))
+                return false;
+            vSerials.emplace_back(spend.getCoinSerialNumber());
+        }
+    }
+
+    nTxFees = view.GetValueIn(tx) - tx.GetValueOut();
+    nTxSigOps = GetLegacySigOpCount(tx) + GetP2SHSigOpCount(tx, view);
+
+    // Note that flags: we don't want to set mempool/IsStandard()
+    // policy here, but we still have to ensure that the block we
+    // create only contains transactions that are valid in new blocks.
+    CValidationState state;
+    if (!CheckInputs(tx, state, view, true, MANDATORY_SCRIPT_VERIFY_FLAGS, true))
+        return false;
+
+    CTxUndo txundo;
+    UpdateCoins(tx, state, view, txundo, fill.nHeight);
+    return true;
+}
+
+/**
+ * Add a package of mempool transactions, parents first, to the block. Either the
+ * whole package goes in or nothing does.
+ */
+static bool AddPackageToBlock(CBlockFill& fill, const vector<CTxMemPool::txiter>& vPackage, CCoinsViewCache& view, unsigned int nBlockMaxSize, bool fPrintPriority)
+{
+    uint64_t nPackageSize = 0;
+    BOOST_FOREACH (CTxMemPool::txiter it, vPackage)
+        nPackageSize += it->GetTxSize();
+    if (fill.nBlockSize + nPackageSize >= nBlockMaxSize)
+        return false;
+
+    CCoinsViewCache viewPackage(&view);
+    vector<CBigNum> vSerials;
+    vector<unsigned int> vTxSigOps;
+    vector<CAmount> vTxFees;
+    unsigned int nPackageSigOps = 0;
+    BOOST_FOREACH (CTxMemPool::txiter it, vPackage) {
+        unsigned int nTxSigOps = 0;
+        CAmount nTxFees = 0;
+        if (!TestTxForBlock(fill, it->GetTx(), viewPackage, nTxSigOps, nTxFees, vSerials))
+            return false;
+        // Legacy limits on sigOps:
+        nPackageSigOps += nTxSigOps;
+        if (fill.nBlockSigOps + nPackageSigOps >= MAX_BLOCK_SIGOPS_CURRENT)
+            return false;
+        vTxSigOps.push_back(nTxSigOps);
+        vTxFees.push_back(nTxFees);
+    }
+    viewPackage.Flush();
+
+    for (unsigned int i = 0; i < vPackage.size(); i++) {
+        CTxMemPool::txiter it = vPackage[i];
+        fill.pblocktemplate->block.vtx.push_back(it->GetTx());
+        fill.pblocktemplate->vTxFees.push_back(vTxFees[i]);
+        fill.pblocktemplate->vTxSigOps.push_back(vTxSigOps[i]);
+        fill.nBlockSize += it->GetTxSize();
+        ++fill.nBlockTx;
+        fill.nBlockSigOps += vTxSigOps[i];
+        fill.nFees += vTxFees[i];
+        fill.inBlock.insert(it);
+
+        if (fPrintPriority) {
+            LogPrintf("fee %s txid %s\n",
+                CFeeRate(it->GetModifiedFee(), it->GetTxSize()).ToString(), it->GetTx().GetHash().ToString());
+        }
+    }
+    fill.vBlockSerials.insert(fill.vBlockSerials.end(), vSerials.begin(), vSerials.end());
+    return true;
+}
+
 void UpdateTime(CBlockHeader* pblock, const CBlockIndex* pindexPrev)
 {
     pblock->nTime = std::max(pindexPrev->GetMedianTimePast() + 1, GetAdjustedTime());
@@ -184,240 +389,156 @@ CBlockTemplate* CreateNewBlock(const CScript& scriptPubKeyIn, CWallet* pwallet,
         const int nHeight = pindexPrev->nHeight + 1;
         CCoinsViewCache view(pcoinsTip);
 
-        // Priority order to process transactions
-        list<COrphan> vOrphan; // list memory doesn't move
-        map<uint256, vector<COrphan*> > mapDependers;
         bool fPrintPriority = GetBoolArg("-printpriority", false);
 
-        // This vector will be sorted into a priority queue:
-        vector<TxPriority> vecPriority;
-        vecPriority.reserve(mempool.mapTx.size());
-        for (map<uint256, CTxMemPoolEntry>::iterator mi = mempool.mapTx.begin();
-             mi != mempool.mapTx.end(); ++mi) {
-            const CTransaction& tx = mi->second.GetTx();
-            if (tx.IsCoinBase() || tx.IsCoinStake() || !IsFinalTx(tx, nHeight))
-                continue;
-
-            COrphan* porphan = NULL;
-            double dPriority = 0;
-            CAmount nTotalIn = 0;
-            bool fMissingInputs = false;
-            uint256 txid = tx.GetHash();
-            for (const CTxIn& txin : tx.vin) {
-                //zerocoinspend has special vin
-                if (tx.IsZerocoinSpend()) {
-                    nTotalIn = tx.GetZerocoinSpent();
-
-                    //Give a high priority to zerocoinspends to get into the next block
-                    //Priority = (age^6+100000)*amount - gives higher priority to zhbets that have been in mempool long
-                    //and higher priority to zhbets that are large in value
-                    int64_t nTimeSeen = GetAdjustedTime();
-                    double nConfs = 100000;
-
-                    auto it = mapZerocoinspends.find(txid);
-                    if (it != mapZerocoinspends.end()) {
-                        nTimeSeen = it->second;
-                    } else {
-                        //for some reason not in map, add it
-                        mapZerocoinspends[txid] = nTimeSeen;
-                    }
-
-                    double nTimePriority = std::pow(GetAdjustedTime() - nTimeSeen, 6);
-
-                    // zHBET spends can have very large priority, use non-overflowing safe functions
-                    dPriority = double_safe_addition(dPriority, (nTimePriority * nConfs));
-                    dPriority = double_safe_multiplication(dPriority, nTotalIn);
+        CBlockFill fill;
+        fill.pblocktemplate = pblocktemplate.get();
+        fill.nHeight = nHeight;
+        fill.nBlockSize = 1000;
+        fill.nBlockTx = 0;
+        fill.nBlockSigOps = 100;
+        fill.nFees = 0;
+
+        // The first nBlockPrioritySize bytes go to high-priority transactions,
+        // included regardless of the fees they pay. The priority of an entry is
+        // kept by the mempool, so this needs no coins lookups.
+        if (nBlockPrioritySize > 0) {
+            vector<TxCoinAgePriority> vecPriority;
+            vecPriority.reserve(mempool.mapTx.size());
+            for (CTxMemPool::indexed_transaction_set::iterator mi = mempool.mapTx.begin(); mi != mempool.mapTx.end(); ++mi) {
+                double dPriority = mi->GetTx().IsZerocoinSpend() ? GetZerocoinSpendPriority(mi->GetTx()) : mi->GetPriority(nHeight);
+                CAmount dummy;
+                mempool.ApplyDeltas(mi->GetTx().GetHash(), dPriority, dummy);
+                vecPriority.push_back(TxCoinAgePriority(dPriority, mi));
+            }
 
+            // Transactions whose parents are not in the block yet, with their priority
+            map<CTxMemPool::txiter, double, CTxMemPool::CompareIteratorByHash> waitPriMap;
+            TxCoinAgePriorityCompare comparer;
+            std::make_heap(vecPriority.begin(), vecPriority.end(), comparer);
+            while (!vecPriority.empty()) {
+                // Take highest priority transaction off the priority queue:
+                double dPriority = vecPriority.front().first;
+                CTxMemPool::txiter iter = vecPriority.front().second;
+                std::pop_heap(vecPriority.begin(), vecPriority.end(), comparer);
+                vecPriority.pop_back();
+
+                if (fill.inBlock.count(iter))
                     continue;
-                }
 
-                // Read prev transaction
-                if (!view.HaveCoins(txin.prevout.hash)) {
-                    // This should never happen; all transactions in the memory
-                    // pool should connect to either transactions in the chain
-                    // or other transactions in the memory pool.
-                    if (!mempool.mapTx.count(txin.prevout.hash)) {
-                        LogPrintf("ERROR: mempool transaction missing input\n");
-                        if (fDebug) assert("mempool transaction missing input" == 0);
-                        fMissingInputs = true;
-                        if (porphan)
-                            vOrphan.pop_back();
+                // Has to wait for dependencies
+                bool fParentsInBlock = true;
+                BOOST_FOREACH (CTxMemPool::txiter parent, mempool.GetMemPoolParents(iter)) {
+                    if (!fill.inBlock.count(parent)) {
+                        fParentsInBlock = false;
                         break;
                     }
-
-                    // Has to wait for dependencies
-                    if (!porphan) {
-                        // Use list for automatic deletion
-                        vOrphan.push_back(COrphan(&tx));
-                        porphan = &vOrphan.back();
-                    }
-                    mapDependers[txin.prevout.hash].push_back(porphan);
-                    porphan->setDependsOn.insert(txin.prevout.hash);
-                    nTotalIn += mempool.mapTx[txin.prevout.hash].GetTx().vout[txin.prevout.n].nValue;
+                }
+                if (!fParentsInBlock) {
+                    waitPriMap.insert(std::make_pair(iter, dPriority));
                     continue;
                 }
 
-                //Check for invalid/fraudulent inputs. They shouldn't make it through mempool, but check anyways.
-                if (invalid_out::ContainsOutPoint(txin.prevout)) {
-                    LogPrintf("%s : found invalid input %s in tx %s", __func__, txin.prevout.ToString(), tx.GetHash().ToString());
-                    fMissingInputs = true;
+                // Stop once past the priority size or out of high-priority transactions
+                if (fill.nBlockSize + iter->GetTxSize() >= nBlockPrioritySize || !AllowFree(dPriority))
                     break;
-                }
-
-                const CCoins* coins = view.AccessCoins(txin.prevout.hash);
-                assert(coins);
-
-                CAmount nValueIn = coins->vout[txin.prevout.n].nValue;
-                nTotalIn += nValueIn;
-
-                int nConf = nHeight - coins->nHeight;
-
-                // zHBET spends can have very large priority, use non-overflowing safe functions
-                dPriority = double_safe_addition(dPriority, ((double)nValueIn * nConf));
 
+                if (!AddPackageToBlock(fill, vector<CTxMemPool::txiter>(1, iter), view, nBlockMaxSize, fPrintPriority))
+                    continue;
+                if (fPrintPriority)
+                    LogPrintf("priority %.1f txid %s\n", dPriority, iter->GetTx().GetHash().ToString());
+
+                // Add transactions that depend on this one to the priority queue
+                BOOST_FOREACH (CTxMemPool::txiter child, mempool.GetMemPoolChildren(iter)) {
+                    map<CTxMemPool::txiter, double, CTxMemPool::CompareIteratorByHash>::iterator wpiter = waitPriMap.find(child);
+                    if (wpiter != waitPriMap.end()) {
+                        vecPriority.push_back(TxCoinAgePriority(wpiter->second, child));
+                        std::push_heap(vecPriority.begin(), vecPriority.end(), comparer);
+                        waitPriMap.erase(wpiter);
+                    }
+                }
             }
-            if (fMissingInputs) continue;
-
-            // Priority is sum(valuein * age) / modified_txsize
-            unsigned int nTxSize = ::GetSerializeSize(tx, SER_NETWORK, PROTOCOL_VERSION);
-            dPriority = tx.ComputePriority(dPriority, nTxSize);
-
-            uint256 hash = tx.GetHash();
-            mempool.ApplyDeltas(hash, dPriority, nTotalIn);
-
-            CFeeRate feeRate(nTotalIn - tx.GetValueOut(), nTxSize);
-
-            if (porphan) {
-                porphan->dPriority = dPriority;
-                porphan->feeRate = feeRate;
-            } else
-                vecPriority.push_back(TxPriority(dPriority, feeRate, &mi->second.GetTx()));
         }
 
-        // Collect transactions into block
-        uint64_t nBlockSize = 1000;
-        uint64_t nBlockTx = 0;
-        int nBlockSigOps = 100;
-        bool fSortedByFee = (nBlockPrioritySize <= 0);
-
-        TxPriorityCompare comparer(fSortedByFee);
-        std::make_heap(vecPriority.begin(), vecPriority.end(), comparer);
-
-        vector<CBigNum> vBlockSerials;
-        vector<CBigNum> vTxSerials;
-        while (!vecPriority.empty()) {
-            // Take highest priority transaction off the priority queue:
-            double dPriority = vecPriority.front().get<0>();
-            CFeeRate feeRate = vecPriority.front().get<1>();
-            const CTransaction& tx = *(vecPriority.front().get<2>());
-
-            std::pop_heap(vecPriority.begin(), vecPriority.end(), comparer);
-            vecPriority.pop_back();
-
-            // Size limits
-            unsigned int nTxSize = ::GetSerializeSize(tx, SER_NETWORK, PROTOCOL_VERSION);
-            if (nBlockSize + nTxSize >= nBlockMaxSize)
-                continue;
-
-            // Legacy limits on sigOps:
-            unsigned int nMaxBlockSigOps = MAX_BLOCK_SIGOPS_CURRENT;
-            unsigned int nTxSigOps = GetLegacySigOpCount(tx);
-            if (nBlockSigOps + nTxSigOps >= nMaxBlockSigOps)
-                continue;
-
-            // Skip free transactions if we're past the minimum block size:
-            const uint256& hash = tx.GetHash();
-            double dPriorityDelta = 0;
-            CAmount nFeeDelta = 0;
-            mempool.ApplyDeltas(hash, dPriorityDelta, nFeeDelta);
-            if (!tx.IsZerocoinSpend() && fSortedByFee && (dPriorityDelta <= 0) && (nFeeDelta <= 0) && (feeRate < ::minRelayTxFee) && (nBlockSize + nTxSize >= nBlockMinSize))
-                continue;
-
-            // Prioritise by fee once past the priority size or we run out of high-priority
-            // transactions:
-            if (!fSortedByFee &&
-                ((nBlockSize + nTxSize >= nBlockPrioritySize) || !AllowFree(dPriority))) {
-                fSortedByFee = true;
-                comparer = TxPriorityCompare(fSortedByFee);
-                std::make_heap(vecPriority.begin(), vecPriority.end(), comparer);
-            }
-
-            if (!view.HaveInputs(tx))
-                continue;
-
-            // double check that there are no double spent zHBET spends in this block or tx
-            if (tx.IsZerocoinSpend()) {
-                int nHeightTx = 0;
-                if (IsTransactionInChain(tx.GetHash(), nHeightTx))
+        // Fill the rest by walking the mempool in ancestor fee rate order, adding
+        // each transaction together with those of its ancestors that are not in
+        // the block yet. Once an ancestor is in the block, the package of each of
+        // its descendants is smaller; mapModifiedTx keeps those updated packages
+        // and the best of the two indexes is taken each time.
+        indexed_modified_transaction_set mapModifiedTx;
+        // Transactions whose package didn't fit or failed its checks
+        CTxMemPool::setEntries failedTx;
+        UpdatePackagesForAdded(fill.inBlock, mapModifiedTx);
+
+        const uint64_t nNoLimit = std::numeric_limits<uint64_t>::max();
+        CTxMemPool::indexed_transaction_set::index<ancestor_score>::type::iterator mi = mempool.mapTx.get<ancestor_score>().begin();
+        while (mi != mempool.mapTx.get<ancestor_score>().end() || !mapModifiedTx.empty()) {
+            // The mapTx totals of an entry in mapModifiedTx count ancestors already in the block
+            if (mi != mempool.mapTx.get<ancestor_score>().end()) {
+                CTxMemPool::txiter iterTx = mempool.mapTx.project<0>(mi);
+                if (fill.inBlock.count(iterTx) || mapModifiedTx.count(iterTx) || failedTx.count(iterTx)) {
+                    ++mi;
                     continue;
+                }
+            }
 
-                bool fDoubleSerial = false;
-                for (const CTxIn txIn : tx.vin) {
-                    if (txIn.scriptSig.IsZerocoinSpend()) {
-                        libzerocoin::CoinSpend spend = TxInToZerocoinSpend(txIn);
-                        bool fUseV1Params = libzerocoin::ExtractVersionFromSerial(spend.getCoinSerialNumber()) < libzerocoin::PrivateCoin::PUBKEY_VERSION;
-                        if (!spend.HasValidSerial(Params().Zerocoin_Params(fUseV1Params)))
-                            fDoubleSerial = true;
-                        if (count(vBlockSerials.begin(), vBlockSerials.end(), spend.getCoinSerialNumber()))
-                            fDoubleSerial = true;
-                        if (count(vTxSerials.begin(), vTxSerials.end(), spend.getCoinSerialNumber()))
-                            fDoubleSerial = true;
-                        if (fDoubleSerial)
-                            break;
-                        vTxSerials.emplace_back(spend.getCoinSerialNumber());
-                    }
+            bool fUsingModified = false;
+            CTxMemPool::txiter iter;
+            modtxscoreiter modit = mapModifiedTx.get<ancestor_score>().begin();
+            if (mi == mempool.mapTx.get<ancestor_score>().end()) {
+                iter = modit->iter;
+                fUsingModified = true;
+            } else {
+                iter = mempool.mapTx.project<0>(mi);
+                if (modit != mapModifiedTx.get<ancestor_score>().end() &&
+                    CompareTxMemPoolEntryByAncestorFee()(*modit, CTxMemPoolModifiedEntry(iter))) {
+                    iter = modit->iter;
+                    fUsingModified = true;
+                } else {
+                    ++mi;
                 }
-                //This zHBET serial has already been included in the block, do not add this tx.
-                if (fDoubleSerial)
-                    continue;
             }
 
-            CAmount nTxFees = view.GetValueIn(tx) - tx.GetValueOut();
+            uint64_t nPackageSize = fUsingModified ? modit->nSizeWithAncestors : iter->GetSizeWithAncestors();
+            CAmount nPackageFees = fUsingModified ? modit->nModFeesWithAncestors : iter->GetModFeesWithAncestors();
 
-            nTxSigOps += GetP2SHSigOpCount(tx, view);
-            if (nBlockSigOps + nTxSigOps >= nMaxBlockSigOps)
-                continue;
+            // Skip free transactions if we're past the minimum block size:
+            CFeeRate packageRate(nPackageFees, nPackageSize);
+            bool fSkip = !iter->GetTx().IsZerocoinSpend() && packageRate < ::minRelayTxFee && fill.nBlockSize >= nBlockMinSize;
+
+            vector<CTxMemPool::txiter> vPackage;
+            if (!fSkip) {
+                CTxMemPool::setEntries setAncestors;
+                std::string dummy;
+                mempool.CalculateMemPoolAncestors(*iter, setAncestors, nNoLimit, nNoLimit, dummy, false);
+                BOOST_FOREACH (CTxMemPool::txiter ancestor, setAncestors) {
+                    if (!fill.inBlock.count(ancestor))
+                        vPackage.push_back(ancestor);
+                }
+                // An ancestor always has fewer ancestors than its descendants, so this puts parents first
+                std::sort(vPackage.begin(), vPackage.end(), CompareByAncestorCount());
+                vPackage.push_back(iter);
+            }
 
-            // Note that flags: we don't want to set mempool/IsStandard()
-            // policy here, but we still have to ensure that the block we
-            // create only contains transactions that are valid in new blocks.
-            CValidationState state;
-            if (!CheckInputs(tx, state, view, true, MANDATORY_SCRIPT_VERIFY_FLAGS, true))
+            if (fSkip || !AddPackageToBlock(fill, vPackage, view, nBlockMaxSize, fPrintPriority)) {
+                if (fUsingModified)
+                    mapModifiedTx.get<ancestor_score>().erase(modit);
+                failedTx.insert(iter);
                 continue;
-
-            CTxUndo txundo;
-            UpdateCoins(tx, state, view, txundo, nHeight);
-
-            // Added
-            pblock->vtx.push_back(tx);
-            pblocktemplate->vTxFees.push_back(nTxFees);
-            pblocktemplate->vTxSigOps.push_back(nTxSigOps);
-            nBlockSize += nTxSize;
-            ++nBlockTx;
-            nBlockSigOps += nTxSigOps;
-            nFees += nTxFees;
-
-            for (const CBigNum bnSerial : vTxSerials)
-                vBlockSerials.emplace_back(bnSerial);
-
-            if (fPrintPriority) {
-                LogPrintf("priority %.1f fee %s txid %s\n",
-                    dPriority, feeRate.ToString(), tx.GetHash().ToString());
             }
 
-            // Add transactions that depend on this one to the priority queue
-            if (mapDependers.count(hash)) {
-                BOOST_FOREACH (COrphan* porphan, mapDependers[hash]) {
-                    if (!porphan->setDependsOn.empty()) {
-                        porphan->setDependsOn.erase(hash);
-                        if (porphan->setDependsOn.empty()) {
-                            vecPriority.push_back(TxPriority(porphan->dPriority, porphan->feeRate, porphan->ptx));
-                            std::push_heap(vecPriority.begin(), vecPriority.end(), comparer);
-                        }
-                    }
-                }
-            }
+            CTxMemPool::setEntries setAdded(vPackage.begin(), vPackage.end());
+            BOOST_FOREACH (CTxMemPool::txiter it, vPackage)
+                mapModifiedTx.erase(it);
+            UpdatePackagesForAdded(setAdded, mapModifiedTx);
+
+            // Nothing more will fit
+            if (fill.nBlockSize + 1000 >= nBlockMaxSize)
+                break;
         }
+        nFees = fill.nFees;
+        uint64_t nBlockSize = fill.nBlockSize;
+        uint64_t nBlockTx = fill.nBlockTx;
 
         if (!fProofOfStake) {
             //Masternode and general budget payments
@@ -439,7 +560,10 @@ CBlockTemplate* CreateNewBlock(const CScript& scriptPubKeyIn, CWallet* pwallet,
             pblock->vtx[0] = txNew;
             pblocktemplate->vTxFees[0] = -nFees;
         }
-        pblock->vtx[0].vin[0].scriptSig = CScript() << nHeight << OP_0;
+        // Rebuild the coinbase rather than editing it in place, which would leave its cached hash stale
+        CMutableTransaction txCoinbase(pblock->vtx[0]);
+        txCoinbase.vin[0].scriptSig = CScript() << nHeight << OP_0;
+        pblock->vtx[0] = txCoinbase;
 
         // Fill in header
         pblock->hashPrevBlock = pindexPrev->GetBlockHash();
@@ -1858,8 +1858,8 @@ void RelayTransaction(const CTransaction& tx, const CDataStream& ss)
         mapRelay.insert(std::make_pair(inv, ss));
         vRelayExpiration.push_back(std::make_pair(GetTime() + 15 * 60, inv));
     }
-    LOCK(cs_vNodes);
-    BOOST_FOREACH (CNode* pnode, vNodes) {
+    vector<CNode*> vNodesCopy = CopyNodeVector();
+    BOOST_FOREACH (CNode* pnode, vNodesCopy) {
         if (!pnode->fRelayTxes)
             continue;
         LOCK(pnode->cs_filter);
@@ -1869,6 +1869,7 @@ void RelayTransaction(const CTransaction& tx, const CDataStream& ss)
         } else
             pnode->PushInventory(inv);
     }
+    ReleaseNodeVector(vNodesCopy);
 }
 
 void RelayTransactionLockReq(const CTransaction& tx, bool relayToAll)
@@ -1887,12 +1888,29 @@ void RelayTransactionLockReq(const CTransaction& tx, bool relayToAll)
 
 void RelayInv(CInv& inv)
 {
-    LOCK(cs_vNodes);
-    BOOST_FOREACH (CNode* pnode, vNodes){
+    vector<CNode*> vNodesCopy = CopyNodeVector();
+    BOOST_FOREACH (CNode* pnode, vNodesCopy){
     		if((pnode->nServices==NODE_BLOOM_WITHOUT_MN) && inv.IsMasterNodeType())continue;
         if (pnode->nVersion >= ActiveProtocol())
             pnode->PushInventory(inv);
     }
+    ReleaseNodeVector(vNodesCopy);
+}
+
+vector<CNode*> CopyNodeVector()
+{
+    LOCK(cs_vNodes);
+    vector<CNode*> vNodesCopy = vNodes;
+    BOOST_FOREACH (CNode* pnode, vNodesCopy)
+        pnode->AddRef();
+    return vNodesCopy;
+}
+
+void ReleaseNodeVector(const vector<CNode*>& vNodesCopy)
+{
+    LOCK(cs_vNodes);
+    BOOST_FOREACH (CNode* pnode, vNodesCopy)
+        pnode->Release();
 }
 
 void CNode::RecordBytesRecv(uint64_t bytes)
@@ -2050,7 +2068,7 @@ bool CAddrDB::Read(CAddrMan& addr)
 unsigned int ReceiveFloodSize() { return 1000 * GetArg("-maxreceivebuffer", 5 * 1000); }
 unsigned int SendBufferSize() { return 1000 * GetArg("-maxsendbuffer", 1 * 1000); }
 
-CNode::CNode(SOCKET hSocketIn, CAddress addrIn, std::string addrNameIn, bool fInboundIn) : ssSend(SER_NETWORK, INIT_PROTO_VERSION), setAddrKnown(5000)
+CNode::CNode(SOCKET hSocketIn, CAddress addrIn, std::string addrNameIn, bool fInboundIn) : ssSend(SER_NETWORK, INIT_PROTO_VERSION), setAddrKnown(5000), filterInventoryKnown(INVENTORY_KNOWN_MAX, 0.000001)
 {
     nServices = 0;
     hSocket = hSocketIn;
@@ -2079,7 +2097,6 @@ CNode::CNode(SOCKET hSocketIn, CAddress addrIn, std::string addrNameIn, bool fIn
     nStartingHeight = -1;
     fGetAddr = false;
     fRelayTxes = false;
-    setInventoryKnown.max_size(SendBufferSize() / 1000);
     pfilter = new CBloomFilter();
     nPingNonceSent = 0;
     nPingUsecStart = 0;
@@ -2114,6 +2131,35 @@ CNode::~CNode()
     GetNodeSignals().FinalizeNode(GetId());
 }
 
+/**
+ * Transactions and blocks are remembered by their hash. Other types, like MSG_TXLOCK_REQUEST
+ * and MSG_DSTX, carry the hash of a transaction, so they are remembered as type and hash:
+ * knowing the transaction does not mean the peer has seen its lock request.
+ */
+static std::vector<unsigned char> InventoryKnownKey(const CInv& inv)
+{
+    CDataStream ss(SER_NETWORK, PROTOCOL_VERSION);
+    ss << inv;
+    return std::vector<unsigned char>(ss.begin(), ss.end());
+}
+
+bool CNode::HasInventoryKnown(const CInv& inv)
+{
+    AssertLockHeld(cs_inventory);
+    if (inv.type == MSG_TX || inv.type == MSG_BLOCK)
+        return filterInventoryKnown.contains(inv.hash);
+    return filterInventoryKnown.contains(InventoryKnownKey(inv));
+}
+
+void CNode::SetInventoryKnown(const CInv& inv)
+{
+    AssertLockHeld(cs_inventory);
+    if (inv.type == MSG_TX || inv.type == MSG_BLOCK)
+        filterInventoryKnown.insert(inv.hash);
+    else
+        filterInventoryKnown.insert(InventoryKnownKey(inv));
+}
+
 void CNode::AskFor(const CInv& inv)
 {
     if (mapAskFor.size() > MAPASKFOR_MAX_SZ)
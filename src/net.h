@@ -47,6 +47,10 @@ static const int PING_INTERVAL = 2 * 60;
 static const int TIMEOUT_INTERVAL = 20 * 60;
 /** The maximum number of entries in an 'inv' protocol message */
 static const unsigned int MAX_INV_SZ = 50000;
+/** Number of recently sent or received inventory items remembered per peer. */
+static const unsigned int INVENTORY_KNOWN_MAX = 50000;
+/** Maximum number of inventory items of a single type announced to a peer per SendMessages pass. */
+static const unsigned int INVENTORY_BROADCAST_MAX = 1000;
 /** The maximum number of new addresses to accumulate before announcing. */
 static const unsigned int MAX_ADDR_TO_SEND = 1000;
 /** Maximum length of incoming protocol messages (no message over 2 MiB is currently acceptable). */
@@ -361,8 +365,12 @@ public:
     std::set<uint256> setKnown;
 
     // inventory based relay
-    mruset<CInv> setInventoryKnown;
-    std::vector<CInv> vInventoryToSend;
+    //! Use HasInventoryKnown/SetInventoryKnown, which key it on the inv type as well as the hash
+    CRollingBloomFilter filterInventoryKnown;
+    //! Block announcements, sent in the order they were queued
+    std::vector<uint256> vInventoryBlockToSend;
+    //! All other announcements, one deduplicated queue per inv type
+    std::map<int, std::set<uint256> > mapInventoryToSend;
     CCriticalSection cs_inventory;
     std::multimap<int64_t, CInv> mapAskFor;
     std::vector<uint256> vBlockRequested;
@@ -454,11 +462,16 @@ public:
     }
 
 
+    /** Whether the peer is known to have inv. Requires cs_inventory. */
+    bool HasInventoryKnown(const CInv& inv);
+    /** Remember that the peer has inv. Requires cs_inventory. */
+    void SetInventoryKnown(const CInv& inv);
+
     void AddInventoryKnown(const CInv& inv)
     {
         {
             LOCK(cs_inventory);
-            setInventoryKnown.insert(inv);
+            SetInventoryKnown(inv);
         }
     }
 
@@ -466,8 +479,12 @@ public:
     {
         {
             LOCK(cs_inventory);
-            if (!setInventoryKnown.count(inv))
-                vInventoryToSend.push_back(inv);
+            if (HasInventoryKnown(inv))
+                return;
+            if (inv.type == MSG_BLOCK)
+                vInventoryBlockToSend.push_back(inv.hash);
+            else
+                mapInventoryToSend[inv.type].insert(inv.hash);
         }
     }
 
@@ -740,6 +757,10 @@ void RelayTransaction(const CTransaction& tx, const CDataStream& ss);
 void RelayTransactionLockReq(const CTransaction& tx, bool relayToAll = false);
 void RelayInv(CInv& inv);
 
+/** Take a reference on every connected node, so they can be used without holding cs_vNodes. */
+std::vector<CNode*> CopyNodeVector();
+void ReleaseNodeVector(const std::vector<CNode*>& vNodesCopy);
+
 /** Access to the (IP) address database (peers.dat) */
 class CAddrDB
 {
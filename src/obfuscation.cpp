@@ -8,7 +8,10 @@
 #include "coincontrol.h"
 #include "init.h"
 #include "main.h"
+#include "masternode-budget.h"
+#include "masternode-payments.h"
 #include "masternodeman.h"
+#include "script/sigcache.h"
 #include "script/sign.h"
 #include "swifttx.h"
 #include "ui_interface.h"
@@ -2163,14 +2166,39 @@ bool CObfuScationSigner::SignMessage(std::string strMessage, std::string& errorM
     return true;
 }
 
+namespace {
+
+/**
+ * Message signatures already found valid. The same masternode, budget and spork
+ * messages are checked many times: relayed by every peer during a list sync and
+ * checked again when added. A cache hit costs a hash instead of a public key
+ * recovery. It is a CSignatureCache of its own, sized by -maxmsgsigcachesize.
+ */
+CSignatureCache messageSigCache;
+
+}
+
+void InitMessageSigCache()
+{
+    int64_t nMaxCacheSize = std::max((int64_t)0, std::min(GetArg("-maxmsgsigcachesize", DEFAULT_MAX_MSG_SIG_CACHE_SIZE), MAX_MAX_SIG_CACHE_SIZE));
+    size_t nEntries = messageSigCache.Setup((size_t)nMaxCacheSize << 20);
+    LogPrintf("Using %u MiB for the message signature cache, able to store %u elements\n", (unsigned int)nMaxCacheSize, (unsigned int)nEntries);
+}
+
 bool CObfuScationSigner::VerifyMessage(CPubKey pubkey, vector<unsigned char>& vchSig, std::string strMessage, std::string& errorMessage)
 {
     CHashWriter ss(SER_GETHASH, 0);
     ss << strMessageMagic;
     ss << strMessage;
+    uint256 hashMessage = ss.GetHash();
+
+    uint256 entry;
+    messageSigCache.ComputeEntry(entry, hashMessage, vchSig, pubkey);
+    if (messageSigCache.Contains(entry, false))
+        return true;
 
     CPubKey pubkey2;
-    if (!pubkey2.RecoverCompact(ss.GetHash(), vchSig)) {
+    if (!pubkey2.RecoverCompact(hashMessage, vchSig)) {
         errorMessage = _("Error recovering public key.");
         return false;
     }
@@ -2178,7 +2206,11 @@ bool CObfuScationSigner::VerifyMessage(CPubKey pubkey, vector<unsigned char>& vc
     if (fDebug && pubkey2.GetID() != pubkey.GetID())
         LogPrintf("CObfuScationSigner::VerifyMessage -- keys don't match: %s %s\n", pubkey2.GetID().ToString(), pubkey.GetID().ToString());
 
-    return (pubkey2.GetID() == pubkey.GetID());
+    if (pubkey2.GetID() != pubkey.GetID())
+        return false;
+
+    messageSigCache.Insert(entry);
+    return true;
 }
 
 bool CObfuscationQueue::Sign()
@@ -2323,3 +2355,19 @@ void ThreadCheckObfuScationPool()
         }
     }
 }
+
+void ThreadCheckMasternodeCaches()
+{
+    // Nothing relies on these lists until the masternode sync is done, which
+    // takes much longer than this, so the checks need not hold up startup.
+    int64_t nStart = GetTimeMillis();
+    mnodeman.CheckAndRemove(true);
+    {
+        LOCK(budget.cs);
+        budget.CheckAndRemove();
+    }
+    masternodePayments.CleanPaymentList();
+    LogPrint("masternode", "Checked the cached masternodes, budgets and payments  %dms\n", GetTimeMillis() - nStart);
+    LogPrint("masternode", "  %s\n", mnodeman.ToString());
+    LogPrint("mnbudget", "  %s\n", budget.ToString());
+}
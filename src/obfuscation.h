@@ -242,6 +242,12 @@ public:
     int64_t sigTime;
 };
 
+/** Default for -maxmsgsigcachesize, in MiB */
+static const int64_t DEFAULT_MAX_MSG_SIG_CACHE_SIZE = 4;
+
+/** Size the masternode message signature cache from -maxmsgsigcachesize */
+void InitMessageSigCache();
+
 /** Helper object for signing and checking signatures
  */
 class CObfuScationSigner
@@ -512,5 +518,7 @@ public:
 };
 
 void ThreadCheckObfuScationPool();
+/** Check the entries loaded from mncache.dat, budget.dat and mnpayments.dat once, after startup */
+void ThreadCheckMasternodeCaches();
 
 #endif
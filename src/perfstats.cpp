@@ -0,0 +1,199 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "perfstats.h"
+
+#include "tinyformat.h"
+
+#include <algorithm>
+
+#include <boost/thread/mutex.hpp>
+
+CPerfHistogram::CPerfHistogram() : nSum(0), nMax(0)
+{
+    for (int i = 0; i < NUM_BUCKETS; i++)
+        vBuckets[i].store(0, std::memory_order_relaxed);
+}
+
+int CPerfHistogram::BucketIndex(uint64_t nValue)
+{
+    if (nValue < 2 * SUB_BUCKETS)
+        return (int)nValue;
+    int nExponent = 63 - __builtin_clzll(nValue);
+    if (nExponent > MAX_EXPONENT)
+        return NUM_BUCKETS - 1;
+    // The top SUB_BUCKET_BITS + 1 bits select the bucket, the leading one offsetting it past the lower powers
+    return (nExponent - SUB_BUCKET_BITS) * SUB_BUCKETS + (int)(nValue >> (nExponent - SUB_BUCKET_BITS));
+}
+
+uint64_t CPerfHistogram::BucketUpperBound(int nBucket)
+{
+    if (nBucket < 2 * SUB_BUCKETS)
+        return nBucket;
+    int nExponent = nBucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    uint64_t nMantissa = nBucket % SUB_BUCKETS + SUB_BUCKETS;
+    return ((nMantissa + 1) << (nExponent - SUB_BUCKET_BITS)) - 1;
+}
+
+void CPerfHistogram::Record(int64_t nMicros)
+{
+    uint64_t nValue = nMicros > 0 ? (uint64_t)nMicros : 0;
+    vBuckets[BucketIndex(nValue)].fetch_add(1, std::memory_order_relaxed);
+    nSum.fetch_add(nValue, std::memory_order_relaxed);
+    uint64_t nPrevMax = nMax.load(std::memory_order_relaxed);
+    while (nValue > nPrevMax && !nMax.compare_exchange_weak(nPrevMax, nValue, std::memory_order_relaxed)) {
+    }
+}
+
+CPerfHistogramStats CPerfHistogram::GetStats() const
+{
+    CPerfHistogramStats stats;
+    uint64_t vCounts[NUM_BUCKETS];
+    uint64_t nTotal = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        vCounts[i] = vBuckets[i].load(std::memory_order_relaxed);
+        nTotal += vCounts[i];
+    }
+    stats.nCount = nTotal;
+    stats.nSum = nSum.load(std::memory_order_relaxed);
+    stats.nMax = nMax.load(std::memory_order_relaxed);
+    if (nTotal == 0)
+        return stats;
+
+    // Percentiles are taken from the bucket counts alone, so a concurrent Record cannot skew them
+    const uint64_t nRank50 = (nTotal * 50 + 99) / 100;
+    const uint64_t nRank90 = (nTotal * 90 + 99) / 100;
+    const uint64_t nRank99 = (nTotal * 99 + 99) / 100;
+    uint64_t nSeen = 0;
+    for (int i = 0; i < NUM_BUCKETS && nSeen < nRank99; i++) {
+        if (vCounts[i] == 0)
+            continue;
+        uint64_t nPrevSeen = nSeen;
+        nSeen += vCounts[i];
+        uint64_t nBound = std::min(BucketUpperBound(i), stats.nMax);
+        if (nPrevSeen < nRank50 && nSeen >= nRank50)
+            stats.nP50 = nBound;
+        if (nPrevSeen < nRank90 && nSeen >= nRank90)
+            stats.nP90 = nBound;
+        if (nSeen >= nRank99)
+            stats.nP99 = nBound;
+    }
+    return stats;
+}
+
+void CPerfHistogram::Reset()
+{
+    for (int i = 0; i < NUM_BUCKETS; i++)
+        vBuckets[i].store(0, std::memory_order_relaxed);
+    nSum.store(0, std::memory_order_relaxed);
+    nMax.store(0, std::memory_order_relaxed);
+}
+
+namespace
+{
+struct CPerfRegistry {
+    boost::mutex cs;
+    std::map<std::string, CPerfCounter*> mapCounters;
+    std::map<std::string, CPerfHistogram*> mapHistograms;
+};
+
+/**
+ * The registry is created on first use and never freed: call sites keep
+ * references to its entries, possibly in threads still running at exit.
+ */
+CPerfRegistry& GetRegistry()
+{
+    static CPerfRegistry* registry = new CPerfRegistry();
+    return *registry;
+}
+
+bool HasPrefix(const std::string& strName, const std::string& strPrefix)
+{
+    return strName.compare(0, strPrefix.size(), strPrefix) == 0;
+}
+
+std::string PrometheusName(const std::string& strName)
+{
+    std::string strRet = "hoolibet_";
+    for (std::string::const_iterator it = strName.begin(); it != strName.end(); ++it) {
+        char c = *it;
+        bool fValid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        strRet += fValid ? c : '_';
+    }
+    return strRet;
+}
+}
+
+CPerfCounter& GetPerfCounter(const std::string& strName)
+{
+    CPerfRegistry& registry = GetRegistry();
+    boost::mutex::scoped_lock lock(registry.cs);
+    CPerfCounter*& pcounter = registry.mapCounters[strName];
+    if (!pcounter)
+        pcounter = new CPerfCounter();
+    return *pcounter;
+}
+
+CPerfHistogram& GetPerfHistogram(const std::string& strName)
+{
+    CPerfRegistry& registry = GetRegistry();
+    boost::mutex::scoped_lock lock(registry.cs);
+    CPerfHistogram*& phistogram = registry.mapHistograms[strName];
+    if (!phistogram)
+        phistogram = new CPerfHistogram();
+    return *phistogram;
+}
+
+void GetPerfCounters(std::map<std::string, uint64_t>& mapCounters, const std::string& strPrefix)
+{
+    CPerfRegistry& registry = GetRegistry();
+    boost::mutex::scoped_lock lock(registry.cs);
+    for (std::map<std::string, CPerfCounter*>::const_iterator it = registry.mapCounters.lower_bound(strPrefix);
+         it != registry.mapCounters.end() && HasPrefix(it->first, strPrefix); ++it)
+        mapCounters[it->first] = it->second->Get();
+}
+
+void GetPerfHistograms(std::map<std::string, CPerfHistogramStats>& mapHistograms, const std::string& strPrefix)
+{
+    CPerfRegistry& registry = GetRegistry();
+    boost::mutex::scoped_lock lock(registry.cs);
+    for (std::map<std::string, CPerfHistogram*>::const_iterator it = registry.mapHistograms.lower_bound(strPrefix);
+         it != registry.mapHistograms.end() && HasPrefix(it->first, strPrefix); ++it)
+        mapHistograms[it->first] = it->second->GetStats();
+}
+
+void ResetPerfStats()
+{
+    CPerfRegistry& registry = GetRegistry();
+    boost::mutex::scoped_lock lock(registry.cs);
+    for (std::map<std::string, CPerfCounter*>::iterator it = registry.mapCounters.begin(); it != registry.mapCounters.end(); ++it)
+        it->second->Reset();
+    for (std::map<std::string, CPerfHistogram*>::iterator it = registry.mapHistograms.begin(); it != registry.mapHistograms.end(); ++it)
+        it->second->Reset();
+}
+
+std::string PerfStatsToPrometheus()
+{
+    std::map<std::string, uint64_t> mapCounters;
+    std::map<std::string, CPerfHistogramStats> mapHistograms;
+    GetPerfCounters(mapCounters);
+    GetPerfHistograms(mapHistograms);
+
+    std::string strRet;
+    for (std::map<std::string, uint64_t>::const_iterator it = mapCounters.begin(); it != mapCounters.end(); ++it) {
+        std::string strName = PrometheusName(it->first);
+        strRet += strprintf("# TYPE %s counter\n%s %u\n", strName, strName, it->second);
+    }
+    for (std::map<std::string, CPerfHistogramStats>::const_iterator it = mapHistograms.begin(); it != mapHistograms.end(); ++it) {
+        std::string strName = PrometheusName(it->first) + "_seconds";
+        const CPerfHistogramStats& stats = it->second;
+        strRet += strprintf("# TYPE %s summary\n", strName);
+        strRet += strprintf("%s{quantile=\"0.5\"} %.6f\n", strName, stats.nP50 * 0.000001);
+        strRet += strprintf("%s{quantile=\"0.9\"} %.6f\n", strName, stats.nP90 * 0.000001);
+        strRet += strprintf("%s{quantile=\"0.99\"} %.6f\n", strName, stats.nP99 * 0.000001);
+        strRet += strprintf("%s_sum %.6f\n", strName, stats.nSum * 0.000001);
+        strRet += strprintf("%s_count %u\n", strName, stats.nCount);
+    }
+    return strRet;
+}
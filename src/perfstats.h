@@ -0,0 +1,114 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef HOOLIBET_PERFSTATS_H
+#define HOOLIBET_PERFSTATS_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <stdint.h>
+#include <string>
+
+/** Monotonic clock for the perf timers, unaffected by adjustments of the wall clock */
+static inline int64_t GetPerfMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** A monotonically increasing count of events or bytes */
+class CPerfCounter
+{
+private:
+    std::atomic<uint64_t> nValue;
+
+public:
+    CPerfCounter() : nValue(0) {}
+
+    void Add(uint64_t n = 1) { nValue.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t Get() const { return nValue.load(std::memory_order_relaxed); }
+    void Reset() { nValue.store(0, std::memory_order_relaxed); }
+};
+
+struct CPerfHistogramStats {
+    uint64_t nCount;
+    uint64_t nSum;
+    uint64_t nMax;
+    uint64_t nP50;
+    uint64_t nP90;
+    uint64_t nP99;
+
+    CPerfHistogramStats() : nCount(0), nSum(0), nMax(0), nP50(0), nP90(0), nP99(0) {}
+};
+
+/**
+ * Latency histogram in microseconds with HDR-style buckets: every power of
+ * two is split into 8 linear sub-buckets, so a percentile is reported within
+ * 12.5% of the true value while the whole histogram stays a fixed array of
+ * atomics. Recording is a few relaxed atomic adds and never takes a lock.
+ */
+class CPerfHistogram
+{
+public:
+    static const int SUB_BUCKET_BITS = 3;
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    //! Values from 2^MAX_EXPONENT+1 us (about 25 days) up land in the last bucket
+    static const int MAX_EXPONENT = 40;
+    static const int NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + SUB_BUCKETS;
+
+private:
+    std::atomic<uint64_t> vBuckets[NUM_BUCKETS];
+    std::atomic<uint64_t> nSum;
+    std::atomic<uint64_t> nMax;
+
+public:
+    CPerfHistogram();
+
+    static int BucketIndex(uint64_t nValue);
+    //! The largest value counted in a bucket
+    static uint64_t BucketUpperBound(int nBucket);
+
+    void Record(int64_t nMicros);
+    CPerfHistogramStats GetStats() const;
+    void Reset();
+};
+
+/** Records the time from construction to destruction into a histogram */
+class CPerfTimer
+{
+private:
+    CPerfHistogram& histogram;
+    int64_t nStart;
+
+public:
+    explicit CPerfTimer(CPerfHistogram& histogramIn) : histogram(histogramIn), nStart(GetPerfMicros()) {}
+    ~CPerfTimer() { histogram.Record(GetPerfMicros() - nStart); }
+};
+
+/**
+ * The counter or histogram registered under a name, created on first use.
+ * Entries live until shutdown, so call sites may keep the reference.
+ */
+CPerfCounter& GetPerfCounter(const std::string& strName);
+CPerfHistogram& GetPerfHistogram(const std::string& strName);
+
+/** Snapshots of the registered entries whose names start with strPrefix */
+void GetPerfCounters(std::map<std::string, uint64_t>& mapCounters, const std::string& strPrefix = "");
+void GetPerfHistograms(std::map<std::string, CPerfHistogramStats>& mapHistograms, const std::string& strPrefix = "");
+
+/** Zero every registered counter and histogram */
+void ResetPerfStats();
+
+/** All entries in the Prometheus text exposition format, histograms as summaries in seconds */
+std::string PerfStatsToPrometheus();
+
+#define PERF_PASTE(x, y) x##y
+#define PERF_PASTE2(x, y) PERF_PASTE(x, y)
+
+/** Time the rest of the enclosing scope into the histogram named by the string literal name */
+#define PERF_TIMER(name)                                                              \
+    static CPerfHistogram& PERF_PASTE2(perfhistogram, __LINE__) = GetPerfHistogram(name); \
+    CPerfTimer PERF_PASTE2(perftimer, __LINE__)(PERF_PASTE2(perfhistogram, __LINE__))
+
+#endif // HOOLIBET_PERFSTATS_H
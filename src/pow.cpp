@@ -14,8 +14,12 @@
 #include "uint256.h"
 #include "util.h"
 
+#include <algorithm>
 #include <math.h>
 
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
 
 unsigned int GetNextWorkRequired(const CBlockIndex* pindexLast, const CBlockHeader* pblock)
 {
@@ -145,3 +149,24 @@ uint256 GetBlockProof(const CBlockIndex& block)
     // or ~bnTarget / (nTarget+1) + 1.
     return (~bnTarget / (bnTarget + 1)) + 1;
 }
+
+static void HashBlockHeaderRange(const std::vector<CBlockHeader>* pvHeaders, std::vector<uint256>* pvHashes, size_t nBegin, size_t nEnd)
+{
+    for (size_t i = nBegin; i < nEnd; i++)
+        (*pvHashes)[i] = (*pvHeaders)[i].GetHash();
+}
+
+void GetBlockHeaderHashes(const std::vector<CBlockHeader>& vHeaders, std::vector<uint256>& vHashes)
+{
+    vHashes.resize(vHeaders.size());
+
+    // Give each thread a few hundred headers at least, below that starting it costs more than it saves
+    size_t nThreads = std::min<size_t>(std::max(boost::thread::hardware_concurrency(), 1u), vHeaders.size() / 256 + 1);
+    size_t nChunk = (vHeaders.size() + nThreads - 1) / nThreads;
+
+    boost::thread_group threads;
+    for (size_t nBegin = nChunk; nBegin < vHeaders.size(); nBegin += nChunk)
+        threads.create_thread(boost::bind(&HashBlockHeaderRange, &vHeaders, &vHashes, nBegin, std::min(nBegin + nChunk, vHeaders.size())));
+    HashBlockHeaderRange(&vHeaders, &vHashes, 0, std::min(nChunk, vHeaders.size()));
+    threads.join_all();
+}
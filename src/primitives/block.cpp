@@ -6,6 +6,7 @@
 
 #include "primitives/block.h"
 
+#include "crypto/sha256.h"
 #include "hash.h"
 #include "script/standard.h"
 #include "script/sign.h"
@@ -13,14 +14,45 @@
 #include "utilstrencodings.h"
 #include "util.h"
 
+#include <assert.h>
+#include <string.h>
+
 uint256 CBlockHeader::GetHash() const
 {
-    if(nVersion < 4)
-        return HashQuark(BEGIN(nVersion), END(nNonce));
+    if(nVersion < 4) {
+        // Accepting a block asks for the Quark hash of the same header several times over;
+        // each thread remembers the last header it hashed
+        static thread_local unsigned char vchLastHeader[80];
+        static thread_local uint256 hashLastHeader;
+        static thread_local bool fLastHeader = false;
+        assert(END(nNonce) - BEGIN(nVersion) == sizeof(vchLastHeader));
+
+        if (fLastHeader && memcmp(vchLastHeader, BEGIN(nVersion), sizeof(vchLastHeader)) == 0)
+            return hashLastHeader;
+        hashLastHeader = HashQuark(BEGIN(nVersion), END(nNonce));
+        memcpy(vchLastHeader, BEGIN(nVersion), sizeof(vchLastHeader));
+        fLastHeader = true;
+        return hashLastHeader;
+    }
 
     return Hash(BEGIN(nVersion), END(nAccumulatorCheckpoint));
 }
 
+/**
+ * Replace the first (nSize + 1) / 2 hashes of a merkle tree level with the level
+ * above it. The pairs of a level are adjacent in memory, so they are hashed in one
+ * batch, several at a time where the CPU allows; each output lands at or before
+ * the pair it is computed from, and SHA256D64 allows out to equal in.
+ */
+static void MerkleLevelUp(uint256* pLevel, size_t nSize)
+{
+    SHA256D64(pLevel[0].begin(), pLevel[0].begin(), nSize / 2);
+    if (nSize % 2 == 1) {
+        const uint256 last = pLevel[nSize - 1];
+        pLevel[nSize / 2] = Hash(BEGIN(last), END(last), BEGIN(last), END(last));
+    }
+}
+
 uint256 CBlock::BuildMerkleTree(bool* fMutated) const
 {
     /* WARNING! If you're reading this because you're learning about crypto
@@ -58,44 +90,44 @@ uint256 CBlock::BuildMerkleTree(bool* fMutated) const
        known ways of changing the transactions without affecting the merkle
        root.
     */
-    vMerkleTree.clear();
-    vMerkleTree.reserve(vtx.size() * 2 + 16); // Safe upper bound for the number of total nodes.
-    for (std::vector<CTransaction>::const_iterator it(vtx.begin()); it != vtx.end(); ++it)
-        vMerkleTree.push_back(it->GetHash());
-    int j = 0;
+    if (fMutated)
+        *fMutated = false;
+    if (vtx.empty())
+        return uint256();
+
+    // Every block is checked through here; reuse the thread's buffer rather than
+    // allocating the leaves anew each time
+    static thread_local std::vector<uint256> vHashes;
+    vHashes.resize(vtx.size());
+    for (size_t i = 0; i < vtx.size(); i++)
+        vHashes[i] = vtx[i].GetHash();
+
     bool mutated = false;
-    for (int nSize = vtx.size(); nSize > 1; nSize = (nSize + 1) / 2)
-    {
-        for (int i = 0; i < nSize; i += 2)
-        {
-            int i2 = std::min(i+1, nSize-1);
-            if (i2 == i + 1 && i2 + 1 == nSize && vMerkleTree[j+i] == vMerkleTree[j+i2]) {
-                // Two identical hashes at the end of the list at a particular level.
-                mutated = true;
-            }
-            vMerkleTree.push_back(Hash(BEGIN(vMerkleTree[j+i]),  END(vMerkleTree[j+i]),
-                                       BEGIN(vMerkleTree[j+i2]), END(vMerkleTree[j+i2])));
+    for (size_t nSize = vHashes.size(); nSize > 1; nSize = (nSize + 1) / 2) {
+        if (nSize % 2 == 0 && vHashes[nSize - 2] == vHashes[nSize - 1]) {
+            // Two identical hashes at the end of the list at a particular level.
+            mutated = true;
         }
-        j += nSize;
+        MerkleLevelUp(&vHashes[0], nSize);
     }
-    if (fMutated) {
+    if (fMutated)
         *fMutated = mutated;
-    }
-    return (vMerkleTree.empty() ? uint256() : vMerkleTree.back());
+    return vHashes[0];
 }
 
 std::vector<uint256> CBlock::GetMerkleBranch(int nIndex) const
 {
-    if (vMerkleTree.empty())
-        BuildMerkleTree();
     std::vector<uint256> vMerkleBranch;
-    int j = 0;
-    for (int nSize = vtx.size(); nSize > 1; nSize = (nSize + 1) / 2)
+    std::vector<uint256> vLevel;
+    vLevel.reserve(vtx.size());
+    for (std::vector<CTransaction>::const_iterator it(vtx.begin()); it != vtx.end(); ++it)
+        vLevel.push_back(it->GetHash());
+    for (size_t nSize = vLevel.size(); nSize > 1; nSize = (nSize + 1) / 2)
     {
-        int i = std::min(nIndex^1, nSize-1);
-        vMerkleBranch.push_back(vMerkleTree[j+i]);
+        size_t i = std::min((size_t)(nIndex ^ 1), nSize - 1);
+        vMerkleBranch.push_back(vLevel[i]);
+        MerkleLevelUp(&vLevel[0], nSize);
         nIndex >>= 1;
-        j += nSize;
     }
     return vMerkleBranch;
 }
@@ -129,10 +161,6 @@ std::string CBlock::ToString() const
     {
         s << "  " << vtx[i].ToString() << "\n";
     }
-    s << "  vMerkleTree: ";
-    for (unsigned int i = 0; i < vMerkleTree.size(); i++)
-        s << " " << vMerkleTree[i].ToString();
-    s << "\n";
     return s.str();
 }
 
@@ -94,7 +94,6 @@ public:
 
     // memory only
     mutable CScript payee;
-    mutable std::vector<uint256> vMerkleTree;
 
     CBlock()
     {
@@ -121,7 +120,6 @@ public:
     {
         CBlockHeader::SetNull();
         vtx.clear();
-        vMerkleTree.clear();
         payee = CScript();
         vchBlockSig.clear();
     }
@@ -157,12 +155,13 @@ public:
         return IsProofOfStake()? std::make_pair(vtx[1].vin[0].prevout, nTime) : std::make_pair(COutPoint(), (unsigned int)0);
     }
 
-    // Build the in-memory merkle tree for this block and return the merkle root.
-    // If non-NULL, *mutated is set to whether mutation was detected in the merkle
-    // tree (a duplication of transactions in the block leading to an identical
-    // merkle root).
+    // Compute the merkle root of this block, reducing the transaction hashes level by
+    // level in place; no tree is kept. If non-NULL, *mutated is set to whether mutation
+    // was detected in the merkle tree (a duplication of transactions in the block
+    // leading to an identical merkle root).
     uint256 BuildMerkleTree(bool* mutated = NULL) const;
 
+    // The merkle branch of transaction nIndex, computed from the transactions on demand
     std::vector<uint256> GetMerkleBranch(int nIndex) const;
     static uint256 CheckMerkleBranch(uint256 hash, const std::vector<uint256>& vMerkleBranch, int nIndex);
     std::string ToString() const;
@@ -38,8 +38,14 @@ static CAmount getTxIn(const CTransaction& tx)
         return 0;
 
     CAmount Sum = 0;
-    for (unsigned int i = 0; i < tx.vin.size(); i++)
-        Sum += getPrevOut(tx.vin[i].prevout).nValue;
+    for (unsigned int i = 0; i < tx.vin.size(); i++) {
+        // The spent index carries the amount, which saves loading the previous transaction
+        CSpentIndexValue spent;
+        if (GetSpentIndex(CSpentIndexKey(tx.vin[i].prevout.hash, tx.vin[i].prevout.n), spent))
+            Sum += spent.nSatoshis;
+        else
+            Sum += getPrevOut(tx.vin[i].prevout).nValue;
+    }
     return Sum;
 }
 
@@ -165,10 +171,13 @@ CTxOut getPrevOut(const COutPoint& out)
 
 void getNextIn(const COutPoint& Out, uint256& Hash, unsigned int& n)
 {
-    // Hash = 0;
-    // n = 0;
-    // if (paddressmap)
-    //    paddressmap->ReadNextIn(Out, Hash, n);
+    Hash = 0;
+    n = 0;
+    CSpentIndexValue spent;
+    if (GetSpentIndex(CSpentIndexKey(Out.hash, Out.n), spent)) {
+        Hash = spent.txid;
+        n = spent.nInputIndex;
+    }
 }
 
 const CBlockIndex* getexplorerBlockIndex(int64_t height)
@@ -329,7 +338,7 @@ std::string TxToString(uint256 BlockHash, const CTransaction& tx)
         const CTxOut& Out = tx.vout[i];
         uint256 HashNext = uint256S("0");
         unsigned int nNext = 0;
-        bool fAddrIndex = false;
+        bool fAddrIndex = fSpentIndex;
         getNextIn(COutPoint(TxHash, i), HashNext, nNext);
         std::string OutputsContentCells[] =
             {
@@ -391,37 +400,43 @@ std::string AddressToString(const CBitcoinAddress& Address)
             _("Balance")};
     std::string TxContent = table + makeHTMLTableRow(TxLabels, sizeof(TxLabels) / sizeof(std::string));
 
-    std::set<COutPoint> PrevOuts;
-    /*
-    CScript AddressScript;
-    AddressScript.SetDestination(Address.Get());
-
+    CScript AddressScript = GetScriptForDestination(Address.Get());
     CAmount Sum = 0;
-    bool fAddrIndex = false;
 
-    if (!fAddrIndex)
-        return ""; // it will take too long to find transactions by address
-    else
-    {
-        std::vector<CDiskTxPos> Txs;
-        paddressmap->GetTxs(Txs, AddressScript.GetID());
-        BOOST_FOREACH (const CDiskTxPos& pos, Txs)
+    CTxDestination dest = Address.Get();
+    uint160 hashBytes;
+    int nAddressType = ADDRESS_NONE;
+    if (const CKeyID* keyID = boost::get<CKeyID>(&dest)) {
+        hashBytes = *keyID;
+        nAddressType = ADDRESS_P2PKH;
+    } else if (const CScriptID* scriptID = boost::get<CScriptID>(&dest)) {
+        hashBytes = *scriptID;
+        nAddressType = ADDRESS_P2SH;
+    }
+
+    std::vector<std::pair<CAddressIndexKey, CAmount> > vAddressIndex;
+    if (!fAddressIndex || !GetAddressIndex(nAddressType, hashBytes, vAddressIndex))
+        return ""; // it would take too long to find the transactions by scanning the chain
+
+    // The index holds one entry per input and output of the address, in chain order
+    std::set<uint256> setSeen;
+    for (const std::pair<CAddressIndexKey, CAmount>& entry : vAddressIndex) {
+        if (!setSeen.insert(entry.first.txhash).second)
+            continue;
+        CTransaction tx;
+        uint256 hashBlock;
+        if (!GetTransaction(entry.first.txhash, tx, hashBlock, true))
+            continue;
+        const CBlockIndex* pindex;
         {
-            CTransaction tx;
-            CBlock block;
-            uint256 bhash = block.GetHash();
-            GetTransaction(pos.nTxOffset, tx, bhash);
-            std::map<uint256, CBlockIndex*>::iterator mi = mapBlockIndex.find(block.GetHash());
-            if (mi == mapBlockIndex.end())
-                continue;
-            CBlockIndex* pindex = (*mi).second;
-            if (!pindex || !chainActive.Contains(pindex))
-                continue;
-            std::string Prepend = "<a href=\"" + itostr(pindex->nHeight) + "\">" + TimeToString(pindex->nTime) + "</a>";
-            TxContent += TxToRow(tx, AddressScript, Prepend, &Sum);
+            LOCK(cs_main);
+            pindex = chainActive[entry.first.nBlockHeight];
         }
+        if (!pindex)
+            continue;
+        std::string Prepend = "<a href=\"" + itostr(pindex->nHeight) + "\">" + TimeToString(pindex->nTime) + "</a>";
+        TxContent += TxToRow(tx, AddressScript, Prepend, &Sum);
     }
-    */
     TxContent += "</table>";
 
     std::string Content;
@@ -9,6 +9,7 @@
 #include "primitives/transaction.h"
 #include "main.h"
 #include "httpserver.h"
+#include "perfstats.h"
 #include "rpcserver.h"
 #include "streams.h"
 #include "sync.h"
@@ -340,6 +341,36 @@ static bool rest_mempool_contents(HTTPRequest* req, const std::string& strURIPar
     return true; // continue to process further HTTP reqs on this cxn
 }
 
+static bool rest_perfstats(HTTPRequest* req, const std::string& strURIPart)
+{
+    vector<string> params;
+    const RetFormat rf = ParseDataFormat(params, strURIPart);
+
+    // Prometheus scrapes the text exposition format, which is not one of the data formats of the other endpoints
+    if (params.size() > 1 && params[1] == "txt") {
+        req->WriteHeader("Content-Type", "text/plain; version=0.0.4");
+        req->WriteReply(HTTP_OK, PerfStatsToPrometheus());
+        return true;
+    }
+
+    switch (rf) {
+    case RF_JSON: {
+        UniValue rpcParams(UniValue::VARR);
+        UniValue perfStatsObject = getperfstats(rpcParams, false);
+        string strJSON = perfStatsObject.write() + "\n";
+        req->WriteHeader("Content-Type", "application/json");
+        req->WriteReply(HTTP_OK, strJSON);
+        return true;
+    }
+    default: {
+        return RESTERR(req, HTTP_NOT_FOUND, "output format not found (available: json, txt)");
+    }
+    }
+
+    // not reached
+    return true; // continue to process further HTTP reqs on this cxn
+}
+
 static bool rest_tx(HTTPRequest* req, const std::string& strURIPart)
 {
     if (!CheckWarmup(req))
@@ -599,6 +630,7 @@ static const struct {
       {"/rest/chaininfo", rest_chaininfo},
       {"/rest/mempool/info", rest_mempool_info},
       {"/rest/mempool/contents", rest_mempool_contents},
+      {"/rest/perfstats", rest_perfstats},
       {"/rest/headers/", rest_headers},
       {"/rest/getutxos", rest_getutxos},
 };
@@ -30,6 +30,9 @@ static const CRPCConvertParam vRPCConvertParams[] =
     {
         {"stop", 0},
         {"setmocktime", 0},
+        {"getperfstats", 1},
+        {"getlockstats", 0},
+        {"getlockstats", 2},
         {"getaddednodeinfo", 0},
         {"setgenerate", 0},
         {"setgenerate", 1},
@@ -49,6 +52,12 @@ static const CRPCConvertParam vRPCConvertParams[] =
         {"getbalance", 1},
         {"getbalance", 2},
         {"getblockhash", 0},
+        {"getblockhashes", 0},
+        {"getblockhashes", 1},
+        {"getaddressbalance", 0},
+        {"getaddressdeltas", 0},
+        {"getaddressutxos", 0},
+        {"getspentinfo", 0},
         {"move", 2},
         {"move", 3},
         {"sendfrom", 2},
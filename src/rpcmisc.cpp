@@ -12,8 +12,10 @@
 #include "masternode-sync.h"
 #include "net.h"
 #include "netbase.h"
+#include "perfstats.h"
 #include "rpcserver.h"
 #include "spork.h"
+#include "sync.h"
 #include "timedata.h"
 #include "util.h"
 #ifdef ENABLE_WALLET
@@ -598,3 +600,385 @@ UniValue getstakingstatus(const UniValue& params, bool fHelp)
     return obj;
 }
 #endif // ENABLE_WALLET
+
+static UniValue PerfHistogramToJSON(const CPerfHistogramStats& stats)
+{
+    UniValue entry(UniValue::VOBJ);
+    entry.push_back(Pair("count", (int64_t)stats.nCount));
+    entry.push_back(Pair("total", (int64_t)stats.nSum));
+    entry.push_back(Pair("mean", stats.nCount ? (int64_t)(stats.nSum / stats.nCount) : 0));
+    entry.push_back(Pair("max", (int64_t)stats.nMax));
+    entry.push_back(Pair("p50", (int64_t)stats.nP50));
+    entry.push_back(Pair("p90", (int64_t)stats.nP90));
+    entry.push_back(Pair("p99", (int64_t)stats.nP99));
+    return entry;
+}
+
+UniValue getperfstats(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() > 2)
+        throw runtime_error(
+            "getperfstats ( \"prefix\" reset )\n"
+            "\nReturns the performance counters and latency histograms collected since startup or the last reset.\n"
+
+            "\nArguments:\n"
+            "1. \"prefix\"    (string, optional) Only return the entries whose name starts with this, e.g. \"validation.\"\n"
+            "2. reset         (boolean, optional, default=false) Zero every counter and histogram after reading them\n"
+
+            "\nResult:\n"
+            "{\n"
+            "  \"counters\": {\n"
+            "    \"name\": xxxxx,        (numeric) Events or bytes counted under this name\n"
+            "    ...\n"
+            "  },\n"
+            "  \"histograms\": {          Latencies in microseconds\n"
+            "    \"name\": {\n"
+            "      \"count\": xxxxx,     (numeric) Number of recorded samples\n"
+            "      \"total\": xxxxx,     (numeric) Sum of the samples\n"
+            "      \"mean\": xxxxx,      (numeric) Average sample\n"
+            "      \"max\": xxxxx,       (numeric) Largest sample\n"
+            "      \"p50\": xxxxx,       (numeric) Median, within 12.5%\n"
+            "      \"p90\": xxxxx,       (numeric) 90th percentile, within 12.5%\n"
+            "      \"p99\": xxxxx        (numeric) 99th percentile, within 12.5%\n"
+            "    },\n"
+            "    ...\n"
+            "  }\n"
+            "}\n"
+
+            "\nExamples:\n" +
+            HelpExampleCli("getperfstats", "") + HelpExampleCli("getperfstats", "\"net.msg.\"") + HelpExampleRpc("getperfstats", "\"validation.\", true"));
+
+    std::string strPrefix = params.size() > 0 ? params[0].get_str() : "";
+    bool fReset = params.size() > 1 ? params[1].get_bool() : false;
+
+    std::map<std::string, uint64_t> mapCounters;
+    std::map<std::string, CPerfHistogramStats> mapHistograms;
+    GetPerfCounters(mapCounters, strPrefix);
+    GetPerfHistograms(mapHistograms, strPrefix);
+    if (fReset)
+        ResetPerfStats();
+
+    UniValue counters(UniValue::VOBJ);
+    for (std::map<std::string, uint64_t>::const_iterator it = mapCounters.begin(); it != mapCounters.end(); ++it)
+        counters.push_back(Pair(it->first, (int64_t)it->second));
+
+    UniValue histograms(UniValue::VOBJ);
+    for (std::map<std::string, CPerfHistogramStats>::const_iterator it = mapHistograms.begin(); it != mapHistograms.end(); ++it)
+        histograms.push_back(Pair(it->first, PerfHistogramToJSON(it->second)));
+
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("counters", counters));
+    ret.push_back(Pair("histograms", histograms));
+    return ret;
+}
+
+UniValue getlockstats(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() > 3)
+        throw runtime_error(
+            "getlockstats ( count \"lock\" reset )\n"
+            "\nReturns the lock call sites profiled since startup or the last reset, the most waited on first.\n"
+            "Requires the node to run with -lockprofile.\n"
+
+            "\nArguments:\n"
+            "1. count         (numeric, optional, default=20) Number of call sites to return, 0 for all\n"
+            "2. \"lock\"      (string, optional) Only return the sites of this lock, e.g. \"cs_main\"\n"
+            "3. reset         (boolean, optional, default=false) Zero the statistics of every site after reading them\n"
+
+            "\nResult:\n"
+            "[\n"
+            "  {\n"
+            "    \"lock\": \"name\",        (string) The locked expression, e.g. cs_main\n"
+            "    \"location\": \"file:line\", (string) Where it was locked\n"
+            "    \"contended\": xxxxx,     (numeric) Acquisitions that had to wait for another thread\n"
+            "    \"wait\": {...},          (object) Microseconds waited per acquisition, as in getperfstats\n"
+            "    \"hold\": {...}           (object) Microseconds held per acquisition, as in getperfstats\n"
+            "  },\n"
+            "  ...\n"
+            "]\n"
+
+            "\nExamples:\n" +
+            HelpExampleCli("getlockstats", "") + HelpExampleCli("getlockstats", "10 \"cs_main\"") + HelpExampleRpc("getlockstats", "0, \"cs_main\", true"));
+
+    if (!fLockProfiling)
+        throw JSONRPCError(RPC_MISC_ERROR, "Lock profiling is disabled, restart with -lockprofile");
+
+    unsigned int nCount = params.size() > 0 ? params[0].get_int() : 20;
+    std::string strLock = params.size() > 1 ? params[1].get_str() : "";
+    bool fReset = params.size() > 2 ? params[2].get_bool() : false;
+
+    std::vector<CLockSiteStats> vStats;
+    GetLockSiteStats(vStats);
+    if (fReset)
+        ResetLockSiteStats();
+
+    UniValue ret(UniValue::VARR);
+    for (std::vector<CLockSiteStats>::const_iterator it = vStats.begin(); it != vStats.end(); ++it) {
+        if (nCount > 0 && ret.size() >= nCount)
+            break;
+        if (!strLock.empty() && it->strName != strLock)
+            continue;
+        UniValue entry(UniValue::VOBJ);
+        entry.push_back(Pair("lock", it->strName));
+        entry.push_back(Pair("location", it->strLocation));
+        entry.push_back(Pair("contended", (int64_t)it->nContended));
+        entry.push_back(Pair("wait", PerfHistogramToJSON(it->wait)));
+        entry.push_back(Pair("hold", PerfHistogramToJSON(it->hold)));
+        ret.push_back(entry);
+    }
+    return ret;
+}
+
+/** The addresses named by an address index call: a single address, or an object with an "addresses" array */
+static std::vector<std::pair<uint160, int> > ParseIndexAddresses(const UniValue& param)
+{
+    std::vector<std::string> vStrAddresses;
+    if (param.isStr()) {
+        vStrAddresses.push_back(param.get_str());
+    } else if (param.isObject()) {
+        const UniValue& addresses = find_value(param.get_obj(), "addresses");
+        if (!addresses.isArray())
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "Addresses is expected to be an array");
+        for (unsigned int i = 0; i < addresses.size(); i++)
+            vStrAddresses.push_back(addresses[i].get_str());
+    } else {
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Expected an address or an object with an addresses array");
+    }
+
+    std::vector<std::pair<uint160, int> > vAddresses;
+    for (const std::string& strAddress : vStrAddresses) {
+        CBitcoinAddress address(strAddress);
+        if (!address.IsValid())
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address: " + strAddress);
+        CTxDestination dest = address.Get();
+        if (const CKeyID* keyID = boost::get<CKeyID>(&dest))
+            vAddresses.push_back(std::make_pair(*keyID, (int)ADDRESS_P2PKH));
+        else if (const CScriptID* scriptID = boost::get<CScriptID>(&dest))
+            vAddresses.push_back(std::make_pair(*scriptID, (int)ADDRESS_P2SH));
+        else
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Invalid address: " + strAddress);
+    }
+    return vAddresses;
+}
+
+static std::string IndexAddressToString(int nAddressType, const uint160& hashBytes)
+{
+    if (nAddressType == ADDRESS_P2SH)
+        return CBitcoinAddress(CScriptID(hashBytes)).ToString();
+    return CBitcoinAddress(CKeyID(hashBytes)).ToString();
+}
+
+static bool HeightSort(const std::pair<CAddressIndexKey, CAmount>& a, const std::pair<CAddressIndexKey, CAmount>& b)
+{
+    if (a.first.nBlockHeight != b.first.nBlockHeight)
+        return a.first.nBlockHeight < b.first.nBlockHeight;
+    return a.first.nTxIndex < b.first.nTxIndex;
+}
+
+UniValue getaddressbalance(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 1)
+        throw runtime_error(
+            "getaddressbalance \"address\"|{\"addresses\":[\"address\",...]}\n"
+            "\nReturns the confirmed balance of one or more addresses (requires -addressindex).\n"
+
+            "\nArguments:\n"
+            "1. \"address\"       (string or object, required) An address, or an object with an \"addresses\" array\n"
+
+            "\nResult:\n"
+            "{\n"
+            "  \"balance\" : n,   (numeric) The current balance in HBET\n"
+            "  \"received\" : n,  (numeric) The total amount received in HBET, including change\n"
+            "}\n"
+
+            "\nExamples:\n" +
+            HelpExampleCli("getaddressbalance", "'{\"addresses\": [\"DMJRSsuU9zfyrvxVaAEFQqK4MxZg6vgeS6\"]}'") +
+            HelpExampleRpc("getaddressbalance", "{\"addresses\": [\"DMJRSsuU9zfyrvxVaAEFQqK4MxZg6vgeS6\"]}"));
+
+    if (!fAddressIndex)
+        throw JSONRPCError(RPC_MISC_ERROR, "Addresses are not indexed; start with -addressindex");
+
+    std::vector<std::pair<uint160, int> > vAddresses = ParseIndexAddresses(params[0]);
+
+    CAmount nBalance = 0;
+    CAmount nReceived = 0;
+    for (const std::pair<uint160, int>& address : vAddresses) {
+        std::vector<std::pair<CAddressIndexKey, CAmount> > vAddressIndex;
+        if (!GetAddressIndex(address.second, address.first, vAddressIndex))
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+        for (const std::pair<CAddressIndexKey, CAmount>& entry : vAddressIndex) {
+            if (entry.second > 0)
+                nReceived += entry.second;
+            nBalance += entry.second;
+        }
+    }
+
+    UniValue result(UniValue::VOBJ);
+    result.push_back(Pair("balance", ValueFromAmount(nBalance)));
+    result.push_back(Pair("received", ValueFromAmount(nReceived)));
+    return result;
+}
+
+UniValue getaddressutxos(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 1)
+        throw runtime_error(
+            "getaddressutxos \"address\"|{\"addresses\":[\"address\",...]}\n"
+            "\nReturns the confirmed unspent outputs paying one or more addresses (requires -addressindex).\n"
+
+            "\nArguments:\n"
+            "1. \"address\"       (string or object, required) An address, or an object with an \"addresses\" array\n"
+
+            "\nResult:\n"
+            "[\n"
+            "  {\n"
+            "    \"address\" : \"address\",  (string) The address\n"
+            "    \"txid\" : \"hash\",        (string) The output txid\n"
+            "    \"outputIndex\" : n,      (numeric) The output index\n"
+            "    \"script\" : \"hex\",       (string) The output script\n"
+            "    \"amount\" : n,           (numeric) The output amount in HBET\n"
+            "    \"height\" : n            (numeric) The height of the block containing the output\n"
+            "  }\n"
+            "  ,...\n"
+            "]\n"
+
+            "\nExamples:\n" +
+            HelpExampleCli("getaddressutxos", "'{\"addresses\": [\"DMJRSsuU9zfyrvxVaAEFQqK4MxZg6vgeS6\"]}'") +
+            HelpExampleRpc("getaddressutxos", "{\"addresses\": [\"DMJRSsuU9zfyrvxVaAEFQqK4MxZg6vgeS6\"]}"));
+
+    if (!fAddressIndex)
+        throw JSONRPCError(RPC_MISC_ERROR, "Addresses are not indexed; start with -addressindex");
+
+    std::vector<std::pair<uint160, int> > vAddresses = ParseIndexAddresses(params[0]);
+
+    UniValue result(UniValue::VARR);
+    for (const std::pair<uint160, int>& address : vAddresses) {
+        std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> > vUnspent;
+        if (!GetAddressUnspent(address.second, address.first, vUnspent))
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+        std::string strAddress = IndexAddressToString(address.second, address.first);
+        for (const std::pair<CAddressUnspentKey, CAddressUnspentValue>& entry : vUnspent) {
+            UniValue output(UniValue::VOBJ);
+            output.push_back(Pair("address", strAddress));
+            output.push_back(Pair("txid", entry.first.txhash.GetHex()));
+            output.push_back(Pair("outputIndex", (int64_t)entry.first.nIndex));
+            output.push_back(Pair("script", HexStr(entry.second.script.begin(), entry.second.script.end())));
+            output.push_back(Pair("amount", ValueFromAmount(entry.second.nSatoshis)));
+            output.push_back(Pair("height", entry.second.nBlockHeight));
+            result.push_back(output);
+        }
+    }
+    return result;
+}
+
+UniValue getaddressdeltas(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 1)
+        throw runtime_error(
+            "getaddressdeltas \"address\"|{\"addresses\":[\"address\",...],\"start\":n,\"end\":n}\n"
+            "\nReturns every confirmed balance change of one or more addresses in chain order (requires -addressindex).\n"
+
+            "\nArguments:\n"
+            "1. \"address\"       (string or object, required) An address, or an object with an \"addresses\" array\n"
+            "                   and optionally the \"start\" and \"end\" heights to limit the result to\n"
+
+            "\nResult:\n"
+            "[\n"
+            "  {\n"
+            "    \"amount\" : n,           (numeric) The change in HBET, negative for spends\n"
+            "    \"txid\" : \"hash\",        (string) The transaction id\n"
+            "    \"index\" : n,            (numeric) The input or output index\n"
+            "    \"blockindex\" : n,       (numeric) The position of the transaction in its block\n"
+            "    \"height\" : n,           (numeric) The block height\n"
+            "    \"address\" : \"address\"   (string) The address\n"
+            "  }\n"
+            "  ,...\n"
+            "]\n"
+
+            "\nExamples:\n" +
+            HelpExampleCli("getaddressdeltas", "'{\"addresses\": [\"DMJRSsuU9zfyrvxVaAEFQqK4MxZg6vgeS6\"], \"start\": 1000, \"end\": 2000}'") +
+            HelpExampleRpc("getaddressdeltas", "{\"addresses\": [\"DMJRSsuU9zfyrvxVaAEFQqK4MxZg6vgeS6\"], \"start\": 1000, \"end\": 2000}"));
+
+    if (!fAddressIndex)
+        throw JSONRPCError(RPC_MISC_ERROR, "Addresses are not indexed; start with -addressindex");
+
+    int nStart = 0;
+    int nEnd = 0;
+    if (params[0].isObject()) {
+        const UniValue& startValue = find_value(params[0].get_obj(), "start");
+        const UniValue& endValue = find_value(params[0].get_obj(), "end");
+        if (!startValue.isNull() || !endValue.isNull()) {
+            if (!startValue.isNum() || !endValue.isNum())
+                throw JSONRPCError(RPC_INVALID_PARAMETER, "Start and end are expected to be given together as heights");
+            nStart = startValue.get_int();
+            nEnd = endValue.get_int();
+            if (nStart <= 0 || nEnd < nStart)
+                throw JSONRPCError(RPC_INVALID_PARAMETER, "Start and end are expected to be positive with start <= end");
+        }
+    }
+
+    std::vector<std::pair<uint160, int> > vAddresses = ParseIndexAddresses(params[0]);
+
+    std::vector<std::pair<CAddressIndexKey, CAmount> > vAddressIndex;
+    for (const std::pair<uint160, int>& address : vAddresses) {
+        if (!GetAddressIndex(address.second, address.first, vAddressIndex, nStart, nEnd))
+            throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "No information available for address");
+    }
+    // Each address comes back in chain order; merge them when several were asked for
+    if (vAddresses.size() > 1)
+        std::stable_sort(vAddressIndex.begin(), vAddressIndex.end(), HeightSort);
+
+    UniValue result(UniValue::VARR);
+    for (const std::pair<CAddressIndexKey, CAmount>& entry : vAddressIndex) {
+        UniValue delta(UniValue::VOBJ);
+        delta.push_back(Pair("amount", ValueFromAmount(entry.second)));
+        delta.push_back(Pair("txid", entry.first.txhash.GetHex()));
+        delta.push_back(Pair("index", (int64_t)entry.first.nIndex));
+        delta.push_back(Pair("blockindex", (int64_t)entry.first.nTxIndex));
+        delta.push_back(Pair("height", entry.first.nBlockHeight));
+        delta.push_back(Pair("address", IndexAddressToString(entry.first.nAddressType, entry.first.hashBytes)));
+        result.push_back(delta);
+    }
+    return result;
+}
+
+UniValue getspentinfo(const UniValue& params, bool fHelp)
+{
+    if (fHelp || params.size() != 1 || !params[0].isObject())
+        throw runtime_error(
+            "getspentinfo {\"txid\":\"hash\",\"index\":n}\n"
+            "\nReturns the input spending an output (requires -spentindex).\n"
+
+            "\nArguments:\n"
+            "1. {\"txid\":\"hash\",\"index\":n}  (object, required) The output\n"
+
+            "\nResult:\n"
+            "{\n"
+            "  \"txid\" : \"hash\",   (string) The spending transaction id\n"
+            "  \"index\" : n,       (numeric) The spending input index\n"
+            "  \"height\" : n       (numeric) The height of the block containing the spend\n"
+            "}\n"
+
+            "\nExamples:\n" +
+            HelpExampleCli("getspentinfo", "'{\"txid\": \"0437cd7f8525ceed2324359c2d0ba26006d92d856a9c20fa0241106ee5a597c9\", \"index\": 0}'") +
+            HelpExampleRpc("getspentinfo", "{\"txid\": \"0437cd7f8525ceed2324359c2d0ba26006d92d856a9c20fa0241106ee5a597c9\", \"index\": 0}"));
+
+    if (!fSpentIndex)
+        throw JSONRPCError(RPC_MISC_ERROR, "Spends are not indexed; start with -spentindex");
+
+    const UniValue& txidValue = find_value(params[0].get_obj(), "txid");
+    const UniValue& indexValue = find_value(params[0].get_obj(), "index");
+    if (!txidValue.isStr() || !indexValue.isNum())
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "Invalid txid or index");
+
+    CSpentIndexKey key(ParseHashV(txidValue, "txid"), indexValue.get_int());
+    CSpentIndexValue value;
+    if (!GetSpentIndex(key, value))
+        throw JSONRPCError(RPC_INVALID_ADDRESS_OR_KEY, "Unable to get spent info");
+
+    UniValue result(UniValue::VOBJ);
+    result.push_back(Pair("txid", value.txid.GetHex()));
+    result.push_back(Pair("index", (int64_t)value.nInputIndex));
+    result.push_back(Pair("height", value.nBlockHeight));
+    return result;
+}
@@ -5,84 +5,152 @@
 
 #include "sigcache.h"
 
+#include "crypto/common.h"
+#include "crypto/sha256.h"
 #include "pubkey.h"
 #include "random.h"
-#include "uint256.h"
 #include "util.h"
 
-#include <boost/thread.hpp>
-#include <boost/tuple/tuple_comparison.hpp>
+#include <algorithm>
 
 namespace {
 
-/**
- * Valid signature cache, to avoid doing expensive ECDSA signature checking
- * twice for every transaction (once when accepted into memory pool, and
- * again when accepted into the block chain)
- */
-class CSignatureCache
+void EntryToWords(const uint256& entry, uint64_t words[4])
 {
-private:
-     //! sigdata_type is (signature hash, signature, public key):
-    typedef boost::tuple<uint256, std::vector<unsigned char>, CPubKey> sigdata_type;
-    std::set< sigdata_type> setValid;
-    boost::shared_mutex cs_sigcache;
-
-public:
-    bool
-    Get(const uint256 &hash, const std::vector<unsigned char>& vchSig, const CPubKey& pubKey)
-    {
-        boost::shared_lock<boost::shared_mutex> lock(cs_sigcache);
-
-        sigdata_type k(hash, vchSig, pubKey);
-        std::set<sigdata_type>::iterator mi = setValid.find(k);
-        if (mi != setValid.end())
-            return true;
+    for (int i = 0; i < 4; i++)
+        words[i] = ReadLE64(entry.begin() + 8 * i);
+    // Keep zero free to mark empty slots
+    words[0] |= 1;
+}
+
+CSignatureCache signatureCache;
+
+}
+
+CSignatureCache::CSignatureCache() : nSlots(0), nEvict(0), nMaxDepth(0)
+{
+}
+
+size_t CSignatureCache::Setup(size_t nBytes)
+{
+    GetRandBytes(nonce.begin(), 32);
+    nSlots = nBytes / sizeof(Slot);
+    table.reset(nSlots ? new Slot[nSlots] : NULL);
+    for (size_t i = 0; i < nSlots; i++)
+        for (int j = 0; j < 4; j++)
+            table[i].words[j].store(0, std::memory_order_relaxed);
+    // Give up on a chain of displacements after about log2(nSlots) moves
+    nMaxDepth = 1;
+    while ((size_t(1) << nMaxDepth) < nSlots)
+        nMaxDepth++;
+    return nSlots;
+}
+
+void CSignatureCache::ComputeEntry(uint256& entry, const uint256& hash, const std::vector<unsigned char>& vchSig, const CPubKey& pubkey) const
+{
+    // The salt keeps peers from choosing signatures that crowd the same slots
+    CSHA256().Write(nonce.begin(), 32).Write(hash.begin(), 32).Write(pubkey.begin(), pubkey.size()).Write(vchSig.empty() ? NULL : &vchSig[0], vchSig.size()).Finalize(entry.begin());
+}
+
+void CSignatureCache::GetLocations(const uint64_t words[4], size_t locations[LOCATIONS]) const
+{
+    // Map each 32 bit piece of the entry onto [0, nSlots) by multiply and shift
+    for (int i = 0; i < LOCATIONS; i++) {
+        uint32_t n = words[i / 2] >> (32 * (i % 2));
+        locations[i] = (size_t)(((uint64_t)n * (uint64_t)nSlots) >> 32);
+    }
+}
+
+bool CSignatureCache::Contains(const uint256& entry, bool fErase)
+{
+    if (nSlots == 0)
         return false;
+
+    uint64_t words[4];
+    EntryToWords(entry, words);
+    size_t locations[LOCATIONS];
+    GetLocations(words, locations);
+
+    // A read racing with an insert can see a mix of two entries' words. That
+    // only matches if the mix equals this salted hash, which does not happen
+    // in practice; otherwise it is a miss and the signature gets verified.
+    for (int i = 0; i < LOCATIONS; i++) {
+        Slot& slot = table[locations[i]];
+        uint64_t first = slot.words[0].load(std::memory_order_relaxed);
+        if (first != words[0] ||
+            slot.words[1].load(std::memory_order_relaxed) != words[1] ||
+            slot.words[2].load(std::memory_order_relaxed) != words[2] ||
+            slot.words[3].load(std::memory_order_relaxed) != words[3])
+            continue;
+        if (fErase)
+            slot.words[0].compare_exchange_strong(first, 0, std::memory_order_relaxed);
+        return true;
     }
+    return false;
+}
 
-    void Set(const uint256 &hash, const std::vector<unsigned char>& vchSig, const CPubKey& pubKey)
-    {
-        // DoS prevention: limit cache size to less than 10MB
-        // (~200 bytes per cache entry times 50,000 entries)
-        // Since there are a maximum of 20,000 signature operations per block
-        // 50,000 is a reasonable default.
-        int64_t nMaxCacheSize = GetArg("-maxsigcachesize", 50000);
-        if (nMaxCacheSize <= 0) return;
-
-        boost::unique_lock<boost::shared_mutex> lock(cs_sigcache);
-
-        while (static_cast<int64_t>(setValid.size()) > nMaxCacheSize)
-        {
-            // Evict a random entry. Random because that helps
-            // foil would-be DoS attackers who might try to pre-generate
-            // and re-use a set of valid signatures just-slightly-greater
-            // than our cache size.
-            uint256 randomHash = GetRandHash();
-            std::set<sigdata_type>::iterator it = setValid.lower_bound(sigdata_type(randomHash));
-            if (it == setValid.end())
-                it = setValid.begin();
-            setValid.erase(*it);
+void CSignatureCache::Insert(const uint256& entry)
+{
+    if (nSlots == 0)
+        return;
+
+    uint64_t words[4];
+    EntryToWords(entry, words);
+
+    boost::unique_lock<boost::mutex> lock(cs_insert);
+    for (unsigned int nDepth = 0; nDepth <= nMaxDepth; nDepth++) {
+        size_t locations[LOCATIONS];
+        GetLocations(words, locations);
+
+        for (int i = 0; i < LOCATIONS; i++) {
+            Slot& slot = table[locations[i]];
+            if (slot.words[0].load(std::memory_order_relaxed) == words[0] &&
+                slot.words[1].load(std::memory_order_relaxed) == words[1] &&
+                slot.words[2].load(std::memory_order_relaxed) == words[2] &&
+                slot.words[3].load(std::memory_order_relaxed) == words[3])
+                return;
+        }
+        for (int i = 0; i < LOCATIONS; i++) {
+            Slot& slot = table[locations[i]];
+            if (slot.words[0].load(std::memory_order_relaxed) != 0)
+                continue;
+            for (int j = 3; j >= 0; j--)
+                slot.words[j].store(words[j], std::memory_order_relaxed);
+            return;
         }
 
-        sigdata_type k(hash, vchSig, pubKey);
-        setValid.insert(k);
+        // Every slot is taken: move into one, rotating which, and carry its entry on
+        Slot& slot = table[locations[nEvict++ % LOCATIONS]];
+        for (int j = 3; j >= 0; j--)
+            words[j] = slot.words[j].exchange(words[j], std::memory_order_relaxed);
+        if (words[0] == 0)
+            return; // erased while we moved in
     }
-};
+    // The entry displaced last is dropped
+}
 
+void InitSignatureCache()
+{
+    int64_t nMaxCacheSize = std::max((int64_t)0, std::min(GetArg("-maxsigcachesize", DEFAULT_MAX_SIG_CACHE_SIZE), MAX_MAX_SIG_CACHE_SIZE));
+    size_t nBytes = (size_t)nMaxCacheSize << 20;
+    size_t nEntries = signatureCache.Setup(nBytes);
+    LogPrintf("Using %u MiB for the signature cache, able to store %u elements\n", (unsigned int)nMaxCacheSize, (unsigned int)nEntries);
 }
 
 bool CachingTransactionSignatureChecker::VerifySignature(const std::vector<unsigned char>& vchSig, const CPubKey& pubkey, const uint256& sighash) const
 {
-    static CSignatureCache signatureCache;
+    uint256 entry;
+    signatureCache.ComputeEntry(entry, sighash, vchSig, pubkey);
 
-    if (signatureCache.Get(sighash, vchSig, pubkey))
+    // Checks for a block do not store; their hits are erased, as the block
+    // confirms the transaction and it won't be checked again
+    if (signatureCache.Contains(entry, !store))
         return true;
 
     if (!TransactionSignatureChecker::VerifySignature(vchSig, pubkey, sighash))
         return false;
 
     if (store)
-        signatureCache.Set(sighash, vchSig, pubkey);
+        signatureCache.Insert(entry);
     return true;
 }
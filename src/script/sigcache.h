@@ -7,11 +7,69 @@
 #define BITCOIN_SCRIPT_SIGCACHE_H
 
 #include "script/interpreter.h"
+#include "uint256.h"
 
+#include <atomic>
+#include <stdint.h>
 #include <vector>
 
+#include <boost/scoped_array.hpp>
+#include <boost/thread/mutex.hpp>
+
+/** Default and maximum -maxsigcachesize, in MiB */
+static const int64_t DEFAULT_MAX_SIG_CACHE_SIZE = 32;
+static const int64_t MAX_MAX_SIG_CACHE_SIZE = 16384;
+
 class CPubKey;
 
+/**
+ * Valid signature cache, to avoid doing expensive ECDSA signature checking
+ * twice for every transaction (once when accepted into memory pool, and
+ * again when accepted into the block chain).
+ *
+ * Each (signature hash, public key, signature) is stored as a salted SHA256
+ * in a fixed table of atomic words. An entry can live in any of LOCATIONS
+ * slots picked by its own bits, and inserting into a full set of slots moves
+ * the occupant to one of its other slots, cuckoo style. Lookups and erases
+ * take no lock, so the script check threads never wait on each other;
+ * inserts are serialized by a mutex.
+ */
+class CSignatureCache
+{
+public:
+    static const int LOCATIONS = 8;
+
+    CSignatureCache();
+
+    /** Allocate and clear the table, returning the number of entries it holds. Not thread safe. */
+    size_t Setup(size_t nBytes);
+
+    void ComputeEntry(uint256& entry, const uint256& hash, const std::vector<unsigned char>& vchSig, const CPubKey& pubkey) const;
+
+    /** Whether the entry is cached; fErase frees its slot on a hit */
+    bool Contains(const uint256& entry, bool fErase);
+
+    void Insert(const uint256& entry);
+
+private:
+    //! An empty slot has a zero first word, which entries never have
+    struct Slot {
+        std::atomic<uint64_t> words[4];
+    };
+
+    boost::scoped_array<Slot> table;
+    size_t nSlots;
+    uint256 nonce;
+    boost::mutex cs_insert;
+    unsigned int nEvict;
+    unsigned int nMaxDepth;
+
+    void GetLocations(const uint64_t words[4], size_t locations[LOCATIONS]) const;
+};
+
+/** Size the signature cache from -maxsigcachesize */
+void InitSignatureCache();
+
 class CachingTransactionSignatureChecker : public TransactionSignatureChecker
 {
 private:
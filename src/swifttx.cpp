@@ -99,6 +99,11 @@ void ProcessMessageSwiftTX(CNode* pfrom, std::string& strCommand, CDataStream& v
 
         } else {
             mapTxLockReqRejected.insert(make_pair(tx.GetHash(), tx));
+            {
+                // A block may still include it
+                LOCK(cs_main);
+                AddToCompactExtraTransactions(tx);
+            }
 
             // can we get the conflicting transaction as proof?
 
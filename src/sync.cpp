@@ -8,6 +8,7 @@
 #include "util.h"
 #include "utilstrencodings.h"
 
+#include <algorithm>
 #include <stdio.h>
 
 #include <boost/foreach.hpp>
@@ -21,6 +22,127 @@ void PrintLockContention(const char* pszName, const char* pszFile, int nLine)
 }
 #endif /* DEBUG_LOCKCONTENTION */
 
+void RecordLockContention(const char* pszName, int64_t nWaitMicros)
+{
+    // Lock names are string literals, so their address identifies them without taking the registry lock
+    static thread_local std::map<const char*, CPerfHistogram*> mapHistograms;
+    CPerfHistogram*& phistogram = mapHistograms[pszName];
+    if (!phistogram)
+        phistogram = &GetPerfHistogram(strprintf("lock.%s.wait", pszName));
+    phistogram->Record(nWaitMicros);
+}
+
+std::atomic<bool> fLockProfiling(false);
+
+class CLockSite
+{
+public:
+    std::string strName;
+    std::string strLocation;
+    CPerfCounter nContended;
+    CPerfHistogram wait;
+    CPerfHistogram hold;
+};
+
+namespace
+{
+struct LockSiteData {
+    boost::mutex cs;
+    //! By lock name and location: the same literal may live at different addresses in different translation units
+    std::map<std::pair<std::string, std::string>, CLockSite*> mapSites;
+};
+
+/** Created on first use and never freed, as lock sites are still recorded during shutdown */
+LockSiteData& GetLockSiteData()
+{
+    static LockSiteData* data = new LockSiteData();
+    return *data;
+}
+
+bool CompareLockSiteWait(const CLockSiteStats& a, const CLockSiteStats& b)
+{
+    return a.wait.nSum > b.wait.nSum;
+}
+}
+
+CLockSite* GetLockSite(const char* pszName, const char* pszFile, int nLine)
+{
+    // Names and files are string literals, so each thread can find its sites by address without taking the registry lock
+    typedef std::pair<std::pair<const char*, const char*>, int> SiteKey;
+    static thread_local std::map<SiteKey, CLockSite*> mapThreadSites;
+    CLockSite*& psite = mapThreadSites[std::make_pair(std::make_pair(pszName, pszFile), nLine)];
+    if (psite)
+        return psite;
+
+    LockSiteData& data = GetLockSiteData();
+    std::string strLocation = strprintf("%s:%d", pszFile, nLine);
+    boost::mutex::scoped_lock lock(data.cs);
+    CLockSite*& psiteShared = data.mapSites[std::make_pair(std::string(pszName), strLocation)];
+    if (!psiteShared) {
+        psiteShared = new CLockSite();
+        psiteShared->strName = pszName;
+        psiteShared->strLocation = strLocation;
+    }
+    psite = psiteShared;
+    return psite;
+}
+
+void RecordLockAcquired(CLockSite* psite, int64_t nWaitMicros, bool fContended)
+{
+    if (fContended)
+        psite->nContended.Add();
+    psite->wait.Record(nWaitMicros);
+}
+
+void RecordLockReleased(CLockSite* psite, int64_t nHoldMicros)
+{
+    psite->hold.Record(nHoldMicros);
+}
+
+void GetLockSiteStats(std::vector<CLockSiteStats>& vStats)
+{
+    LockSiteData& data = GetLockSiteData();
+    {
+        boost::mutex::scoped_lock lock(data.cs);
+        vStats.reserve(data.mapSites.size());
+        for (std::map<std::pair<std::string, std::string>, CLockSite*>::const_iterator it = data.mapSites.begin(); it != data.mapSites.end(); ++it) {
+            CLockSiteStats stats;
+            stats.strName = it->second->strName;
+            stats.strLocation = it->second->strLocation;
+            stats.nContended = it->second->nContended.Get();
+            stats.wait = it->second->wait.GetStats();
+            stats.hold = it->second->hold.GetStats();
+            vStats.push_back(stats);
+        }
+    }
+    std::sort(vStats.begin(), vStats.end(), CompareLockSiteWait);
+}
+
+void ResetLockSiteStats()
+{
+    LockSiteData& data = GetLockSiteData();
+    boost::mutex::scoped_lock lock(data.cs);
+    for (std::map<std::pair<std::string, std::string>, CLockSite*>::iterator it = data.mapSites.begin(); it != data.mapSites.end(); ++it) {
+        it->second->nContended.Reset();
+        it->second->wait.Reset();
+        it->second->hold.Reset();
+    }
+}
+
+void LogLockSiteStats(unsigned int nMaxSites)
+{
+    std::vector<CLockSiteStats> vStats;
+    GetLockSiteStats(vStats);
+    LogPrintf("Lock profile: %u call sites, most waited on first\n", vStats.size());
+    for (unsigned int i = 0; i < vStats.size() && i < nMaxSites; i++) {
+        const CLockSiteStats& stats = vStats[i];
+        LogPrintf("  %s at %s: %u locks, %u contended, waited %.2fms (max %.2fms), held %.2fms (p99 %.2fms, max %.2fms)\n",
+            stats.strName, stats.strLocation, stats.wait.nCount, stats.nContended,
+            stats.wait.nSum * 0.001, stats.wait.nMax * 0.001,
+            stats.hold.nSum * 0.001, stats.hold.nP99 * 0.001, stats.hold.nMax * 0.001);
+    }
+}
+
 #ifdef DEBUG_LOCKORDER
 //
 // Early deadlock detection.
@@ -7,8 +7,13 @@
 #ifndef BITCOIN_SYNC_H
 #define BITCOIN_SYNC_H
 
+#include "perfstats.h"
 #include "threadsafety.h"
 
+#include <atomic>
+#include <string>
+#include <vector>
+
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
@@ -108,24 +113,72 @@ typedef boost::condition_variable CConditionVariable;
 void PrintLockContention(const char* pszName, const char* pszFile, int nLine);
 #endif
 
+/** Account a wait for a contended lock in the "lock.<name>.wait" perf histogram */
+void RecordLockContention(const char* pszName, int64_t nWaitMicros);
+
+/** Default for -lockprofileinterval, in seconds */
+static const int64_t DEFAULT_LOCKPROFILE_INTERVAL = 600;
+
+/**
+ * Set by -lockprofile: every LOCK and TRY_LOCK is accounted to its call site,
+ * with the time spent waiting for the lock and the time it was then held.
+ * When unset, taking a lock costs one extra relaxed load.
+ */
+extern std::atomic<bool> fLockProfiling;
+
+class CLockSite;
+CLockSite* GetLockSite(const char* pszName, const char* pszFile, int nLine);
+void RecordLockAcquired(CLockSite* psite, int64_t nWaitMicros, bool fContended);
+void RecordLockReleased(CLockSite* psite, int64_t nHoldMicros);
+
+struct CLockSiteStats {
+    std::string strName;
+    std::string strLocation;
+    uint64_t nContended;
+    CPerfHistogramStats wait;
+    CPerfHistogramStats hold;
+
+    CLockSiteStats() : nContended(0) {}
+};
+
+/** The profiled call sites, most waited on first */
+void GetLockSiteStats(std::vector<CLockSiteStats>& vStats);
+void ResetLockSiteStats();
+/** Log the nMaxSites call sites with the longest total wait */
+void LogLockSiteStats(unsigned int nMaxSites);
+
 /** Wrapper around boost::unique_lock<CCriticalSection> */
 template <typename Mutex>
 class SCOPED_LOCKABLE CMutexLock
 {
 private:
     boost::unique_lock<Mutex> lock;
+    CLockSite* plocksite;
+    int64_t nLockedSince;
+
+    void Profile(const char* pszName, const char* pszFile, int nLine, int64_t nWaitMicros, bool fContended)
+    {
+        plocksite = GetLockSite(pszName, pszFile, nLine);
+        RecordLockAcquired(plocksite, nWaitMicros, fContended);
+        nLockedSince = GetPerfMicros();
+    }
 
     void Enter(const char* pszName, const char* pszFile, int nLine)
     {
         EnterCritical(pszName, pszFile, nLine, (void*)(lock.mutex()));
+        int64_t nWaitMicros = 0;
+        bool fContended = !lock.try_lock();
+        if (fContended) {
 #ifdef DEBUG_LOCKCONTENTION
-        if (!lock.try_lock()) {
             PrintLockContention(pszName, pszFile, nLine);
 #endif
+            int64_t nWaitStart = GetPerfMicros();
             lock.lock();
-#ifdef DEBUG_LOCKCONTENTION
+            nWaitMicros = GetPerfMicros() - nWaitStart;
+            RecordLockContention(pszName, nWaitMicros);
         }
-#endif
+        if (fLockProfiling.load(std::memory_order_relaxed))
+            Profile(pszName, pszFile, nLine, nWaitMicros, fContended);
     }
 
     bool TryEnter(const char* pszName, const char* pszFile, int nLine)
@@ -134,11 +187,13 @@ private:
         lock.try_lock();
         if (!lock.owns_lock())
             LeaveCritical();
+        else if (fLockProfiling.load(std::memory_order_relaxed))
+            Profile(pszName, pszFile, nLine, 0, false);
         return lock.owns_lock();
     }
 
 public:
-    CMutexLock(Mutex& mutexIn, const char* pszName, const char* pszFile, int nLine, bool fTry = false) EXCLUSIVE_LOCK_FUNCTION(mutexIn) : lock(mutexIn, boost::defer_lock)
+    CMutexLock(Mutex& mutexIn, const char* pszName, const char* pszFile, int nLine, bool fTry = false) EXCLUSIVE_LOCK_FUNCTION(mutexIn) : lock(mutexIn, boost::defer_lock), plocksite(NULL), nLockedSince(0)
     {
         if (fTry)
             TryEnter(pszName, pszFile, nLine);
@@ -146,7 +201,7 @@ public:
             Enter(pszName, pszFile, nLine);
     }
 
-    CMutexLock(Mutex* pmutexIn, const char* pszName, const char* pszFile, int nLine, bool fTry = false) EXCLUSIVE_LOCK_FUNCTION(pmutexIn)
+    CMutexLock(Mutex* pmutexIn, const char* pszName, const char* pszFile, int nLine, bool fTry = false) EXCLUSIVE_LOCK_FUNCTION(pmutexIn) : plocksite(NULL), nLockedSince(0)
     {
         if (!pmutexIn) return;
 
@@ -159,8 +214,11 @@ public:
 
     ~CMutexLock() UNLOCK_FUNCTION()
     {
-        if (lock.owns_lock())
+        if (lock.owns_lock()) {
+            if (plocksite)
+                RecordLockReleased(plocksite, GetPerfMicros() - nLockedSince);
             LeaveCritical();
+        }
     }
 
     operator bool()
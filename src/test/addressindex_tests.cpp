@@ -0,0 +1,87 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "addressindex.h"
+
+#include "clientversion.h"
+#include "key.h"
+#include "script/standard.h"
+#include "streams.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(addressindex_tests)
+
+BOOST_AUTO_TEST_CASE(addressindex_script_types)
+{
+    CKey key;
+    key.MakeNewKey(true);
+    CPubKey pubkey = key.GetPubKey();
+    CKeyID keyID = pubkey.GetID();
+
+    int nAddressType;
+    uint160 hashBytes;
+
+    BOOST_CHECK(GetAddressIndexKey(GetScriptForDestination(keyID), nAddressType, hashBytes));
+    BOOST_CHECK_EQUAL(nAddressType, ADDRESS_P2PKH);
+    BOOST_CHECK(hashBytes == keyID);
+
+    // Pay-to-pubkey outputs are indexed under the address of the key
+    hashBytes = 0;
+    BOOST_CHECK(GetAddressIndexKey(CScript() << ToByteVector(pubkey) << OP_CHECKSIG, nAddressType, hashBytes));
+    BOOST_CHECK_EQUAL(nAddressType, ADDRESS_P2PKH);
+    BOOST_CHECK(hashBytes == keyID);
+
+    CKey key2;
+    key2.MakeNewKey(false);
+    BOOST_CHECK(GetAddressIndexKey(CScript() << ToByteVector(key2.GetPubKey()) << OP_CHECKSIG, nAddressType, hashBytes));
+    BOOST_CHECK(hashBytes == key2.GetPubKey().GetID());
+
+    CScript redeem = GetScriptForMultisig(1, std::vector<CPubKey>(1, pubkey));
+    CScriptID scriptID(redeem);
+    BOOST_CHECK(GetAddressIndexKey(GetScriptForDestination(scriptID), nAddressType, hashBytes));
+    BOOST_CHECK_EQUAL(nAddressType, ADDRESS_P2SH);
+    BOOST_CHECK(hashBytes == scriptID);
+
+    BOOST_CHECK(!GetAddressIndexKey(redeem, nAddressType, hashBytes));
+    BOOST_CHECK(!GetAddressIndexKey(CScript() << OP_RETURN << std::vector<unsigned char>(20, 1), nAddressType, hashBytes));
+}
+
+BOOST_AUTO_TEST_CASE(addressindex_key_order)
+{
+    // Entries of one address must sort by height, then by position in the block
+    uint160 hashBytes;
+    hashBytes.SetHex("0102030405060708090a0b0c0d0e0f1011121314");
+    CAddressIndexKey keys[] = {
+        CAddressIndexKey(ADDRESS_P2PKH, hashBytes, 255, 7, uint256(5), 0, false),
+        CAddressIndexKey(ADDRESS_P2PKH, hashBytes, 256, 1, uint256(3), 1, true),
+        CAddressIndexKey(ADDRESS_P2PKH, hashBytes, 256, 2, uint256(1), 0, false),
+        CAddressIndexKey(ADDRESS_P2PKH, hashBytes, 70000, 0, uint256(0), 0, false),
+    };
+    std::vector<std::vector<unsigned char> > vSerialized;
+    for (const CAddressIndexKey& key : keys) {
+        CDataStream ss(SER_DISK, CLIENT_VERSION);
+        ss << key;
+        BOOST_CHECK_EQUAL(ss.size(), key.GetSerializeSize(SER_DISK, CLIENT_VERSION));
+        vSerialized.push_back(std::vector<unsigned char>(ss.begin(), ss.end()));
+
+        CAddressIndexKey read;
+        ss >> read;
+        BOOST_CHECK_EQUAL(read.nBlockHeight, key.nBlockHeight);
+        BOOST_CHECK_EQUAL(read.nTxIndex, key.nTxIndex);
+        BOOST_CHECK(read.txhash == key.txhash);
+        BOOST_CHECK_EQUAL(read.fSpending, key.fSpending);
+    }
+    for (unsigned int i = 1; i < vSerialized.size(); i++)
+        BOOST_CHECK(vSerialized[i - 1] < vSerialized[i]);
+
+    // The iterator prefix of an address starts every key of that address
+    CDataStream ssPrefix(SER_DISK, CLIENT_VERSION);
+    ssPrefix << CAddressIndexIteratorKey(ADDRESS_P2PKH, hashBytes, 256);
+    std::vector<unsigned char> vPrefix(ssPrefix.begin(), ssPrefix.end());
+    BOOST_CHECK(std::equal(vPrefix.begin(), vPrefix.end(), vSerialized[1].begin()));
+    BOOST_CHECK(vSerialized[0] < vPrefix);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
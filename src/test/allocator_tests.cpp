@@ -6,6 +6,9 @@
 
 #include "allocators.h"
 
+#include <map>
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 
 BOOST_AUTO_TEST_SUITE(allocator_tests)
@@ -116,4 +119,59 @@ BOOST_AUTO_TEST_CASE(test_LockedPageManagerBase)
     BOOST_CHECK((last_unlock_len & (test_page_size-1)) == 0); // always unlock entire pages
 }
 
+BOOST_AUTO_TEST_CASE(pool_resource)
+{
+    CPoolResource pool;
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(), 0U);
+
+    // Freed blocks are handed out again for the same size
+    void* p1 = pool.Allocate(40);
+    void* p2 = pool.Allocate(40);
+    BOOST_CHECK(p1 != p2);
+    BOOST_CHECK_EQUAL(reinterpret_cast<size_t>(p1) % CPoolResource::BLOCK_ALIGN, 0U);
+    pool.Deallocate(p1, 40);
+    BOOST_CHECK(pool.Allocate(33) == p1);
+    size_t nUsage = pool.DynamicMemoryUsage();
+    BOOST_CHECK(nUsage >= CPoolResource::MIN_CHUNK_SIZE);
+
+    // Large blocks are counted but not pooled
+    void* pLarge = pool.Allocate(CPoolResource::MAX_BLOCK_SIZE + 1);
+    BOOST_CHECK(pool.DynamicMemoryUsage() > nUsage + CPoolResource::MAX_BLOCK_SIZE);
+    pool.Deallocate(pLarge, CPoolResource::MAX_BLOCK_SIZE + 1);
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(), nUsage);
+
+    // Chunks are only released once every block is back
+    std::vector<void*> vBlocks;
+    for (int i = 0; i < 10000; i++)
+        vBlocks.push_back(pool.Allocate(8 + i % 200));
+    pool.Release();
+    BOOST_CHECK(pool.DynamicMemoryUsage() > nUsage);
+    for (int i = 0; i < 10000; i++)
+        pool.Deallocate(vBlocks[i], 8 + i % 200);
+    pool.Deallocate(p1, 33);
+    pool.Deallocate(p2, 40);
+    pool.Release();
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(pool_allocator_map)
+{
+    CPoolResource pool;
+    typedef std::map<int, int, std::less<int>, pool_allocator<std::pair<const int, int> > > PoolMap;
+    {
+        PoolMap map((std::less<int>()), PoolMap::allocator_type(&pool));
+        for (int i = 0; i < 1000; i++)
+            map[i] = i;
+        BOOST_CHECK(pool.DynamicMemoryUsage() >= 1000 * sizeof(std::pair<const int, int>));
+        map.clear();
+        size_t nUsage = pool.DynamicMemoryUsage();
+        for (int i = 0; i < 1000; i++)
+            map[i] = i;
+        // The nodes freed by clear() are reused
+        BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(), nUsage);
+    }
+    pool.Release();
+    BOOST_CHECK_EQUAL(pool.DynamicMemoryUsage(), 0U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockcache.h"
+
+#include "clientversion.h"
+#include "streams.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(blockcache_tests)
+
+static CBlock MakeBlock(uint32_t nNonce)
+{
+    CBlock block;
+    block.nVersion = 4;
+    block.nNonce = nNonce;
+    block.vtx.resize(1);
+    return block;
+}
+
+BOOST_AUTO_TEST_CASE(blockcache_lru)
+{
+    CBlockFileCache cache;
+    cache.SetMaxSize(4000);
+
+    CBlock block;
+    BOOST_CHECK(!cache.Lookup(CDiskBlockPos(0, 8), block));
+
+    // Each entry takes a quarter of the budget at most
+    for (unsigned int i = 0; i < 4; i++)
+        cache.Insert(CDiskBlockPos(0, 8 + i * 1000), MakeBlock(i), 1000);
+    BOOST_CHECK_EQUAL(cache.GetStats().nEntries, 4U);
+
+    // Touch the oldest entry so the second one is evicted next
+    BOOST_CHECK(cache.Lookup(CDiskBlockPos(0, 8), block));
+    BOOST_CHECK_EQUAL(block.nNonce, 0U);
+    cache.Insert(CDiskBlockPos(1, 8), MakeBlock(4), 1000);
+    BOOST_CHECK(cache.Lookup(CDiskBlockPos(0, 8), block));
+    BOOST_CHECK(!cache.Lookup(CDiskBlockPos(0, 1008), block));
+    BOOST_CHECK(cache.Lookup(CDiskBlockPos(1, 8), block));
+    BOOST_CHECK_EQUAL(block.nNonce, 4U);
+
+    // Oversized blocks are not cached
+    cache.Insert(CDiskBlockPos(2, 8), MakeBlock(5), 1001);
+    BOOST_CHECK(!cache.Lookup(CDiskBlockPos(2, 8), block));
+
+    CBlockCacheStats stats = cache.GetStats();
+    BOOST_CHECK_EQUAL(stats.nHits, 3U);
+    BOOST_CHECK_EQUAL(stats.nMisses, 3U);
+    BOOST_CHECK_EQUAL(stats.nCacheBytes, 4000U);
+
+    cache.SetMaxSize(0);
+    BOOST_CHECK_EQUAL(cache.GetStats().nEntries, 0U);
+    cache.Insert(CDiskBlockPos(0, 8), MakeBlock(0), 1);
+    BOOST_CHECK(!cache.Lookup(CDiskBlockPos(0, 8), block));
+    // A disabled cache does not count misses
+    BOOST_CHECK_EQUAL(cache.GetStats().nMisses, 3U);
+}
+
+BOOST_AUTO_TEST_CASE(memory_reader)
+{
+    CBlock block = MakeBlock(42);
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << block;
+
+    std::vector<char> vch(ss.begin(), ss.end());
+    CMemoryReader reader(&vch[0], &vch[0] + vch.size(), SER_DISK, CLIENT_VERSION);
+    CBlock blockRead;
+    reader >> blockRead;
+    BOOST_CHECK(blockRead.GetHash() == block.GetHash());
+    BOOST_CHECK_EQUAL(reader.size(), 0U);
+    BOOST_CHECK_THROW(reader >> blockRead, std::ios_base::failure);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
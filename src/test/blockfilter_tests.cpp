@@ -0,0 +1,123 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockfilter.h"
+
+#include "clientversion.h"
+#include "key.h"
+#include "primitives/block.h"
+#include "random.h"
+#include "script/standard.h"
+#include "streams.h"
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(blockfilter_tests)
+
+BOOST_AUTO_TEST_CASE(gcsfilter_test)
+{
+    GCSFilter::ElementSet included, excluded;
+    for (int i = 0; i < 100; i++) {
+        GCSFilter::Element element1(32, 0);
+        element1[0] = i;
+        included.insert(element1);
+
+        GCSFilter::Element element2(32, 1);
+        element2[1] = i;
+        excluded.insert(element2);
+    }
+
+    GCSFilter filter(0, 0, included);
+    BOOST_CHECK_EQUAL(filter.GetN(), 100U);
+    for (GCSFilter::ElementSet::const_iterator it = included.begin(); it != included.end(); ++it)
+        BOOST_CHECK(filter.Match(*it));
+    BOOST_CHECK(!filter.MatchAny(excluded));
+    GCSFilter::ElementSet query = excluded;
+    query.insert(*included.rbegin());
+    BOOST_CHECK(filter.MatchAny(query));
+
+    // A decoded filter matches the same set
+    GCSFilter filter2(0, 0, filter.GetEncoded());
+    BOOST_CHECK_EQUAL(filter2.GetN(), 100U);
+    BOOST_CHECK(filter2.MatchAny(included));
+
+    // Truncated or padded encodings are rejected
+    std::vector<unsigned char> vchTruncated(filter.GetEncoded().begin(), filter.GetEncoded().end() - 1);
+    BOOST_CHECK_THROW(GCSFilter(0, 0, vchTruncated), std::ios_base::failure);
+    std::vector<unsigned char> vchPadded = filter.GetEncoded();
+    vchPadded.push_back(0);
+    BOOST_CHECK_THROW(GCSFilter(0, 0, vchPadded), std::ios_base::failure);
+
+    GCSFilter empty(1, 2);
+    BOOST_CHECK_EQUAL(empty.GetN(), 0U);
+    BOOST_CHECK(!empty.MatchAny(included));
+    BOOST_CHECK_EQUAL(GCSFilter(1, 2, empty.GetEncoded()).GetN(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(gcsfilter_false_positives)
+{
+    // With M = 784931, random queries should almost never match
+    GCSFilter::ElementSet elements;
+    for (int i = 0; i < 1000; i++) {
+        uint256 hash = GetRandHash();
+        elements.insert(GCSFilter::Element(hash.begin(), hash.end()));
+    }
+    GCSFilter filter(GetRand(std::numeric_limits<uint64_t>::max()), GetRand(std::numeric_limits<uint64_t>::max()), elements);
+
+    int nMatches = 0;
+    for (int i = 0; i < 10000; i++) {
+        uint256 hash = GetRandHash();
+        if (filter.Match(GCSFilter::Element(hash.begin(), hash.end())))
+            nMatches++;
+    }
+    BOOST_CHECK(nMatches <= 5);
+}
+
+BOOST_AUTO_TEST_CASE(blockfilter_contents)
+{
+    CKey key1, key2;
+    key1.MakeNewKey(true);
+    key2.MakeNewKey(true);
+    CScript scriptPaid = GetScriptForDestination(key1.GetPubKey().GetID());
+    CScript scriptOther = GetScriptForDestination(key2.GetPubKey().GetID());
+
+    CMutableTransaction coinbase;
+    coinbase.vin.resize(1);
+    coinbase.vin[0].scriptSig = CScript() << OP_0 << OP_0;
+    coinbase.vout.resize(2);
+    coinbase.vout[0].scriptPubKey = scriptPaid;
+    coinbase.vout[1].scriptPubKey = CScript() << OP_RETURN << std::vector<unsigned char>(4, 1);
+
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].prevout = COutPoint(GetRandHash(), 3);
+    tx.vout.resize(1);
+    tx.vout[0].scriptPubKey = scriptPaid;
+
+    CBlock block;
+    block.vtx.push_back(coinbase);
+    block.vtx.push_back(tx);
+    block.hashMerkleRoot = block.BuildMerkleTree();
+
+    CBlockFilter blockFilter(block);
+    BOOST_CHECK(blockFilter.GetBlockHash() == block.GetHash());
+    // The script paid twice counts once, the OP_RETURN output and the coinbase input not at all
+    BOOST_CHECK_EQUAL(blockFilter.GetFilter().GetN(), 2U);
+    BOOST_CHECK(blockFilter.GetFilter().Match(BlockFilterElement(scriptPaid)));
+    BOOST_CHECK(blockFilter.GetFilter().Match(BlockFilterElement(tx.vin[0].prevout)));
+    BOOST_CHECK(!blockFilter.GetFilter().Match(BlockFilterElement(scriptOther)));
+
+    // Round trip through the on-disk format
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << blockFilter;
+    CBlockFilter blockFilter2;
+    ss >> blockFilter2;
+    BOOST_CHECK(blockFilter2.GetBlockHash() == blockFilter.GetBlockHash());
+    BOOST_CHECK(blockFilter2.GetFilter().GetEncoded() == blockFilter.GetFilter().GetEncoded());
+    BOOST_CHECK(blockFilter2.GetFilter().Match(BlockFilterElement(scriptPaid)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
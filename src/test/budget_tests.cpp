@@ -2,7 +2,9 @@
 // Distributed under the MIT/X11 software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
+#include "clientversion.h"
 #include "masternode-budget.h"
+#include "masternodeman.h"
 #include "tinyformat.h"
 #include "utilmoneystr.h"
 
@@ -29,4 +31,93 @@ BOOST_AUTO_TEST_CASE(budget_value)
     CheckBudgetValue(nHeightTest, "mainnet", 43200*COIN);
 }
 
+BOOST_AUTO_TEST_CASE(budget_collateral_outputs)
+{
+    uint256 hashProposal(0x1234);
+    CMutableTransaction tx;
+    tx.vout.resize(3);
+    tx.vout[0].scriptPubKey = CScript() << OP_DUP << OP_HASH160 << std::vector<unsigned char>(20, 1) << OP_EQUALVERIFY << OP_CHECKSIG;
+    tx.vout[0].nValue = 10 * COIN;
+    tx.vout[1].scriptPubKey = CScript() << OP_RETURN << ToByteVector(hashProposal);
+    tx.vout[1].nValue = PROPOSAL_FEE_TX;
+    tx.vout[2].scriptPubKey = CScript() << OP_RETURN << ToByteVector(uint256(0x5678));
+    tx.vout[2].nValue = BUDGET_FEE_TX - 1;
+
+    CBudgetCollateral collateral(tx, NULL);
+    BOOST_CHECK(collateral.fStandard);
+    BOOST_REQUIRE_EQUAL(collateral.vFees.size(), 1U);
+    BOOST_CHECK(collateral.vFees[0].first == hashProposal);
+    BOOST_CHECK_EQUAL(collateral.vFees[0].second, PROPOSAL_FEE_TX);
+
+    tx.nLockTime = 1;
+    BOOST_CHECK(!CBudgetCollateral(tx, NULL).fStandard);
+    tx.nLockTime = 0;
+    tx.vout[0].scriptPubKey = CScript() << OP_TRUE;
+    BOOST_CHECK(!CBudgetCollateral(tx, NULL).fStandard);
+}
+
+static CBudgetVote MakeVote(const CTxIn& vin, int nVote, int64_t nTime)
+{
+    CBudgetVote vote(vin, uint256(1), nVote);
+    vote.nTime = nTime;
+    return vote;
+}
+
+BOOST_AUTO_TEST_CASE(budget_vote_tally)
+{
+    std::vector<CTxIn> vins;
+    for (int i = 0; i < 3; i++) {
+        CMasternode mn;
+        mn.vin = CTxIn(COutPoint(uint256(100 + i), 0));
+        BOOST_CHECK(mnodeman.Add(mn));
+        vins.push_back(mn.vin);
+    }
+    CTxIn vinUnknown(COutPoint(uint256(200), 0));
+
+    CBudgetProposal proposal;
+    std::string strError;
+    int64_t nTime = GetTime() - 2 * BUDGET_VOTE_UPDATE_MIN;
+    CBudgetVote vote = MakeVote(vins[0], VOTE_YES, nTime);
+    BOOST_CHECK(proposal.AddOrUpdateVote(vote, strError));
+    vote = MakeVote(vins[1], VOTE_YES, nTime);
+    BOOST_CHECK(proposal.AddOrUpdateVote(vote, strError));
+    vote = MakeVote(vins[2], VOTE_ABSTAIN, nTime);
+    BOOST_CHECK(proposal.AddOrUpdateVote(vote, strError));
+    vote = MakeVote(vinUnknown, VOTE_YES, nTime);
+    BOOST_CHECK(proposal.AddOrUpdateVote(vote, strError));
+    BOOST_CHECK(!proposal.mapVotes[vinUnknown.prevout.GetHash()].fValid);
+    BOOST_CHECK_EQUAL(proposal.GetYeas(), 2);
+    BOOST_CHECK_EQUAL(proposal.GetNays(), 0);
+    BOOST_CHECK_EQUAL(proposal.GetAbstains(), 1);
+
+    // Changed votes move between the tallies, too early changes are rejected
+    vote = MakeVote(vins[0], VOTE_NO, nTime + 1);
+    BOOST_CHECK(!proposal.AddOrUpdateVote(vote, strError));
+    vote = MakeVote(vins[0], VOTE_NO, GetTime());
+    BOOST_CHECK(proposal.AddOrUpdateVote(vote, strError));
+    BOOST_CHECK_EQUAL(proposal.GetYeas(), 1);
+    BOOST_CHECK_EQUAL(proposal.GetNays(), 1);
+
+    // Votes of masternodes leaving the list stop counting once the proposal is cleaned
+    proposal.CleanAndRemove(false);
+    mnodeman.Remove(vins[1]);
+    BOOST_CHECK_EQUAL(proposal.GetYeas(), 1);
+    proposal.CleanAndRemove(false);
+    BOOST_CHECK_EQUAL(proposal.GetYeas(), 0);
+    BOOST_CHECK_EQUAL(proposal.GetNays(), 1);
+    BOOST_CHECK_EQUAL(proposal.GetAbstains(), 1);
+
+    // Reloaded proposals count the votes they were saved with
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << proposal;
+    CBudgetProposal loaded;
+    ss >> loaded;
+    loaded.CleanAndRemove(false);
+    BOOST_CHECK_EQUAL(loaded.GetYeas(), proposal.GetYeas());
+    BOOST_CHECK_EQUAL(loaded.GetNays(), proposal.GetNays());
+    BOOST_CHECK_EQUAL(loaded.GetAbstains(), proposal.GetAbstains());
+
+    mnodeman.Clear();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
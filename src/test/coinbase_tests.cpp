@@ -0,0 +1,60 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "init.h"
+#include "main.h"
+#include "masternode-payments.h"
+#include "miner.h"
+#include "utilstrencodings.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(coinbase_tests)
+
+// Puts the tip height back even when a check fails part way through
+struct TipHeightRestorer {
+    int nHeight;
+    TipHeightRestorer() : nHeight(chainActive.Height()) {}
+    ~TipHeightRestorer()
+    {
+        chainActive.Tip()->nHeight = nHeight;
+        masternodePayments.Clear();
+    }
+};
+
+BOOST_AUTO_TEST_CASE(CreateNewBlock_coinbase_txid)
+{
+    CScript scriptPubKey = CScript() << ParseHex("04678afdb0fe5548271967f1a67130b7105cd6a828e03909a67962e0ea1f61deb649f6bc3f4cef38c4f35504e51ec112de5c384df7ba0b8d578a4c702b6bf11d5f") << OP_CHECKSIG;
+    CBlockTemplate *pblocktemplate;
+
+    LOCK(cs_main);
+
+    // Without a masternode to pay the coinbase value is never filled in
+    TipHeightRestorer restorer;
+    int nHeight = restorer.nHeight;
+    {
+        LOCK(cs_mapMasternodeBlocks);
+        masternodePayments.mapMasternodeBlocks[nHeight + 2].AddPayee(scriptPubKey, 1);
+        masternodePayments.mapMasternodeBlocks[nHeight + 3].AddPayee(scriptPubKey, 1);
+    }
+
+    // Two successive templates past the premine only differ in the height pushed into the coinbase scriptSig
+    chainActive.Tip()->nHeight = nHeight + 1;
+    BOOST_REQUIRE(pblocktemplate = CreateNewBlock(scriptPubKey, pwalletMain, false));
+    CTransaction txFirst = pblocktemplate->block.vtx[0];
+    delete pblocktemplate;
+    chainActive.Tip()->nHeight = nHeight + 2;
+    BOOST_REQUIRE(pblocktemplate = CreateNewBlock(scriptPubKey, pwalletMain, false));
+    CTransaction txSecond = pblocktemplate->block.vtx[0];
+    delete pblocktemplate;
+
+    BOOST_CHECK(txFirst.vout == txSecond.vout);
+    BOOST_CHECK(txFirst.vin[0].scriptSig != txSecond.vin[0].scriptSig);
+    BOOST_CHECK(txFirst.GetHash() != txSecond.GetHash());
+    // The txids must be those of the finished coinbases, not of a copy from before the scriptSig was set
+    BOOST_CHECK(txFirst.GetHash() == CMutableTransaction(txFirst).GetHash());
+    BOOST_CHECK(txSecond.GetHash() == CMutableTransaction(txSecond).GetHash());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
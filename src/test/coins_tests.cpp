@@ -4,8 +4,10 @@
 
 #include "coins.h"
 #include "random.h"
+#include "txdb.h"
 #include "uint256.h"
 
+#include <algorithm>
 #include <vector>
 #include <map>
 
@@ -175,4 +177,282 @@ BOOST_AUTO_TEST_CASE(coins_cache_simulation_test)
     BOOST_CHECK(missed_an_entry);
 }
 
+// Like coins_cache_simulation_test, but on top of the database, with single
+// outputs spent and restored, so that only the changed outputs are written back.
+BOOST_AUTO_TEST_CASE(coins_db_simulation_test)
+{
+    std::map<uint256, CCoins> result;
+
+    CBlockTreeDB blocktree(1 << 20, true);
+    CCoinsViewDB coinsdb(1 << 20, true);
+    CCoinsViewFlusher flusher(&coinsdb, &coinsdb, &blocktree);
+    std::vector<CCoinsViewCache*> stack;
+    stack.push_back(new CCoinsViewCache(&flusher));
+
+    std::vector<uint256> txids;
+    txids.resize(NUM_SIMULATION_ITERATIONS / 40);
+    for (unsigned int i = 0; i < txids.size(); i++) {
+        txids[i] = GetRandHash();
+    }
+
+    for (unsigned int i = 0; i < NUM_SIMULATION_ITERATIONS / 4; i++) {
+        {
+            uint256 txid = txids[insecure_rand() % txids.size()];
+            CCoins& coins = result[txid];
+            CCoinsModifier entry = stack.back()->ModifyCoins(txid);
+            BOOST_CHECK(coins == *entry);
+            unsigned int n = insecure_rand() % 6;
+            if (coins.IsPruned() || insecure_rand() % 20 == 0) {
+                // A new transaction, or one replacing it with other metadata
+                coins.nVersion = 1 + insecure_rand() % 2;
+                coins.nHeight = coins.IsPruned() ? insecure_rand() % 1000 : coins.nHeight + 1;
+                coins.fCoinBase = insecure_rand() % 2;
+                coins.vout.resize(1 + n);
+                for (unsigned int j = 0; j <= n; j++) {
+                    coins.vout[j].SetNull();
+                    if (insecure_rand() % 4) {
+                        coins.vout[j].nValue = insecure_rand();
+                        coins.vout[j].scriptPubKey.assign(1 + insecure_rand() % 30, (unsigned char)insecure_rand());
+                    }
+                }
+            } else if (insecure_rand() % 10 == 0) {
+                coins.Clear();
+            } else if (n < coins.vout.size() && !coins.vout[n].IsNull()) {
+                coins.Spend(n);
+            } else {
+                // Restore an output, as undoing a block does
+                if (n >= coins.vout.size())
+                    coins.vout.resize(n + 1);
+                coins.vout[n].nValue = insecure_rand();
+                coins.vout[n].scriptPubKey.assign(1 + insecure_rand() % 30, (unsigned char)insecure_rand());
+            }
+            *entry = coins;
+            coins.Cleanup();
+        }
+
+        if (insecure_rand() % 100 == 0) {
+            if (insecure_rand() % 2 == 0) {
+                stack.back()->Flush();
+                delete stack.back();
+                stack.pop_back();
+            }
+            if (stack.size() == 0 || (stack.size() < 3 && insecure_rand() % 2))
+                stack.push_back(new CCoinsViewCache(stack.empty() ? static_cast<CCoinsView*>(&flusher) : stack.back()));
+        }
+    }
+
+    while (stack.size() > 0) {
+        stack.back()->Flush();
+        delete stack.back();
+        stack.pop_back();
+    }
+    BOOST_CHECK(flusher.Wait());
+
+    // The database holds exactly the unspent outputs
+    for (std::map<uint256, CCoins>::iterator it = result.begin(); it != result.end(); it++) {
+        CCoins coins;
+        if (it->second.IsPruned()) {
+            BOOST_CHECK(!coinsdb.GetCoins(it->first, coins));
+            BOOST_CHECK(!coinsdb.HaveCoins(it->first));
+        } else {
+            BOOST_CHECK(coinsdb.GetCoins(it->first, coins));
+            BOOST_CHECK(coinsdb.HaveCoins(it->first));
+            BOOST_CHECK(coins == it->second);
+        }
+    }
+}
+
+class CCoinsViewDBOld : public CCoinsViewDB
+{
+public:
+    CCoinsViewDBOld() : CCoinsViewDB(1 << 20, true) {}
+
+    void WriteOld(const uint256& txid, const CCoins& coins) { db.Write(std::make_pair('c', txid), coins); }
+    bool HaveOld(const uint256& txid) const { return db.Exists(std::make_pair('c', txid)); }
+};
+
+BOOST_AUTO_TEST_CASE(coins_db_upgrade_test)
+{
+    CCoinsViewDBOld coinsdb;
+    std::map<uint256, CCoins> result;
+    for (int i = 0; i < 1000; i++) {
+        CCoins coins;
+        coins.nVersion = 1;
+        coins.nHeight = i;
+        coins.fCoinStake = i % 2;
+        coins.vout.resize(1 + i % 3);
+        for (unsigned int j = 0; j < coins.vout.size(); j++) {
+            coins.vout[j].nValue = i * 3 + j;
+            coins.vout[j].scriptPubKey.assign(25, (unsigned char)j);
+        }
+        if (coins.vout.size() > 1)
+            coins.vout[0].SetNull();
+        uint256 txid = GetRandHash();
+        coinsdb.WriteOld(txid, coins);
+        result[txid] = coins;
+    }
+
+    BOOST_CHECK(coinsdb.Upgrade());
+    for (std::map<uint256, CCoins>::iterator it = result.begin(); it != result.end(); it++) {
+        BOOST_CHECK(!coinsdb.HaveOld(it->first));
+        CCoins coins;
+        BOOST_CHECK(coinsdb.GetCoins(it->first, coins));
+        BOOST_CHECK(coins == it->second);
+    }
+    // Nothing is left to do the second time
+    BOOST_CHECK(coinsdb.Upgrade());
+}
+
+static bool CompareTxidKeys(const uint256& a, const uint256& b)
+{
+    return memcmp(a.begin(), b.begin(), 32) < 0;
+}
+
+BOOST_AUTO_TEST_CASE(coins_db_stats_test)
+{
+    CCoinsViewDB coinsdb(1 << 20, true);
+    std::map<uint256, CCoins> result;
+    {
+        CCoinsViewCache cache(&coinsdb);
+        for (int i = 0; i < 2000; i++) {
+            uint256 txid = GetRandHash();
+            CCoinsModifier coins = cache.ModifyCoins(txid);
+            coins->nVersion = 1;
+            coins->nHeight = i;
+            coins->fCoinBase = i % 7 == 0;
+            coins->vout.resize(1 + i % 4);
+            for (unsigned int j = 0; j < coins->vout.size(); j++) {
+                coins->vout[j].nValue = i + j;
+                coins->vout[j].scriptPubKey.assign(20 + j, (unsigned char)i);
+            }
+            coins->vout[0].SetNull();
+            if (!coins->IsPruned())
+                result[txid] = *coins;
+        }
+        cache.SetBestBlock(GetRandHash());
+        BOOST_CHECK(cache.Flush());
+    }
+
+    // The same hash as a single pass over the outputs in key order
+    std::vector<uint256> txids;
+    for (std::map<uint256, CCoins>::iterator it = result.begin(); it != result.end(); it++)
+        txids.push_back(it->first);
+    std::sort(txids.begin(), txids.end(), CompareTxidKeys);
+    CHashWriter ss(SER_GETHASH, PROTOCOL_VERSION);
+    ss << coinsdb.GetBestBlock();
+    uint64_t nOutputs = 0;
+    CAmount nTotalAmount = 0;
+    for (unsigned int i = 0; i < txids.size(); i++) {
+        CCoins& coins = result[txids[i]];
+        coins.Cleanup();
+        ss << txids[i] << VARINT(coins.nVersion) << (coins.fCoinBase ? 'c' : 'n') << VARINT(coins.nHeight);
+        for (unsigned int j = 0; j < coins.vout.size(); j++) {
+            if (!coins.vout[j].IsNull()) {
+                ss << VARINT(j + 1) << coins.vout[j];
+                nOutputs++;
+                nTotalAmount += coins.vout[j].nValue;
+            }
+        }
+        ss << VARINT(0);
+    }
+
+    CCoinsStats stats;
+    BOOST_CHECK(coinsdb.GetStats(stats));
+    BOOST_CHECK(stats.hashBlock == coinsdb.GetBestBlock());
+    BOOST_CHECK_EQUAL(stats.nTransactions, txids.size());
+    BOOST_CHECK_EQUAL(stats.nTransactionOutputs, nOutputs);
+    BOOST_CHECK_EQUAL(stats.nTotalAmount, nTotalAmount);
+    BOOST_CHECK(stats.hashSerialized == ss.GetHash());
+
+    // Served from the cache while the best block is the same
+    CCoinsStats stats2;
+    BOOST_CHECK(coinsdb.GetStats(stats2));
+    BOOST_CHECK(stats2.hashSerialized == stats.hashSerialized);
+    BOOST_CHECK_EQUAL(stats2.nSerializedSize, stats.nSerializedSize);
+}
+
+BOOST_AUTO_TEST_CASE(coins_cache_usage_test)
+{
+    CCoinsViewTest base;
+    CCoinsViewCache cache(&base);
+    BOOST_CHECK_EQUAL(cache.DynamicMemoryUsage(), 0U);
+
+    std::vector<uint256> txids;
+    for (int i = 0; i < 1000; i++) {
+        txids.push_back(GetRandHash());
+        CCoinsModifier coins = cache.ModifyCoins(txids.back());
+        coins->vout.resize(2);
+        coins->vout[0].nValue = 1;
+        coins->vout[0].scriptPubKey.assign(25, 0x76);
+    }
+    // At least the outputs and scripts are counted, and the nodes on top
+    size_t nUsage = cache.DynamicMemoryUsage();
+    BOOST_CHECK(nUsage > 1000 * (2 * sizeof(CTxOut) + 25));
+
+    // Spending everything gives the script memory back
+    for (int i = 0; i < 1000; i++)
+        cache.ModifyCoins(txids[i])->Clear();
+    BOOST_CHECK(cache.DynamicMemoryUsage() < nUsage);
+
+    BOOST_CHECK(cache.Flush());
+    BOOST_CHECK_EQUAL(cache.DynamicMemoryUsage(), 0U);
+    BOOST_CHECK_EQUAL(cache.GetCacheSize(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(coins_flusher_test)
+{
+    CBlockTreeDB blocktree(1 << 20, true);
+    CCoinsViewDB coinsdb(1 << 20, true);
+    CCoinsViewFlusher flusher(&coinsdb, &coinsdb, &blocktree);
+    CCoinsViewCache cache(&flusher);
+
+    uint256 txid1 = GetRandHash(), txid2 = GetRandHash(), hashBest = GetRandHash();
+    {
+        CCoinsModifier coins = cache.ModifyCoins(txid1);
+        coins->vout.resize(1);
+        coins->vout[0].nValue = 1;
+    }
+    {
+        CCoinsModifier coins = cache.ModifyCoins(txid2);
+        coins->vout.resize(2);
+        coins->vout[1].nValue = 2;
+    }
+    cache.SetBestBlock(hashBest);
+
+    std::vector<std::pair<int, CBlockFileInfo> > vFileInfo;
+    CBlockFileInfo info;
+    info.nBlocks = 7;
+    vFileInfo.push_back(std::make_pair(3, info));
+    flusher.QueueBlockIndex(vFileInfo, 3, std::vector<CDiskBlockIndex>());
+    BOOST_CHECK(cache.Flush());
+
+    // Whether or not the write is done, the flushed state reads the same
+    CCoinsViewCache cache2(&flusher);
+    BOOST_CHECK(cache2.HaveCoins(txid1));
+    BOOST_CHECK(cache2.AccessCoins(txid2)->vout[1].nValue == 2);
+    BOOST_CHECK(flusher.GetBestBlock() == hashBest);
+
+    BOOST_CHECK(flusher.Wait());
+    BOOST_CHECK(coinsdb.HaveCoins(txid1));
+    BOOST_CHECK(coinsdb.GetBestBlock() == hashBest);
+    int nLastFile = 0;
+    BOOST_CHECK(blocktree.ReadLastBlockFile(nLastFile) && nLastFile == 3);
+    CBlockFileInfo infoRead;
+    BOOST_CHECK(blocktree.ReadBlockFileInfo(3, infoRead) && infoRead.nBlocks == 7);
+
+    // A spent entry is gone from the view right away and from the database after the write
+    cache.ModifyCoins(txid1)->Spend(0);
+    BOOST_CHECK(cache.Flush());
+    CCoinsViewCache cache3(&flusher);
+    BOOST_CHECK(!cache3.HaveCoins(txid1));
+    BOOST_CHECK(cache3.HaveCoins(txid2));
+
+    BOOST_CHECK(flusher.Wait());
+    BOOST_CHECK(!coinsdb.HaveCoins(txid1));
+    BOOST_CHECK(coinsdb.HaveCoins(txid2));
+    CFlushStats stats = flusher.GetFlushStats();
+    BOOST_CHECK_EQUAL(stats.nFlushes, 2U);
+    BOOST_CHECK(stats.nTotalBytes > 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -9,6 +9,7 @@
 #include "crypto/sha512.h"
 #include "crypto/hmac_sha256.h"
 #include "crypto/hmac_sha512.h"
+#include "hash.h"
 #include "random.h"
 #include "utilstrencodings.h"
 
@@ -131,6 +132,21 @@ BOOST_AUTO_TEST_CASE(sha256_testvectors) {
     TestSHA256(test1, "a316d55510b49662420f49d145d42fb83f31ef8dc016aa4e32df049991a91e26");
 }
 
+BOOST_AUTO_TEST_CASE(sha256d64)
+{
+    // Every batch size, so each of the 8-way, 4-way and single paths gets
+    // used, must match hashing the inputs one by one
+    for (int i = 0; i <= 32; i++) {
+        std::vector<unsigned char> in(64 * i), out(32 * i), expected(32 * i);
+        for (int j = 0; j < 64 * i; j++)
+            in[j] = insecure_rand();
+        for (int j = 0; j < i; j++)
+            CHash256().Write(&in[64 * j], 64).Finalize(&expected[32 * j]);
+        SHA256D64(out.data(), in.data(), i);
+        BOOST_CHECK(out == expected);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(sha512_testvectors) {
     TestSHA512("",
                "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
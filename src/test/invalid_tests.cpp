@@ -0,0 +1,42 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "invalid.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(invalid_tests)
+
+BOOST_AUTO_TEST_CASE(invalid_outpoints)
+{
+    uint256 txid("00405ad8cc4ec7b6be27dedc6bf19f2febf8e338031fe552d7bf5c0dfd6e67de");
+    BOOST_CHECK(invalid_out::ContainsOutPoint(COutPoint(txid, 0)));
+    BOOST_CHECK(!invalid_out::ContainsOutPoint(COutPoint(txid, 5)));
+    BOOST_CHECK(invalid_out::ContainsOutPoint(COutPoint(uint256("fff7164737e3437fd27b3787edeb2650eddd07966c492ffb7e0eb537c0a5b850"), 1)));
+    BOOST_CHECK(!invalid_out::ContainsOutPoint(COutPoint(uint256("fff7164737e3437fd27b3787edeb2650eddd07966c492ffb7e0eb537c0a5b851"), 1)));
+    BOOST_CHECK(!invalid_out::ContainsOutPoint(COutPoint()));
+
+    std::vector<COutPoint> vOutPoints = invalid_out::GetInvalidOutPoints();
+    BOOST_CHECK_EQUAL(vOutPoints.size(), 1695U);
+    for (std::vector<COutPoint>::const_iterator it = vOutPoints.begin(); it != vOutPoints.end(); ++it)
+        BOOST_CHECK(invalid_out::ContainsOutPoint(*it));
+}
+
+BOOST_AUTO_TEST_CASE(invalid_serials)
+{
+    CBigNum bnSerial;
+    bnSerial.SetHex("c9c868bb56eacfc4f3d829528a0ae812dff26619cd38e6c9a0eea1eacddc84");
+    BOOST_CHECK(invalid_out::ContainsSerial(bnSerial));
+    BOOST_CHECK(!invalid_out::ContainsSerial(bnSerial + 1));
+    BOOST_CHECK(!invalid_out::ContainsSerial(-bnSerial));
+
+    // Serials wider than 256 bits
+    bnSerial.SetHex("10003d303f592aee977bf6717af8c9603514869adbbbc277f0296dff12e1f1274");
+    BOOST_CHECK(invalid_out::ContainsSerial(bnSerial));
+    bnSerial.SetHex("198b62253217000fbab79bfe4bc4189c17c083ccab115866f16bf803946627107");
+    BOOST_CHECK(invalid_out::ContainsSerial(bnSerial));
+    BOOST_CHECK(!invalid_out::ContainsSerial(CBigNum(0)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
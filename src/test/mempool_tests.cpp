@@ -3,6 +3,7 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "main.h"
+#include "random.h"
 #include "txmempool.h"
 #include "util.h"
 
@@ -99,4 +100,109 @@ BOOST_AUTO_TEST_CASE(MempoolRemoveTest)
     removed.clear();
 }
 
+static CMutableTransaction MakeTx(const uint256& hashPrev, uint32_t nPrev, CAmount nValue)
+{
+    CMutableTransaction tx;
+    tx.vin.resize(1);
+    tx.vin[0].scriptSig = CScript() << OP_11;
+    tx.vin[0].prevout.hash = hashPrev;
+    tx.vin[0].prevout.n = nPrev;
+    tx.vout.resize(1);
+    tx.vout[0].scriptPubKey = CScript() << OP_11 << OP_EQUAL;
+    tx.vout[0].nValue = nValue;
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(MempoolAncestorStateTest)
+{
+    CTxMemPool pool(CFeeRate(0));
+
+    // Parent -> child -> grandchild, with fees 1000, 2000 and 3000
+    CMutableTransaction txParent = MakeTx(GetRandHash(), 0, 10 * COIN);
+    CMutableTransaction txChild = MakeTx(txParent.GetHash(), 0, 9 * COIN);
+    CMutableTransaction txGrandChild = MakeTx(txChild.GetHash(), 0, 8 * COIN);
+    pool.addUnchecked(txParent.GetHash(), CTxMemPoolEntry(txParent, 1000, 0, 0.0, 1));
+    pool.addUnchecked(txChild.GetHash(), CTxMemPoolEntry(txChild, 2000, 0, 0.0, 1));
+    pool.addUnchecked(txGrandChild.GetHash(), CTxMemPoolEntry(txGrandChild, 3000, 0, 0.0, 1));
+
+    CTxMemPool::txiter itParent = pool.mapTx.find(txParent.GetHash());
+    CTxMemPool::txiter itChild = pool.mapTx.find(txChild.GetHash());
+    CTxMemPool::txiter itGrandChild = pool.mapTx.find(txGrandChild.GetHash());
+    BOOST_CHECK_EQUAL(itParent->GetCountWithDescendants(), 3U);
+    BOOST_CHECK_EQUAL(itParent->GetModFeesWithDescendants(), 6000);
+    BOOST_CHECK_EQUAL(itChild->GetCountWithAncestors(), 2U);
+    BOOST_CHECK_EQUAL(itGrandChild->GetCountWithAncestors(), 3U);
+    BOOST_CHECK_EQUAL(itGrandChild->GetModFeesWithAncestors(), 6000);
+    BOOST_CHECK_EQUAL(itGrandChild->GetSizeWithAncestors(), itParent->GetSizeWithDescendants());
+
+    // Prioritising a transaction shows up in the totals of its whole package
+    pool.PrioritiseTransaction(txChild.GetHash(), txChild.GetHash().ToString(), 0, 500);
+    BOOST_CHECK_EQUAL(itChild->GetModifiedFee(), 2500);
+    BOOST_CHECK_EQUAL(itParent->GetModFeesWithDescendants(), 6500);
+    BOOST_CHECK_EQUAL(itGrandChild->GetModFeesWithAncestors(), 6500);
+
+    // The parent is mined: its descendants stay, with one ancestor less
+    std::list<CTransaction> removed;
+    pool.remove(txParent, removed, false);
+    BOOST_CHECK_EQUAL(removed.size(), 1U);
+    BOOST_CHECK_EQUAL(pool.size(), 2U);
+    BOOST_CHECK_EQUAL(itChild->GetCountWithAncestors(), 1U);
+    BOOST_CHECK_EQUAL(itChild->GetModFeesWithAncestors(), 2500);
+    BOOST_CHECK_EQUAL(itGrandChild->GetCountWithAncestors(), 2U);
+    BOOST_CHECK_EQUAL(itGrandChild->GetModFeesWithAncestors(), 5500);
+    BOOST_CHECK(pool.GetMemPoolParents(itChild).empty());
+
+    // The child is removed with its descendants: nothing is left
+    removed.clear();
+    pool.remove(txChild, removed, true);
+    BOOST_CHECK_EQUAL(removed.size(), 2U);
+    BOOST_CHECK_EQUAL(pool.size(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(MempoolIndexingTest)
+{
+    CTxMemPool pool(CFeeRate(0));
+
+    // A low fee parent paid for by its child, and an independent transaction in between
+    CMutableTransaction txParent = MakeTx(GetRandHash(), 0, 10 * COIN);
+    CMutableTransaction txChild = MakeTx(txParent.GetHash(), 0, 9 * COIN);
+    CMutableTransaction txOther = MakeTx(GetRandHash(), 0, 10 * COIN);
+    pool.addUnchecked(txParent.GetHash(), CTxMemPoolEntry(txParent, 100, 0, 0.0, 1));
+    pool.addUnchecked(txChild.GetHash(), CTxMemPoolEntry(txChild, 20000, 1, 0.0, 1));
+    pool.addUnchecked(txOther.GetHash(), CTxMemPoolEntry(txOther, 5000, 2, 0.0, 1));
+
+    // Mining order: the child's package pays the most, then the other transaction
+    std::vector<uint256> vMining;
+    CTxMemPool::indexed_transaction_set::index<ancestor_score>::type::iterator ait;
+    for (ait = pool.mapTx.get<ancestor_score>().begin(); ait != pool.mapTx.get<ancestor_score>().end(); ++ait)
+        vMining.push_back(ait->GetTx().GetHash());
+    BOOST_CHECK(vMining[0] == txChild.GetHash());
+    BOOST_CHECK(vMining[1] == txOther.GetHash());
+    BOOST_CHECK(vMining[2] == txParent.GetHash());
+
+    // Eviction order: the other transaction goes first, the parent is covered by its child
+    std::vector<uint256> vEviction;
+    CTxMemPool::indexed_transaction_set::index<descendant_score>::type::iterator dit;
+    for (dit = pool.mapTx.get<descendant_score>().begin(); dit != pool.mapTx.get<descendant_score>().end(); ++dit)
+        vEviction.push_back(dit->GetTx().GetHash());
+    BOOST_CHECK(vEviction[0] == txOther.GetHash());
+
+    // Trimming evicts the lowest score and raises the minimum fee
+    size_t nUsage = pool.DynamicMemoryUsage();
+    pool.TrimToSize(nUsage - 1);
+    BOOST_CHECK_EQUAL(pool.size(), 2U);
+    BOOST_CHECK(!pool.exists(txOther.GetHash()));
+    BOOST_CHECK(pool.GetMinFee(nUsage) >= CFeeRate(5000, ::GetSerializeSize(CTransaction(txOther), SER_NETWORK, PROTOCOL_VERSION)));
+
+    // A package with a transaction to keep is left alone
+    std::set<uint256> setKeep;
+    setKeep.insert(txChild.GetHash());
+    pool.TrimToSize(1, setKeep);
+    BOOST_CHECK_EQUAL(pool.size(), 2U);
+
+    // Evicting the parent takes the child along
+    pool.TrimToSize(1);
+    BOOST_CHECK_EQUAL(pool.size(), 0U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "primitives/block.h"
+
+#include "hash.h"
+#include "random.h"
+#include "utilstrencodings.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(merkle_tests)
+
+/** The full tree, every level after the previous one, as blocks used to keep it */
+static std::vector<uint256> ReferenceMerkleTree(const CBlock& block, bool& fMutated)
+{
+    std::vector<uint256> vTree;
+    for (unsigned int i = 0; i < block.vtx.size(); i++)
+        vTree.push_back(block.vtx[i].GetHash());
+    fMutated = false;
+    int j = 0;
+    for (int nSize = block.vtx.size(); nSize > 1; nSize = (nSize + 1) / 2) {
+        if (nSize % 2 == 0 && vTree[j + nSize - 2] == vTree[j + nSize - 1])
+            fMutated = true;
+        for (int i = 0; i < nSize; i += 2) {
+            int i2 = std::min(i + 1, nSize - 1);
+            vTree.push_back(Hash(BEGIN(vTree[j + i]), END(vTree[j + i]), BEGIN(vTree[j + i2]), END(vTree[j + i2])));
+        }
+        j += nSize;
+    }
+    return vTree;
+}
+
+static std::vector<uint256> ReferenceMerkleBranch(const std::vector<uint256>& vTree, int nTx, int nIndex)
+{
+    std::vector<uint256> vBranch;
+    int j = 0;
+    for (int nSize = nTx; nSize > 1; nSize = (nSize + 1) / 2) {
+        vBranch.push_back(vTree[j + std::min(nIndex ^ 1, nSize - 1)]);
+        nIndex >>= 1;
+        j += nSize;
+    }
+    return vBranch;
+}
+
+BOOST_AUTO_TEST_CASE(merkle_root_and_branches)
+{
+    static const int sizes[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257, 1000};
+    for (unsigned int n = 0; n < sizeof(sizes) / sizeof(sizes[0]); n++) {
+        CBlock block;
+        for (int i = 0; i < sizes[n]; i++) {
+            CMutableTransaction mtx;
+            mtx.nLockTime = GetRand(0xffffffff);
+            block.vtx.push_back(CTransaction(mtx));
+        }
+
+        bool fMutated, fRefMutated;
+        std::vector<uint256> vTree = ReferenceMerkleTree(block, fRefMutated);
+        BOOST_CHECK(block.BuildMerkleTree(&fMutated) == vTree.back());
+        BOOST_CHECK_EQUAL(fMutated, fRefMutated);
+        // The result must not depend on the thread buffer left by the previous block
+        BOOST_CHECK(block.BuildMerkleTree() == vTree.back());
+
+        for (int i = 0; i < sizes[n]; i += 1 + sizes[n] / 16) {
+            std::vector<uint256> vBranch = block.GetMerkleBranch(i);
+            BOOST_CHECK(vBranch == ReferenceMerkleBranch(vTree, sizes[n], i));
+            BOOST_CHECK(CBlock::CheckMerkleBranch(block.vtx[i].GetHash(), vBranch, i) == vTree.back());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_root_mutation)
+{
+    CBlock block;
+    BOOST_CHECK(block.BuildMerkleTree() == uint256());
+
+    for (int i = 0; i < 6; i++) {
+        CMutableTransaction mtx;
+        mtx.nLockTime = i;
+        block.vtx.push_back(CTransaction(mtx));
+    }
+    bool fMutated = true;
+    uint256 root = block.BuildMerkleTree(&fMutated);
+    BOOST_CHECK(!fMutated);
+
+    // [1,2,3,4,5,6] and [1,2,3,4,5,6,5,6] share a root (CVE-2012-2459)
+    block.vtx.push_back(block.vtx[4]);
+    block.vtx.push_back(block.vtx[5]);
+    BOOST_CHECK(block.BuildMerkleTree(&fMutated) == root);
+    BOOST_CHECK(fMutated);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
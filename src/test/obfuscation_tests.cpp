@@ -0,0 +1,36 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "obfuscation.h"
+
+#include "key.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(obfuscation_tests)
+
+BOOST_AUTO_TEST_CASE(signer_verify_message)
+{
+    CKey key1, key2;
+    key1.MakeNewKey(true);
+    key2.MakeNewKey(true);
+
+    std::string strMessage = "masternode message";
+    std::string strError;
+    std::vector<unsigned char> vchSig;
+    BOOST_CHECK(obfuScationSigner.SignMessage(strMessage, strError, vchSig, key1));
+
+    // The second round hits the message signature cache and must give the same answers
+    for (int i = 0; i < 2; i++) {
+        BOOST_CHECK(obfuScationSigner.VerifyMessage(key1.GetPubKey(), vchSig, strMessage, strError));
+        BOOST_CHECK(!obfuScationSigner.VerifyMessage(key2.GetPubKey(), vchSig, strMessage, strError));
+        BOOST_CHECK(!obfuScationSigner.VerifyMessage(key1.GetPubKey(), vchSig, strMessage + " changed", strError));
+    }
+
+    std::vector<unsigned char> vchBadSig(vchSig);
+    vchBadSig.resize(64);
+    BOOST_CHECK(!obfuScationSigner.VerifyMessage(key1.GetPubKey(), vchBadSig, strMessage, strError));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
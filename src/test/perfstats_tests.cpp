@@ -0,0 +1,85 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "perfstats.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(perfstats_tests)
+
+BOOST_AUTO_TEST_CASE(perfstats_buckets)
+{
+    // Small values are exact, and every bucket holds exactly the values up to its upper bound
+    for (uint64_t n = 0; n < 16; n++)
+        BOOST_CHECK_EQUAL(CPerfHistogram::BucketIndex(n), (int)n);
+    uint64_t nPrevBound = 0;
+    for (int i = 1; i < CPerfHistogram::NUM_BUCKETS - 1; i++) {
+        uint64_t nBound = CPerfHistogram::BucketUpperBound(i);
+        BOOST_CHECK(nBound > nPrevBound);
+        BOOST_CHECK_EQUAL(CPerfHistogram::BucketIndex(nPrevBound + 1), i);
+        BOOST_CHECK_EQUAL(CPerfHistogram::BucketIndex(nBound), i);
+        BOOST_CHECK_EQUAL(CPerfHistogram::BucketIndex(nBound + 1), i + 1);
+        // Within 12.5% of any value in the bucket
+        BOOST_CHECK(nBound - nPrevBound - 1 <= (nPrevBound + 1) / 8);
+        nPrevBound = nBound;
+    }
+    BOOST_CHECK_EQUAL(CPerfHistogram::BucketIndex(~(uint64_t)0), CPerfHistogram::NUM_BUCKETS - 1);
+}
+
+BOOST_AUTO_TEST_CASE(perfstats_histogram)
+{
+    CPerfHistogram histogram;
+    BOOST_CHECK_EQUAL(histogram.GetStats().nCount, 0U);
+
+    for (int64_t n = 1; n <= 1000; n++)
+        histogram.Record(n);
+    histogram.Record(-5); // a clock step backwards counts as zero
+
+    CPerfHistogramStats stats = histogram.GetStats();
+    BOOST_CHECK_EQUAL(stats.nCount, 1001U);
+    BOOST_CHECK_EQUAL(stats.nSum, 500500U);
+    BOOST_CHECK_EQUAL(stats.nMax, 1000U);
+    BOOST_CHECK(stats.nP50 >= 500 && stats.nP50 <= 500 * 9 / 8);
+    BOOST_CHECK(stats.nP90 >= 900 && stats.nP90 <= 900 * 9 / 8);
+    BOOST_CHECK(stats.nP99 >= 990 && stats.nP99 <= 1000);
+
+    histogram.Reset();
+    stats = histogram.GetStats();
+    BOOST_CHECK_EQUAL(stats.nCount, 0U);
+    BOOST_CHECK_EQUAL(stats.nMax, 0U);
+    BOOST_CHECK_EQUAL(stats.nP99, 0U);
+}
+
+BOOST_AUTO_TEST_CASE(perfstats_registry)
+{
+    CPerfCounter& counter = GetPerfCounter("perftest.counter");
+    BOOST_CHECK_EQUAL(&counter, &GetPerfCounter("perftest.counter"));
+    counter.Add(3);
+    counter.Add();
+
+    {
+        PERF_TIMER("perftest.timer");
+    }
+
+    std::map<std::string, uint64_t> mapCounters;
+    GetPerfCounters(mapCounters, "perftest.");
+    BOOST_CHECK_EQUAL(mapCounters.size(), 1U);
+    BOOST_CHECK_EQUAL(mapCounters["perftest.counter"], 4U);
+
+    std::map<std::string, CPerfHistogramStats> mapHistograms;
+    GetPerfHistograms(mapHistograms, "perftest.");
+    BOOST_CHECK_EQUAL(mapHistograms.size(), 1U);
+    BOOST_CHECK_EQUAL(mapHistograms["perftest.timer"].nCount, 1U);
+
+    std::string strPrometheus = PerfStatsToPrometheus();
+    BOOST_CHECK(strPrometheus.find("# TYPE hoolibet_perftest_counter counter\nhoolibet_perftest_counter 4\n") != std::string::npos);
+    BOOST_CHECK(strPrometheus.find("hoolibet_perftest_timer_seconds_count 1\n") != std::string::npos);
+
+    ResetPerfStats();
+    mapCounters.clear();
+    GetPerfCounters(mapCounters, "perftest.");
+    BOOST_CHECK_EQUAL(mapCounters["perftest.counter"], 0U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,65 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "pow.h"
+
+#include "hash.h"
+#include "primitives/block.h"
+#include "random.h"
+#include "utilstrencodings.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(pow_tests)
+
+static CBlockHeader RandomHeader(int nVersion)
+{
+    CBlockHeader header;
+    header.nVersion = nVersion;
+    header.hashPrevBlock = GetRandHash();
+    header.hashMerkleRoot = GetRandHash();
+    header.nTime = GetRand(0xffffffff);
+    header.nBits = 0x1e0ffff0;
+    header.nNonce = GetRand(0xffffffff);
+    header.nAccumulatorCheckpoint = GetRandHash();
+    return header;
+}
+
+BOOST_AUTO_TEST_CASE(quark_header_hash_cache)
+{
+    CBlockHeader header = RandomHeader(3);
+    uint256 hash = HashQuark(BEGIN(header.nVersion), END(header.nNonce));
+    BOOST_CHECK(header.GetHash() == hash);
+    BOOST_CHECK(header.GetHash() == hash);
+
+    // A changed field must not be answered from the last header
+    header.nNonce++;
+    uint256 hashNext = HashQuark(BEGIN(header.nVersion), END(header.nNonce));
+    BOOST_CHECK(hashNext != hash);
+    BOOST_CHECK(header.GetHash() == hashNext);
+    header.nNonce--;
+    BOOST_CHECK(header.GetHash() == hash);
+}
+
+BOOST_AUTO_TEST_CASE(block_header_hashes_batch)
+{
+    std::vector<CBlockHeader> vHeaders;
+    std::vector<uint256> vHashes;
+    GetBlockHeaderHashes(vHeaders, vHashes);
+    BOOST_CHECK(vHashes.empty());
+
+    // Enough headers to be split over threads, mixing Quark and double-SHA256 headers
+    for (int i = 0; i < 2000; i++)
+        vHeaders.push_back(RandomHeader(i % 3 == 0 ? 4 : 1));
+    GetBlockHeaderHashes(vHeaders, vHashes);
+    BOOST_REQUIRE_EQUAL(vHashes.size(), vHeaders.size());
+    for (unsigned int i = 0; i < vHeaders.size(); i++) {
+        const CBlockHeader& header = vHeaders[i];
+        uint256 hash = header.nVersion < 4 ? HashQuark(BEGIN(header.nVersion), END(header.nNonce)) :
+                                             Hash(BEGIN(header.nVersion), END(header.nAccumulatorCheckpoint));
+        BOOST_CHECK(vHashes[i] == hash);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
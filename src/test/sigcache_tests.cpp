@@ -0,0 +1,128 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "script/sigcache.h"
+
+#include "key.h"
+#include "random.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
+
+BOOST_AUTO_TEST_SUITE(sigcache_tests)
+
+BOOST_AUTO_TEST_CASE(sigcache_insert_erase)
+{
+    CSignatureCache cache;
+    BOOST_CHECK(!cache.Contains(GetRandHash(), false)); // not set up: always a miss
+    cache.Insert(GetRandHash());
+
+    BOOST_CHECK_EQUAL(cache.Setup(1 << 20), (size_t)((1 << 20) / 32));
+
+    std::vector<uint256> vEntries;
+    for (int i = 0; i < 1000; i++) {
+        vEntries.push_back(GetRandHash());
+        cache.Insert(vEntries.back());
+    }
+    for (const uint256& entry : vEntries)
+        BOOST_CHECK(cache.Contains(entry, false));
+    BOOST_CHECK(!cache.Contains(GetRandHash(), false));
+
+    // Inserting again is a no-op, erasing frees the slot
+    cache.Insert(vEntries[0]);
+    BOOST_CHECK(cache.Contains(vEntries[0], true));
+    BOOST_CHECK(!cache.Contains(vEntries[0], false));
+    BOOST_CHECK(cache.Contains(vEntries[1], false));
+}
+
+BOOST_AUTO_TEST_CASE(sigcache_entries)
+{
+    CSignatureCache cache;
+    cache.Setup(1 << 16);
+
+    CKey key;
+    key.MakeNewKey(true);
+    uint256 hash = GetRandHash();
+    std::vector<unsigned char> vchSig;
+    BOOST_CHECK(key.Sign(hash, vchSig));
+
+    // The entry covers the hash, the key and the signature
+    uint256 entry, entry2;
+    cache.ComputeEntry(entry, hash, vchSig, key.GetPubKey());
+    cache.ComputeEntry(entry2, hash, vchSig, key.GetPubKey());
+    BOOST_CHECK(entry == entry2);
+    cache.ComputeEntry(entry2, GetRandHash(), vchSig, key.GetPubKey());
+    BOOST_CHECK(entry != entry2);
+    std::vector<unsigned char> vchSig2(vchSig);
+    vchSig2.back() ^= 1;
+    cache.ComputeEntry(entry2, hash, vchSig2, key.GetPubKey());
+    BOOST_CHECK(entry != entry2);
+
+    // Each cache salts its entries
+    CSignatureCache cache2;
+    cache2.Setup(1 << 16);
+    cache2.ComputeEntry(entry2, hash, vchSig, key.GetPubKey());
+    BOOST_CHECK(entry != entry2);
+}
+
+BOOST_AUTO_TEST_CASE(sigcache_full)
+{
+    // Filling the table past its size uses nearly every slot and keeps most of
+    // the recent entries; the ones dropped are the ends of displacement chains
+    CSignatureCache cache;
+    size_t nSlots = cache.Setup(1 << 16);
+
+    std::vector<uint256> vEntries;
+    for (size_t i = 0; i < nSlots * 2; i++) {
+        vEntries.push_back(GetRandHash());
+        cache.Insert(vEntries.back());
+    }
+    size_t nRecent = 0;
+    for (size_t i = vEntries.size() - nSlots / 4; i < vEntries.size(); i++)
+        nRecent += cache.Contains(vEntries[i], false);
+    size_t nAll = 0;
+    for (const uint256& entry : vEntries)
+        nAll += cache.Contains(entry, false);
+    BOOST_CHECK(nRecent > nSlots / 4 * 3 / 4);
+    BOOST_CHECK(nAll <= nSlots);
+    BOOST_CHECK(nAll > nSlots * 95 / 100);
+}
+
+static void ReadEntries(CSignatureCache* cache, const std::vector<uint256>* vAbsent, bool* pfFalseHit)
+{
+    for (int n = 0; n < 20; n++)
+        for (const uint256& entry : *vAbsent)
+            if (cache->Contains(entry, false))
+                *pfFalseHit = true;
+}
+
+BOOST_AUTO_TEST_CASE(sigcache_concurrent)
+{
+    // Lock free reads racing with inserts never see entries that were not inserted
+    CSignatureCache cache;
+    size_t nSlots = cache.Setup(1 << 20);
+
+    std::vector<uint256> vEntries, vAbsent;
+    for (int i = 0; i < 1000; i++) {
+        vEntries.push_back(GetRandHash());
+        vAbsent.push_back(GetRandHash());
+        cache.Insert(vEntries.back());
+    }
+
+    bool fFalseHit[4] = {false, false, false, false};
+    boost::thread_group threads;
+    for (int i = 0; i < 4; i++)
+        threads.create_thread(boost::bind(&ReadEntries, &cache, &vAbsent, &fFalseHit[i]));
+    for (size_t i = 0; i < nSlots / 4; i++)
+        cache.Insert(GetRandHash());
+    threads.join_all();
+
+    for (int i = 0; i < 4; i++)
+        BOOST_CHECK(!fFalseHit[i]);
+    // A quarter full table has room for everything
+    for (const uint256& entry : vEntries)
+        BOOST_CHECK(cache.Contains(entry, false));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
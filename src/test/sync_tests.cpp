@@ -0,0 +1,96 @@
+// Copyright (c) 2018 The HooliBet developers
+// Distributed under the MIT/X11 software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "sync.h"
+
+#include "utiltime.h"
+
+#include <boost/thread.hpp>
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(sync_tests)
+
+static const CLockSiteStats* FindLockSite(const std::vector<CLockSiteStats>& vStats, const std::string& strName)
+{
+    for (std::vector<CLockSiteStats>::const_iterator it = vStats.begin(); it != vStats.end(); ++it)
+        if (it->strName == strName)
+            return &*it;
+    return NULL;
+}
+
+static void HoldLock(CCriticalSection* pcs, boost::mutex* pmutexStarted, boost::condition_variable* pcondStarted, bool* pfStarted)
+{
+    LOCK(*pcs);
+    {
+        boost::unique_lock<boost::mutex> lock(*pmutexStarted);
+        *pfStarted = true;
+    }
+    pcondStarted->notify_one();
+    MilliSleep(50);
+}
+
+BOOST_AUTO_TEST_CASE(lockprofile_sites)
+{
+    CCriticalSection csProfiled;
+    CCriticalSection csUnprofiled;
+
+    {
+        LOCK(csUnprofiled);
+    }
+
+    fLockProfiling = true;
+    for (int i = 0; i < 3; i++) {
+        LOCK(csProfiled);
+    }
+    {
+        TRY_LOCK(csProfiled, lockProfiled);
+        BOOST_CHECK(bool(lockProfiled));
+    }
+
+    // Another thread holds the lock for a while, so taking it here has to wait
+    boost::mutex mutexStarted;
+    boost::condition_variable condStarted;
+    bool fStarted = false;
+    boost::thread holder(boost::bind(&HoldLock, &csProfiled, &mutexStarted, &condStarted, &fStarted));
+    {
+        boost::unique_lock<boost::mutex> lock(mutexStarted);
+        while (!fStarted)
+            condStarted.wait(lock);
+    }
+    {
+        LOCK(csProfiled);
+    }
+    holder.join();
+    fLockProfiling = false;
+
+    std::vector<CLockSiteStats> vStats;
+    GetLockSiteStats(vStats);
+    BOOST_CHECK(FindLockSite(vStats, "csUnprofiled") == NULL);
+
+    uint64_t nLocks = 0, nHolds = 0, nContended = 0, nMaxWait = 0, nMaxHold = 0;
+    for (std::vector<CLockSiteStats>::const_iterator it = vStats.begin(); it != vStats.end(); ++it) {
+        if (it->strName != "csProfiled" && it->strName != "*pcs")
+            continue;
+        BOOST_CHECK(it->strLocation.find("sync_tests.cpp:") != std::string::npos);
+        nLocks += it->wait.nCount;
+        nHolds += it->hold.nCount;
+        nContended += it->nContended;
+        nMaxWait = std::max(nMaxWait, it->wait.nMax);
+        nMaxHold = std::max(nMaxHold, it->hold.nMax);
+    }
+    // Three LOCKs in the loop, the TRY_LOCK, the contended LOCK and the one in the holder thread
+    BOOST_CHECK_EQUAL(nLocks, 6U);
+    BOOST_CHECK_EQUAL(nHolds, 6U);
+    BOOST_CHECK_EQUAL(nContended, 1U);
+    BOOST_CHECK(nMaxWait >= 10000);
+    BOOST_CHECK(nMaxHold >= 10000);
+
+    ResetLockSiteStats();
+    vStats.clear();
+    GetLockSiteStats(vStats);
+    const CLockSiteStats* psite = FindLockSite(vStats, "csProfiled");
+    BOOST_CHECK(psite != NULL && psite->wait.nCount == 0 && psite->hold.nCount == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
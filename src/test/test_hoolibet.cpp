@@ -5,7 +5,9 @@
 
 #define BOOST_TEST_MODULE HooliBet Test Suite
 
+#include "crypto/sha256.h"
 #include "main.h"
+#include "obfuscation.h"
 #include "random.h"
 #include "txdb.h"
 #include "ui_interface.h"
@@ -32,8 +34,11 @@ struct TestingSetup {
     ECCVerifyHandle globalVerifyHandle;
 
     TestingSetup() {
+        SHA256AutoDetect();
         ECC_Start();
         SetupEnvironment();
+        InitSignatureCache();
+        InitMessageSigCache();
         fPrintToDebugLog = false; // don't want to write to debug.log file
         fCheckBlockIndex = true;
         SelectParams(CBaseChainParams::UNITTEST);
@@ -46,7 +51,8 @@ struct TestingSetup {
         mapArgs["-datadir"] = pathTemp.string();
         pblocktree = new CBlockTreeDB(1 << 20, true);
         pcoinsdbview = new CCoinsViewDB(1 << 23, true);
-        pcoinsTip = new CCoinsViewCache(pcoinsdbview);
+        pcoinsflusher = new CCoinsViewFlusher(pcoinsdbview, pcoinsdbview, pblocktree);
+        pcoinsTip = new CCoinsViewCache(pcoinsflusher);
         InitBlockIndex();
 #ifdef ENABLE_WALLET
         bool fFirstRun;
@@ -69,6 +75,7 @@ struct TestingSetup {
         pwalletMain = NULL;
 #endif
         delete pcoinsTip;
+        delete pcoinsflusher;
         delete pcoinsdbview;
         delete pblocktree;
 #ifdef ENABLE_WALLET
@@ -15,7 +15,9 @@
 #include <stdint.h>
 #include <vector>
 
+#include <boost/filesystem/fstream.hpp>
 #include <boost/test/unit_test.hpp>
+#include <boost/thread.hpp>
 
 using namespace std;
 
@@ -425,4 +427,58 @@ BOOST_AUTO_TEST_CASE(test_FormatSubVersion)
     BOOST_CHECK_EQUAL(FormatSubVersion("Test", 99900, comments),std::string("/Test:0.9.99(comment1)/"));
     BOOST_CHECK_EQUAL(FormatSubVersion("Test", 99900, comments2),std::string("/Test:0.9.99(comment1; comment2)/"));
 }
+
+static void CheckLogCategories(std::vector<bool>* pvResult)
+{
+    // Twice, the second time answered from the cache
+    for (int i = 0; i < 2; i++) {
+        pvResult->push_back(LogAcceptCategory(NULL));
+        pvResult->push_back(LogAcceptCategory("net"));
+        pvResult->push_back(LogAcceptCategory("masternode"));
+        pvResult->push_back(LogAcceptCategory("zero"));
+        pvResult->push_back(LogAcceptCategory("mempool"));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(util_LogAcceptCategory)
+{
+    fDebug = true;
+    mapMultiArgs["-debug"].push_back("net");
+    mapMultiArgs["-debug"].push_back("hoolibet");
+
+    // Each thread reads the -debug settings once, so check from a fresh one
+    std::vector<bool> vResult;
+    boost::thread thread(boost::bind(&CheckLogCategories, &vResult));
+    thread.join();
+
+    mapMultiArgs.erase("-debug");
+    fDebug = false;
+
+    const bool vExpected[] = {true, true, true, true, false, true, true, true, true, false};
+    BOOST_CHECK(vResult == std::vector<bool>(vExpected, vExpected + 10));
+}
+
+BOOST_AUTO_TEST_CASE(util_LogPrintAsync)
+{
+    fPrintToDebugLog = true;
+    StartDebugLogThread();
+    for (int i = 0; i < 100; i++)
+        LogPrintf("util_LogPrintAsync line %d\n", i);
+    StopDebugLogThread();
+    LogPrintf("util_LogPrintAsync line %d\n", 100);
+    fPrintToDebugLog = false;
+
+    // Stopping the writer flushed every line, in order, before later direct writes
+    boost::filesystem::ifstream file(GetDataDir() / "debug.log");
+    std::string strLine;
+    int nLines = 0;
+    while (std::getline(file, strLine)) {
+        if (strLine.find("util_LogPrintAsync line ") == std::string::npos)
+            continue;
+        BOOST_CHECK(strLine.find(strprintf("util_LogPrintAsync line %d", nLines)) != std::string::npos);
+        nLines++;
+    }
+    BOOST_CHECK_EQUAL(nLines, 101);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
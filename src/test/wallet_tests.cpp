@@ -305,4 +305,60 @@ BOOST_AUTO_TEST_CASE(coin_selection_tests)
     empty_wallet();
 }
 
+BOOST_AUTO_TEST_CASE(scan_filter)
+{
+    CWallet keystore;
+    CKey key, keyOther;
+    key.MakeNewKey(true);
+    keyOther.MakeNewKey(true);
+    BOOST_CHECK(keystore.AddKey(key));
+
+    CMutableTransaction txWatched;
+    txWatched.vout.resize(1);
+    txWatched.vout[0].scriptPubKey = CScript() << OP_RETURN << ToByteVector(keyOther.GetPubKey());
+    BOOST_CHECK(keystore.AddWatchOnly(txWatched.vout[0].scriptPubKey));
+
+    // A multisig script added as such is ours without any of its keys
+    CKey keyThird;
+    keyThird.MakeNewKey(true);
+    std::vector<CPubKey> vOtherKeys;
+    vOtherKeys.push_back(keyOther.GetPubKey());
+    vOtherKeys.push_back(keyThird.GetPubKey());
+    CMutableTransaction txMultiSig;
+    txMultiSig.vout.resize(1);
+    txMultiSig.vout[0].scriptPubKey = GetScriptForMultisig(2, vOtherKeys);
+    BOOST_CHECK(keystore.AddMultiSig(txMultiSig.vout[0].scriptPubKey));
+    BOOST_CHECK(keystore.IsMine(txMultiSig.vout[0]) == ISMINE_MULTISIG);
+
+    CWalletScanFilter filter;
+    keystore.GetScanFilter(filter);
+
+    CMutableTransaction tx;
+    tx.vout.resize(1);
+    tx.vout[0].scriptPubKey = GetScriptForDestination(key.GetPubKey().GetID());
+    BOOST_CHECK(filter.IsRelevant(tx));
+    BOOST_CHECK(keystore.IsMine(tx));
+
+    tx.vout[0].scriptPubKey = CScript() << ToByteVector(key.GetPubKey()) << OP_CHECKSIG;
+    BOOST_CHECK(filter.IsRelevant(tx));
+
+    std::vector<CPubKey> vKeys;
+    vKeys.push_back(keyOther.GetPubKey());
+    vKeys.push_back(key.GetPubKey());
+    tx.vout[0].scriptPubKey = GetScriptForMultisig(1, vKeys);
+    BOOST_CHECK(filter.IsRelevant(tx));
+
+    tx.vout[0].scriptPubKey = GetScriptForDestination(keyOther.GetPubKey().GetID());
+    BOOST_CHECK(!filter.IsRelevant(tx));
+    BOOST_CHECK(filter.IsRelevant(txWatched));
+    BOOST_CHECK(filter.IsRelevant(txMultiSig));
+
+    // Spends of wallet transactions are matched by their inputs
+    tx.vin.resize(1);
+    tx.vin[0].prevout = COutPoint(txWatched.GetHash(), 0);
+    BOOST_CHECK(!filter.IsRelevant(tx));
+    filter.setWalletTxids.insert(txWatched.GetHash());
+    BOOST_CHECK(filter.IsRelevant(tx));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,72 +6,310 @@
 
 #include "txdb.h"
 
+#include "compressor.h"
+#include "init.h"
 #include "main.h"
 #include "pow.h"
+#include "ui_interface.h"
 #include "uint256.h"
 #include "accumulators.h"
 
+#include <deque>
 #include <stdint.h>
 
+#include <boost/bind.hpp>
 #include <boost/thread.hpp>
 
 using namespace std;
 using namespace libzerocoin;
 
-void static BatchWriteCoins(CLevelDBBatch& batch, const uint256& hash, const CCoins& coins)
+/**
+ * The chainstate keeps one record per unspent output:
+ *   'C' txid VARINT(n) -> VARINT(nVersion) VARINT(nHeight * 4 + fCoinBase + 2 * fCoinStake) CTxOutCompressor(out)
+ * so spending an output rewrites (erases) only that output, and
+ *   'H' -> best block hash
+ *   'V' -> CHAINSTATE_VERSION
+ * Databases of older versions have one 'c' txid -> CCoins record per transaction
+ * and keep the best block under 'B'; see Upgrade().
+ */
+static const int CHAINSTATE_VERSION = 1;
+
+struct CCoinsOutputKey {
+    char chType;
+    uint256 txid;
+    unsigned int n;
+
+    CCoinsOutputKey() : chType('C'), txid(0), n(0) {}
+    CCoinsOutputKey(const uint256& txidIn, unsigned int nIn) : chType('C'), txid(txidIn), n(nIn) {}
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        READWRITE(chType);
+        READWRITE(txid);
+        READWRITE(VARINT(n));
+    }
+};
+
+struct CCoinsOutputValue {
+    int nTxVersion;
+    int nHeight;
+    bool fCoinBase;
+    bool fCoinStake;
+    CTxOut out;
+
+    CCoinsOutputValue() : nTxVersion(0), nHeight(0), fCoinBase(false), fCoinStake(false) {}
+    CCoinsOutputValue(const CCoins& coins, unsigned int n) : nTxVersion(coins.nVersion), nHeight(coins.nHeight), fCoinBase(coins.fCoinBase), fCoinStake(coins.fCoinStake), out(coins.vout[n]) {}
+
+    ADD_SERIALIZE_METHODS;
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream& s, Operation ser_action, int nType, int nVersion)
+    {
+        unsigned int nCode = nHeight * 4 + (fCoinBase ? 1 : 0) + (fCoinStake ? 2 : 0);
+        READWRITE(VARINT(nTxVersion));
+        READWRITE(VARINT(nCode));
+        READWRITE(REF(CTxOutCompressor(out)));
+        if (ser_action.ForRead()) {
+            nHeight = nCode / 4;
+            fCoinBase = nCode & 1;
+            fCoinStake = (nCode & 2) != 0;
+        }
+    }
+};
+
+void static BatchWriteCoins(CLevelDBBatch& batch, const uint256& hash, const CCoinsCacheEntry& entry)
 {
-    if (coins.IsPruned())
-        batch.Erase(make_pair('c', hash));
-    else
-        batch.Write(make_pair('c', hash), coins);
+    const CCoins& coins = entry.coins;
+    if (entry.flags & CCoinsCacheEntry::FRESH) {
+        // Nothing of this transaction is in the database yet
+        for (unsigned int i = 0; i < coins.vout.size(); i++)
+            if (!coins.vout[i].IsNull())
+                batch.Write(CCoinsOutputKey(hash, i), CCoinsOutputValue(coins, i));
+        return;
+    }
+    for (unsigned int i = 0; i < entry.vDirtyOut.size(); i++) {
+        if (!entry.vDirtyOut[i])
+            continue;
+        if (i < coins.vout.size() && !coins.vout[i].IsNull())
+            batch.Write(CCoinsOutputKey(hash, i), CCoinsOutputValue(coins, i));
+        else
+            batch.Erase(CCoinsOutputKey(hash, i));
+    }
+}
+
+/**
+ * Read the outputs of txid starting at the cursor position, leaving the cursor
+ * after them; false if there are none
+ */
+bool static ReadCoinsOutputs(leveldb::Iterator* pcursor, const uint256& txid, CCoins& coins, uint64_t* pnSerializedSize = NULL)
+{
+    coins.Clear();
+    bool fFound = false;
+    for (; pcursor->Valid(); pcursor->Next()) {
+        leveldb::Slice slKey = pcursor->key();
+        if (slKey.empty() || slKey[0] != 'C')
+            break;
+        CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+        CCoinsOutputKey key;
+        ssKey >> key;
+        if (key.chType != 'C' || key.txid != txid)
+            break;
+        leveldb::Slice slValue = pcursor->value();
+        CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+        CCoinsOutputValue value;
+        ssValue >> value;
+        coins.nVersion = value.nTxVersion;
+        coins.nHeight = value.nHeight;
+        coins.fCoinBase = value.fCoinBase;
+        coins.fCoinStake = value.fCoinStake;
+        if (key.n >= coins.vout.size())
+            coins.vout.resize(key.n + 1);
+        coins.vout[key.n].nValue = value.out.nValue;
+        coins.vout[key.n].scriptPubKey.swap(value.out.scriptPubKey);
+        if (pnSerializedSize)
+            *pnSerializedSize += slKey.size() + slValue.size();
+        fFound = true;
+    }
+    return fFound;
+}
+
+void static SeekCoinsOutputs(leveldb::Iterator* pcursor, const uint256& txid)
+{
+    CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
+    ssKeySet << make_pair('C', txid);
+    pcursor->Seek(ssKeySet.str());
 }
 
 void static BatchWriteHashBestChain(CLevelDBBatch& batch, const uint256& hash)
 {
-    batch.Write('B', hash);
+    batch.Write('H', hash);
 }
 
-CCoinsViewDB::CCoinsViewDB(size_t nCacheSize, bool fMemory, bool fWipe) : db(GetDataDir() / "chainstate", nCacheSize, fMemory, fWipe)
+CCoinsViewDB::CCoinsViewDB(size_t nCacheSize, bool fMemory, bool fWipe) : db(GetDataDir() / "chainstate", nCacheSize, fMemory, fWipe), nCursorWrites(0), nWrites(0)
 {
 }
 
+leveldb::Iterator* CCoinsViewDB::SeekCoins(const uint256& txid) const
+{
+    AssertLockHeld(cs_cursor);
+    // Creating an iterator costs more than the seek, so one is kept until the next write
+    uint64_t nWritesNow = nWrites;
+    if (!pcursorCoins || nCursorWrites != nWritesNow) {
+        pcursorCoins.reset(const_cast<CLevelDBWrapper*>(&db)->NewIterator());
+        nCursorWrites = nWritesNow;
+    }
+    SeekCoinsOutputs(pcursorCoins.get(), txid);
+    return pcursorCoins.get();
+}
+
 bool CCoinsViewDB::GetCoins(const uint256& txid, CCoins& coins) const
 {
-    return db.Read(make_pair('c', txid), coins);
+    LOCK(cs_cursor);
+    return ReadCoinsOutputs(SeekCoins(txid), txid, coins);
 }
 
 bool CCoinsViewDB::HaveCoins(const uint256& txid) const
 {
-    return db.Exists(make_pair('c', txid));
+    LOCK(cs_cursor);
+    leveldb::Iterator* pcursor = SeekCoins(txid);
+    if (!pcursor->Valid())
+        return false;
+    leveldb::Slice slKey = pcursor->key();
+    if (slKey.empty() || slKey[0] != 'C')
+        return false;
+    CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+    CCoinsOutputKey key;
+    ssKey >> key;
+    return key.chType == 'C' && key.txid == txid;
 }
 
 uint256 CCoinsViewDB::GetBestBlock() const
 {
     uint256 hashBestChain;
-    if (!db.Read('B', hashBestChain))
+    if (!db.Read('H', hashBestChain))
         return uint256(0);
     return hashBestChain;
 }
 
 bool CCoinsViewDB::BatchWrite(CCoinsMap& mapCoins, const uint256& hashBlock)
+{
+    size_t nBytes = 0;
+    bool fOk = WriteCoins(mapCoins, hashBlock, nBytes);
+    mapCoins.clear();
+    return fOk;
+}
+
+bool CCoinsViewDB::WriteCoins(const CCoinsMap& mapCoins, const uint256& hashBlock, size_t& nBytes)
 {
     CLevelDBBatch batch;
-    size_t count = 0;
     size_t changed = 0;
-    for (CCoinsMap::iterator it = mapCoins.begin(); it != mapCoins.end();) {
+    for (CCoinsMap::const_iterator it = mapCoins.begin(); it != mapCoins.end(); it++) {
         if (it->second.flags & CCoinsCacheEntry::DIRTY) {
-            BatchWriteCoins(batch, it->first, it->second.coins);
+            BatchWriteCoins(batch, it->first, it->second);
             changed++;
         }
-        count++;
-        CCoinsMap::iterator itOld = it++;
-        mapCoins.erase(itOld);
     }
     if (hashBlock != uint256(0))
         BatchWriteHashBestChain(batch, hashBlock);
 
-    LogPrint("coindb", "Committing %u changed transactions (out of %u) to coin database...\n", (unsigned int)changed, (unsigned int)count);
-    return db.WriteBatch(batch);
+    LogPrint("coindb", "Committing %u changed transactions (out of %u) to coin database...\n", (unsigned int)changed, (unsigned int)mapCoins.size());
+    nBytes += batch.GetSize();
+    bool fOk = db.WriteBatch(batch);
+    nWrites++;
+    return fOk;
+}
+
+bool CCoinsViewDB::Upgrade()
+{
+    int nVersion = 0;
+    bool fVersion = db.Read('V', nVersion);
+    if (fVersion && nVersion > CHAINSTATE_VERSION)
+        return error("%s : the chainstate has format %d, this version only knows %d", __func__, nVersion, CHAINSTATE_VERSION);
+
+    // Older versions find no best block once it is moved, so they rebuild their
+    // chainstate instead of running on records they cannot read
+    if (db.Exists('B')) {
+        if (db.Exists('H'))
+            return error("%s : the chainstate was used by an older version after the upgrade, it has to be rebuilt with -reindex", __func__);
+        uint256 hashBestChain;
+        if (!db.Read('B', hashBestChain))
+            return error("%s : cannot read the best block", __func__);
+        CLevelDBBatch batch;
+        batch.Write('H', hashBestChain);
+        batch.Erase('B');
+        if (!db.WriteBatch(batch, true))
+            return false;
+    }
+
+    boost::scoped_ptr<leveldb::Iterator> pcursor(db.NewIterator());
+    CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
+    ssKeySet << make_pair('c', uint256(0));
+    pcursor->Seek(ssKeySet.str());
+    if (!pcursor->Valid() || pcursor->key()[0] != 'c') {
+        if (fVersion && nVersion == CHAINSTATE_VERSION)
+            return true;
+        return db.Write('V', CHAINSTATE_VERSION, true);
+    }
+
+    LogPrintf("Upgrading the chainstate to one record per output...\n");
+    uiInterface.ShowProgress(_("Upgrading UTXO database"), 0);
+    // Each batch moves whole transactions, so an interrupted upgrade resumes where it stopped
+    static const size_t nBatchSize = 16 << 20;
+    CLevelDBBatch batch;
+    size_t nTransactions = 0;
+    int nReported = 0;
+    while (pcursor->Valid()) {
+        boost::this_thread::interruption_point();
+        if (ShutdownRequested())
+            break;
+        try {
+            leveldb::Slice slKey = pcursor->key();
+            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+            char chType;
+            ssKey >> chType;
+            if (chType != 'c')
+                break;
+            uint256 txid;
+            ssKey >> txid;
+            leveldb::Slice slValue = pcursor->value();
+            CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+            CCoins coins;
+            ssValue >> coins;
+
+            for (unsigned int i = 0; i < coins.vout.size(); i++)
+                if (!coins.vout[i].IsNull())
+                    batch.Write(CCoinsOutputKey(txid, i), CCoinsOutputValue(coins, i));
+            batch.Erase(make_pair('c', txid));
+            nTransactions++;
+
+            if (batch.GetSize() > nBatchSize) {
+                if (!db.WriteBatch(batch))
+                    return false;
+                batch.Clear();
+                // Keys are ordered by the first txid byte, and txids are uniformly distributed
+                int nProgress = *txid.begin() * 100 / 256;
+                uiInterface.ShowProgress(_("Upgrading UTXO database"), nProgress);
+                if (nProgress / 10 > nReported) {
+                    nReported = nProgress / 10;
+                    LogPrintf("[%d%%]...\n", nProgress);
+                }
+            }
+            pcursor->Next();
+        } catch (std::exception& e) {
+            return error("%s : Deserialize or I/O error - %s", __func__, e.what());
+        }
+    }
+    // The version is only written once no per-transaction records are left
+    if (!ShutdownRequested())
+        batch.Write('V', CHAINSTATE_VERSION);
+    bool fOk = db.WriteBatch(batch, true);
+    nWrites++;
+    uiInterface.ShowProgress("", 100);
+    LogPrintf("Upgraded %u transactions in the chainstate%s\n", nTransactions, ShutdownRequested() ? ", interrupted" : "");
+    return fOk;
 }
 
 CBlockTreeDB::CBlockTreeDB(size_t nCacheSize, bool fMemory, bool fWipe) : CLevelDBWrapper(GetDataDir() / "blocks" / "index", nCacheSize, fMemory, fWipe)
@@ -83,6 +321,19 @@ bool CBlockTreeDB::WriteBlockIndex(const CDiskBlockIndex& blockindex)
     return Write(make_pair('b', blockindex.GetBlockHash()), blockindex);
 }
 
+bool CBlockTreeDB::WriteBatchSync(const std::vector<std::pair<int, CBlockFileInfo> >& vFileInfo, int nLastFile, const std::vector<CDiskBlockIndex>& vBlockIndex, size_t& nBytes)
+{
+    CLevelDBBatch batch;
+    for (std::vector<std::pair<int, CBlockFileInfo> >::const_iterator it = vFileInfo.begin(); it != vFileInfo.end(); it++)
+        batch.Write(make_pair('f', it->first), it->second);
+    if (!vFileInfo.empty())
+        batch.Write('l', nLastFile);
+    for (std::vector<CDiskBlockIndex>::const_iterator it = vBlockIndex.begin(); it != vBlockIndex.end(); it++)
+        batch.Write(make_pair('b', it->GetBlockHash()), *it);
+    nBytes += batch.GetSize();
+    return WriteBatch(batch, true);
+}
+
 bool CBlockTreeDB::WriteBlockFileInfo(int nFile, const CBlockFileInfo& info)
 {
     return Write(make_pair('f', nFile), info);
@@ -117,60 +368,414 @@ bool CBlockTreeDB::ReadLastBlockFile(int& nFile)
     return Read('l', nFile);
 }
 
+/**
+ * One key range of a chainstate scan. A worker serializes the range into chunks
+ * for the hash, which GetStats takes in key order; a worker that gets ahead
+ * waits while it has nMaxBuffered bytes queued.
+ */
+class CCoinsStatsRange
+{
+public:
+    static const size_t nChunkSize = 1 << 20;
+    static const size_t nMaxBuffered = 8 << 20;
+
+    unsigned char chBegin; // First txid byte in the range
+    unsigned char chLast;  // Last txid byte in the range
+
+    boost::mutex mutex;
+    boost::condition_variable cond;
+    std::deque<std::vector<char> > vChunks;
+    size_t nBuffered;
+    bool fDone;
+    bool fFailed;
+
+    uint64_t nTransactions;
+    uint64_t nTransactionOutputs;
+    uint64_t nSerializedSize;
+    CAmount nTotalAmount;
+
+    CCoinsStatsRange() : chBegin(0), chLast(0), nBuffered(0), fDone(false), fFailed(false), nTransactions(0), nTransactionOutputs(0), nSerializedSize(0), nTotalAmount(0) {}
+};
+
+class CCoinsStatsScan
+{
+public:
+    CLevelDBWrapper& db;
+    const leveldb::Snapshot* snapshot;
+    std::vector<CCoinsStatsRange> vRanges;
+    boost::mutex mutex;
+    size_t nNextRange;
+    bool fAbort;
+
+    CCoinsStatsScan(CLevelDBWrapper& dbIn, const leveldb::Snapshot* snapshotIn, size_t nRanges) : db(dbIn), snapshot(snapshotIn), vRanges(nRanges), nNextRange(0), fAbort(false)
+    {
+        for (size_t i = 0; i < nRanges; i++) {
+            vRanges[i].chBegin = i * 256 / nRanges;
+            vRanges[i].chLast = (i + 1) * 256 / nRanges - 1;
+        }
+    }
+
+    bool Aborted()
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        return fAbort;
+    }
+
+    void Abort()
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            fAbort = true;
+        }
+        for (size_t i = 0; i < vRanges.size(); i++) {
+            boost::unique_lock<boost::mutex> lock(vRanges[i].mutex);
+            vRanges[i].cond.notify_all();
+        }
+    }
+
+    //! Hand a chunk to the hasher; false when the scan is aborted
+    bool Push(CCoinsStatsRange& range, CDataStream& ssChunk)
+    {
+        std::vector<char> vChunk(ssChunk.begin(), ssChunk.end());
+        ssChunk.clear();
+        boost::unique_lock<boost::mutex> lock(range.mutex);
+        while (range.nBuffered >= CCoinsStatsRange::nMaxBuffered && !Aborted())
+            range.cond.wait(lock);
+        range.nBuffered += vChunk.size();
+        range.vChunks.push_back(std::vector<char>());
+        range.vChunks.back().swap(vChunk);
+        range.cond.notify_all();
+        return !Aborted();
+    }
+
+    bool ScanRange(CCoinsStatsRange& range)
+    {
+        boost::scoped_ptr<leveldb::Iterator> pcursor(db.NewIterator(snapshot));
+        char chKeyBegin[2] = {'C', (char)range.chBegin};
+        pcursor->Seek(leveldb::Slice(chKeyBegin, 2));
+
+        CDataStream ss(SER_GETHASH, PROTOCOL_VERSION);
+        while (pcursor->Valid()) {
+            leveldb::Slice slKey = pcursor->key();
+            if (slKey.size() < 2 || slKey[0] != 'C' || (unsigned char)slKey[1] > range.chLast)
+                break;
+            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+            CCoinsOutputKey key;
+            ssKey >> key;
+            CCoins coins;
+            ReadCoinsOutputs(pcursor.get(), key.txid, coins, &range.nSerializedSize);
+            ss << key.txid;
+            ss << VARINT(coins.nVersion);
+            ss << (coins.fCoinBase ? 'c' : 'n');
+            ss << VARINT(coins.nHeight);
+            range.nTransactions++;
+            for (unsigned int i = 0; i < coins.vout.size(); i++) {
+                const CTxOut& out = coins.vout[i];
+                if (!out.IsNull()) {
+                    range.nTransactionOutputs++;
+                    ss << VARINT(i + 1);
+                    ss << out;
+                    range.nTotalAmount += out.nValue;
+                }
+            }
+            ss << VARINT(0);
+            if (ss.size() >= CCoinsStatsRange::nChunkSize && !Push(range, ss))
+                return false;
+        }
+        return ss.empty() || Push(range, ss);
+    }
+
+    void ThreadScan()
+    {
+        RenameThread("hoolibet-stats");
+        while (true) {
+            CCoinsStatsRange* prange;
+            {
+                boost::unique_lock<boost::mutex> lock(mutex);
+                // Ranges are taken in order, so the one being hashed always has a worker
+                if (fAbort || nNextRange == vRanges.size())
+                    return;
+                prange = &vRanges[nNextRange++];
+            }
+            bool fOk = false;
+            try {
+                fOk = ScanRange(*prange);
+            } catch (const std::exception& e) {
+                LogPrintf("%s : Deserialize or I/O error - %s\n", __func__, e.what());
+            }
+            boost::unique_lock<boost::mutex> lock(prange->mutex);
+            prange->fDone = true;
+            prange->fFailed = !fOk;
+            prange->cond.notify_all();
+        }
+    }
+};
+
 bool CCoinsViewDB::GetStats(CCoinsStats& stats) const
 {
     /* It seems that there are no "const iterators" for LevelDB.  Since we
        only need read operations on it, use a const-cast to get around
        that restriction.  */
-    boost::scoped_ptr<leveldb::Iterator> pcursor(const_cast<CLevelDBWrapper*>(&db)->NewIterator());
-    pcursor->SeekToFirst();
+    CLevelDBWrapper& dbScan = const_cast<CLevelDBWrapper&>(db);
+    const leveldb::Snapshot* snapshot = dbScan.GetSnapshot();
+
+    // The best block is written in the same batch as the coins, so the snapshot matches it
+    uint256 hashBlock(0);
+    {
+        boost::scoped_ptr<leveldb::Iterator> pcursor(dbScan.NewIterator(snapshot));
+        pcursor->Seek(leveldb::Slice("H", 1));
+        if (pcursor->Valid() && pcursor->key() == leveldb::Slice("H", 1)) {
+            leveldb::Slice slValue = pcursor->value();
+            CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+            ssValue >> hashBlock;
+        }
+    }
+    {
+        LOCK(cs_stats);
+        if (hashBlock != uint256(0) && statsCache.hashBlock == hashBlock) {
+            dbScan.ReleaseSnapshot(snapshot);
+            stats = statsCache;
+            return true;
+        }
+    }
+
+    int64_t nStart = GetTimeMicros();
+    int nThreads = std::max(1, std::min((int)boost::thread::hardware_concurrency(), MAX_STATS_THREADS));
+    CCoinsStatsScan scan(dbScan, snapshot, 4 * nThreads);
+    boost::thread_group threadGroup;
+    for (int i = 0; i < nThreads; i++)
+        threadGroup.create_thread(boost::bind(&CCoinsStatsScan::ThreadScan, &scan));
 
     CHashWriter ss(SER_GETHASH, PROTOCOL_VERSION);
-    stats.hashBlock = GetBestBlock();
-    ss << stats.hashBlock;
-    CAmount nTotalAmount = 0;
-    while (pcursor->Valid()) {
-        boost::this_thread::interruption_point();
-        try {
-            leveldb::Slice slKey = pcursor->key();
-            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
-            char chType;
-            ssKey >> chType;
-            if (chType == 'c') {
-                leveldb::Slice slValue = pcursor->value();
-                CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
-                CCoins coins;
-                ssValue >> coins;
-                uint256 txhash;
-                ssKey >> txhash;
-                ss << txhash;
-                ss << VARINT(coins.nVersion);
-                ss << (coins.fCoinBase ? 'c' : 'n');
-                ss << VARINT(coins.nHeight);
-                stats.nTransactions++;
-                for (unsigned int i = 0; i < coins.vout.size(); i++) {
-                    const CTxOut& out = coins.vout[i];
-                    if (!out.IsNull()) {
-                        stats.nTransactionOutputs++;
-                        ss << VARINT(i + 1);
-                        ss << out;
-                        nTotalAmount += out.nValue;
+    ss << hashBlock;
+    CCoinsStats statsNew;
+    statsNew.hashBlock = hashBlock;
+    bool fOk = true;
+    try {
+        for (size_t i = 0; i < scan.vRanges.size() && fOk; i++) {
+            CCoinsStatsRange& range = scan.vRanges[i];
+            while (true) {
+                boost::this_thread::interruption_point();
+                std::vector<char> vChunk;
+                {
+                    boost::unique_lock<boost::mutex> lock(range.mutex);
+                    while (range.vChunks.empty() && !range.fDone)
+                        range.cond.wait(lock);
+                    if (range.vChunks.empty()) {
+                        fOk = !range.fFailed;
+                        break;
                     }
+                    vChunk.swap(range.vChunks.front());
+                    range.vChunks.pop_front();
+                    range.nBuffered -= vChunk.size();
+                    range.cond.notify_all();
                 }
-                stats.nSerializedSize += 32 + slValue.size();
-                ss << VARINT(0);
+                ss.write(&vChunk[0], vChunk.size());
             }
-            pcursor->Next();
-        } catch (std::exception& e) {
-            return error("%s : Deserialize or I/O error - %s", __func__, e.what());
+            statsNew.nTransactions += range.nTransactions;
+            statsNew.nTransactionOutputs += range.nTransactionOutputs;
+            statsNew.nSerializedSize += range.nSerializedSize;
+            statsNew.nTotalAmount += range.nTotalAmount;
+        }
+    } catch (...) {
+        scan.Abort();
+        threadGroup.join_all();
+        dbScan.ReleaseSnapshot(snapshot);
+        throw;
+    }
+    if (!fOk)
+        scan.Abort();
+    threadGroup.join_all();
+    dbScan.ReleaseSnapshot(snapshot);
+    if (!fOk)
+        return error("%s : scanning the chainstate failed", __func__);
+
+    statsNew.hashSerialized = ss.GetHash();
+    {
+        LOCK(cs_main);
+        BlockMap::const_iterator it = mapBlockIndex.find(hashBlock);
+        if (it != mapBlockIndex.end())
+            statsNew.nHeight = it->second->nHeight;
+    }
+    LogPrint("coindb", "%s : %u outputs in %.2fms on %d threads\n", __func__, statsNew.nTransactionOutputs, (GetTimeMicros() - nStart) * 0.001, nThreads);
+
+    LOCK(cs_stats);
+    statsCache = statsNew;
+    stats = statsNew;
+    return true;
+}
+
+CCoinsViewFlusher::CCoinsViewFlusher(CCoinsView* baseIn, CCoinsViewDB* pcoinsdbIn, CBlockTreeDB* pblocktreeIn) : CCoinsViewBacked(baseIn), pcoinsdb(pcoinsdbIn), pblocktreedb(pblocktreeIn), fStop(false), fWriting(false), fFailed(false), hashBlockFrozen(0), nLastFile(0)
+{
+    thread = boost::thread(boost::bind(&CCoinsViewFlusher::ThreadFlush, this));
+}
+
+CCoinsViewFlusher::~CCoinsViewFlusher()
+{
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        fStop = true;
+    }
+    cond.notify_all();
+    thread.join();
+}
+
+void CCoinsViewFlusher::ThreadFlush()
+{
+    RenameThread("hoolibet-flush");
+
+    while (true) {
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            while (!fWriting && !fStop)
+                cond.wait(lock);
+            // A flush in flight is finished before stopping
+            if (!fWriting)
+                return;
+        }
+
+        // The snapshot is not changed while fWriting is set, and readers only look entries up
+        int64_t nStart = GetTimeMicros();
+        size_t nBytes = 0;
+        bool fOk = true;
+        try {
+            if (!vFileInfo.empty() || !vBlockIndex.empty())
+                fOk = pblocktreedb->WriteBatchSync(vFileInfo, nLastFile, vBlockIndex, nBytes);
+            // The chainstate may refer to block index entries, so it goes last
+            if (fOk)
+                fOk = pcoinsdb->WriteCoins(mapFrozen, hashBlockFrozen, nBytes);
+        } catch (const std::exception& e) {
+            LogPrintf("%s : %s\n", __func__, e.what());
+            fOk = false;
+        }
+        int64_t nTime = GetTimeMicros() - nStart;
+        LogPrintf("Flushed %u coins and %u block index entries (%.2f MiB) in %.2fms%s\n", mapFrozen.size(), vBlockIndex.size(),
+            nBytes * (1.0 / (1 << 20)), nTime * 0.001, fOk ? "" : ", FAILED");
+
+        {
+            boost::unique_lock<boost::mutex> lock(mutex);
+            // After a failure the snapshot stays in the read path, the database is missing it
+            if (fOk)
+                CCoinsMap().swap(mapFrozen);
+            vFileInfo.clear();
+            vBlockIndex.clear();
+            if (!fOk)
+                fFailed = true;
+            flushStats.nFlushes++;
+            flushStats.nLastMicros = nTime;
+            flushStats.nLastBytes = nBytes;
+            flushStats.nTotalMicros += nTime;
+            flushStats.nTotalBytes += nBytes;
+            fWriting = false;
+        }
+        cond.notify_all();
+        if (!fOk)
+            AbortNode("Failed to write to coin database");
+    }
+}
+
+bool CCoinsViewFlusher::GetCoins(const uint256& txid, CCoins& coins) const
+{
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        CCoinsMap::const_iterator it = mapFrozen.find(txid);
+        if (it != mapFrozen.end()) {
+            // A pruned entry is about to be erased from the database
+            if (it->second.coins.IsPruned())
+                return false;
+            coins = it->second.coins;
+            return true;
         }
     }
-    stats.nHeight = mapBlockIndex.find(GetBestBlock())->second->nHeight;
-    stats.hashSerialized = ss.GetHash();
-    stats.nTotalAmount = nTotalAmount;
+    return base->GetCoins(txid, coins);
+}
+
+bool CCoinsViewFlusher::HaveCoins(const uint256& txid) const
+{
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        CCoinsMap::const_iterator it = mapFrozen.find(txid);
+        if (it != mapFrozen.end())
+            return !it->second.coins.IsPruned();
+    }
+    return base->HaveCoins(txid);
+}
+
+uint256 CCoinsViewFlusher::GetBestBlock() const
+{
+    {
+        boost::unique_lock<boost::mutex> lock(mutex);
+        if ((fWriting || fFailed) && hashBlockFrozen != uint256(0))
+            return hashBlockFrozen;
+    }
+    return base->GetBestBlock();
+}
+
+bool CCoinsViewFlusher::BatchWrite(CCoinsMap& mapCoins, const uint256& hashBlock)
+{
+    boost::unique_lock<boost::mutex> lock(mutex);
+    while (fWriting)
+        cond.wait(lock);
+    if (fFailed) {
+        mapCoins.clear();
+        vFileInfo.clear();
+        vBlockIndex.clear();
+        return false;
+    }
+
+    // Only the dirty entries are handed over, the others are on disk already
+    for (CCoinsMap::iterator it = mapCoins.begin(); it != mapCoins.end(); it++) {
+        if (it->second.flags & CCoinsCacheEntry::DIRTY) {
+            CCoinsCacheEntry& entry = mapFrozen[it->first];
+            entry.coins.swap(it->second.coins);
+            entry.vDirtyOut.swap(it->second.vDirtyOut);
+            entry.flags = it->second.flags;
+        }
+    }
+    mapCoins.clear();
+    hashBlockFrozen = hashBlock;
+    fWriting = true;
+    cond.notify_all();
     return true;
 }
 
+bool CCoinsViewFlusher::GetStats(CCoinsStats& stats) const
+{
+    if (!Wait())
+        return false;
+    return base->GetStats(stats);
+}
+
+void CCoinsViewFlusher::QueueBlockIndex(const std::vector<std::pair<int, CBlockFileInfo> >& vFileInfoIn, int nLastFileIn, const std::vector<CDiskBlockIndex>& vBlockIndexIn)
+{
+    boost::unique_lock<boost::mutex> lock(mutex);
+    while (fWriting)
+        cond.wait(lock);
+    vFileInfo = vFileInfoIn;
+    nLastFile = nLastFileIn;
+    vBlockIndex = vBlockIndexIn;
+}
+
+bool CCoinsViewFlusher::IsWriting() const
+{
+    boost::unique_lock<boost::mutex> lock(mutex);
+    return fWriting;
+}
+
+bool CCoinsViewFlusher::Wait() const
+{
+    boost::unique_lock<boost::mutex> lock(mutex);
+    while (fWriting)
+        cond.wait(lock);
+    return !fFailed;
+}
+
+CFlushStats CCoinsViewFlusher::GetFlushStats() const
+{
+    boost::unique_lock<boost::mutex> lock(mutex);
+    return flushStats;
+}
+
 bool CBlockTreeDB::ReadTxIndex(const uint256& txid, CDiskTxPos& pos)
 {
     return Read(make_pair('t', txid), pos);
@@ -184,6 +789,157 @@ bool CBlockTreeDB::WriteTxIndex(const std::vector<std::pair<uint256, CDiskTxPos>
     return WriteBatch(batch);
 }
 
+bool CBlockTreeDB::WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> >& vect)
+{
+    CLevelDBBatch batch;
+    for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it = vect.begin(); it != vect.end(); it++)
+        batch.Write(make_pair('a', it->first), it->second);
+    return WriteBatch(batch);
+}
+
+bool CBlockTreeDB::EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> >& vect)
+{
+    CLevelDBBatch batch;
+    for (std::vector<std::pair<CAddressIndexKey, CAmount> >::const_iterator it = vect.begin(); it != vect.end(); it++)
+        batch.Erase(make_pair('a', it->first));
+    return WriteBatch(batch);
+}
+
+bool CBlockTreeDB::ReadAddressIndex(int nAddressType, const uint160& hashBytes, std::vector<std::pair<CAddressIndexKey, CAmount> >& vAddressIndex, int nStart, int nEnd)
+{
+    boost::scoped_ptr<leveldb::Iterator> pcursor(NewIterator());
+
+    CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
+    if (nStart > 0 && nEnd > 0)
+        ssKeySet << make_pair('a', CAddressIndexIteratorKey(nAddressType, hashBytes, nStart));
+    else
+        ssKeySet << make_pair('a', CAddressIndexIteratorKey(nAddressType, hashBytes));
+    pcursor->Seek(ssKeySet.str());
+
+    for (; pcursor->Valid(); pcursor->Next()) {
+        boost::this_thread::interruption_point();
+        try {
+            leveldb::Slice slKey = pcursor->key();
+            if (slKey.empty() || slKey[0] != 'a')
+                break;
+            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+            std::pair<char, CAddressIndexKey> key;
+            ssKey >> key;
+            if (key.second.nAddressType != nAddressType || key.second.hashBytes != hashBytes)
+                break;
+            if (nEnd > 0 && key.second.nBlockHeight > nEnd)
+                break;
+
+            leveldb::Slice slValue = pcursor->value();
+            CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+            CAmount nValue;
+            ssValue >> nValue;
+            vAddressIndex.push_back(make_pair(key.second, nValue));
+        } catch (const std::exception& e) {
+            return error("%s : deserialize or I/O error - %s", __func__, e.what());
+        }
+    }
+    return true;
+}
+
+bool CBlockTreeDB::UpdateAddressUnspentIndex(const std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >& vect)
+{
+    CLevelDBBatch batch;
+    for (std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >::const_iterator it = vect.begin(); it != vect.end(); it++) {
+        if (it->second.IsNull())
+            batch.Erase(make_pair('u', it->first));
+        else
+            batch.Write(make_pair('u', it->first), it->second);
+    }
+    return WriteBatch(batch);
+}
+
+bool CBlockTreeDB::ReadAddressUnspentIndex(int nAddressType, const uint160& hashBytes, std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >& vUnspent)
+{
+    boost::scoped_ptr<leveldb::Iterator> pcursor(NewIterator());
+
+    CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
+    ssKeySet << make_pair('u', CAddressIndexIteratorKey(nAddressType, hashBytes));
+    pcursor->Seek(ssKeySet.str());
+
+    for (; pcursor->Valid(); pcursor->Next()) {
+        boost::this_thread::interruption_point();
+        try {
+            leveldb::Slice slKey = pcursor->key();
+            if (slKey.empty() || slKey[0] != 'u')
+                break;
+            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+            std::pair<char, CAddressUnspentKey> key;
+            ssKey >> key;
+            if (key.second.nAddressType != nAddressType || key.second.hashBytes != hashBytes)
+                break;
+
+            leveldb::Slice slValue = pcursor->value();
+            CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
+            CAddressUnspentValue value;
+            ssValue >> value;
+            vUnspent.push_back(make_pair(key.second, value));
+        } catch (const std::exception& e) {
+            return error("%s : deserialize or I/O error - %s", __func__, e.what());
+        }
+    }
+    return true;
+}
+
+bool CBlockTreeDB::UpdateSpentIndex(const std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> >& vect)
+{
+    CLevelDBBatch batch;
+    for (std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> >::const_iterator it = vect.begin(); it != vect.end(); it++) {
+        if (it->second.IsNull())
+            batch.Erase(make_pair('p', it->first));
+        else
+            batch.Write(make_pair('p', it->first), it->second);
+    }
+    return WriteBatch(batch);
+}
+
+bool CBlockTreeDB::ReadSpentIndex(const CSpentIndexKey& key, CSpentIndexValue& value)
+{
+    return Read(make_pair('p', key), value);
+}
+
+bool CBlockTreeDB::WriteTimestampIndex(const CTimestampIndexKey& key)
+{
+    return Write(make_pair('s', key), '0');
+}
+
+bool CBlockTreeDB::EraseTimestampIndex(const CTimestampIndexKey& key)
+{
+    return Erase(make_pair('s', key));
+}
+
+bool CBlockTreeDB::ReadTimestampIndex(unsigned int nHigh, unsigned int nLow, std::vector<uint256>& vHashes)
+{
+    boost::scoped_ptr<leveldb::Iterator> pcursor(NewIterator());
+
+    CDataStream ssKeySet(SER_DISK, CLIENT_VERSION);
+    ssKeySet << make_pair('s', CTimestampIndexKey(nLow, uint256(0)));
+    pcursor->Seek(ssKeySet.str());
+
+    for (; pcursor->Valid(); pcursor->Next()) {
+        boost::this_thread::interruption_point();
+        try {
+            leveldb::Slice slKey = pcursor->key();
+            if (slKey.empty() || slKey[0] != 's')
+                break;
+            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+            std::pair<char, CTimestampIndexKey> key;
+            ssKey >> key;
+            if (key.second.nTimestamp >= nHigh)
+                break;
+            vHashes.push_back(key.second.blockHash);
+        } catch (const std::exception& e) {
+            return error("%s : deserialize or I/O error - %s", __func__, e.what());
+        }
+    }
+    return true;
+}
+
 bool CBlockTreeDB::WriteFlag(const std::string& name, bool fValue)
 {
     return Write(std::make_pair('F', name), fValue ? '1' : '0');
@@ -218,6 +974,7 @@ bool CBlockTreeDB::LoadBlockIndexGuts()
 
     // Load mapBlockIndex
     uint256 nPreviousCheckpoint;
+    std::vector<std::pair<CBlockIndex*, CDiskBlockIndex> > vPowUnchecked;
     while (pcursor->Valid()) {
         boost::this_thread::interruption_point();
         try {
@@ -226,13 +983,16 @@ bool CBlockTreeDB::LoadBlockIndexGuts()
             char chType;
             ssKey >> chType;
             if (chType == 'b') {
+                uint256 hashBlock;
+                ssKey >> hashBlock;
                 leveldb::Slice slValue = pcursor->value();
                 CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
                 CDiskBlockIndex diskindex;
                 ssValue >> diskindex;
 
-                // Construct block index object
-                CBlockIndex* pindexNew = InsertBlockIndex(diskindex.GetBlockHash());
+                // Construct block index object; the key already holds the block hash, so the
+                // header is not hashed again (Quark for the proof-of-work era) just to find it
+                CBlockIndex* pindexNew = InsertBlockIndex(hashBlock);
                 pindexNew->pprev = InsertBlockIndex(diskindex.hashPrev);
                 pindexNew->pnext = InsertBlockIndex(diskindex.hashNext);
                 pindexNew->nHeight = diskindex.nHeight;
@@ -261,10 +1021,8 @@ bool CBlockTreeDB::LoadBlockIndexGuts()
                 pindexNew->nStakeTime = diskindex.nStakeTime;
                 pindexNew->hashProofOfStake = diskindex.hashProofOfStake;
 
-                if (pindexNew->nHeight <= Params().LAST_POW_BLOCK()) {
-                    if (!CheckProofOfWork(pindexNew->GetBlockHash(), pindexNew->nBits))
-                        return error("LoadBlockIndex() : CheckProofOfWork failed: %s", pindexNew->ToString());
-                }
+                if (pindexNew->nHeight <= Params().LAST_POW_BLOCK() && !(pindexNew->nStatus & BLOCK_POW_CHECKED))
+                    vPowUnchecked.push_back(std::make_pair(pindexNew, diskindex));
                 // ppcoin: build setStakeSeen
                 if (pindexNew->IsProofOfStake())
                     setStakeSeen.insert(make_pair(pindexNew->prevoutStake, pindexNew->nStakeTime));
@@ -287,7 +1045,30 @@ bool CBlockTreeDB::LoadBlockIndexGuts()
         }
     }
 
-    return true;
+    if (vPowUnchecked.empty())
+        return true;
+
+    // Check the proof of work of the headers not checked before, hashing them all at once,
+    // and mark them so that later startups skip their Quark hashes
+    std::vector<CBlockHeader> vHeaders;
+    vHeaders.reserve(vPowUnchecked.size());
+    for (std::vector<std::pair<CBlockIndex*, CDiskBlockIndex> >::const_iterator it = vPowUnchecked.begin(); it != vPowUnchecked.end(); it++)
+        vHeaders.push_back(it->first->GetBlockHeader());
+    std::vector<uint256> vHashes;
+    GetBlockHeaderHashes(vHeaders, vHashes);
+
+    CLevelDBBatch batch;
+    for (unsigned int i = 0; i < vPowUnchecked.size(); i++) {
+        CBlockIndex* pindex = vPowUnchecked[i].first;
+        if (vHashes[i] != pindex->GetBlockHash() || !CheckProofOfWork(vHashes[i], pindex->nBits))
+            return error("LoadBlockIndex() : CheckProofOfWork failed: %s", pindex->ToString());
+        pindex->nStatus |= BLOCK_POW_CHECKED;
+        CDiskBlockIndex& diskindex = vPowUnchecked[i].second;
+        diskindex.nStatus |= BLOCK_POW_CHECKED;
+        batch.Write(make_pair('b', pindex->GetBlockHash()), diskindex);
+    }
+    LogPrintf("%s : checked the proof of work of %u headers\n", __func__, vPowUnchecked.size());
+    return WriteBatch(batch);
 }
 
 CZerocoinDB::CZerocoinDB(size_t nCacheSize, bool fMemory, bool fWipe) : CLevelDBWrapper(GetDataDir() / "zerocoin", nCacheSize, fMemory, fWipe)
@@ -424,3 +1205,32 @@ bool CZerocoinDB::EraseAccumulatorValue(const uint32_t& nChecksum)
     LogPrint("zero", "%s : checksum:%d\n", __func__, nChecksum);
     return Erase(make_pair('2', nChecksum));
 }
+
+CBlockFilterDB::CBlockFilterDB(size_t nCacheSize, bool fMemory, bool fWipe) : CLevelDBWrapper(GetDataDir() / "blocks" / "filter", nCacheSize, fMemory, fWipe)
+{
+}
+
+bool CBlockFilterDB::ReadFilter(const uint256& hashBlock, CBlockFilter& filter) const
+{
+    if (!Read(make_pair('f', hashBlock), filter))
+        return false;
+    return filter.GetBlockHash() == hashBlock;
+}
+
+bool CBlockFilterDB::WriteFilter(const CBlockFilter& filter, const uint256& hashBest)
+{
+    CLevelDBBatch batch;
+    batch.Write(make_pair('f', filter.GetBlockHash()), filter);
+    batch.Write('B', hashBest);
+    return WriteBatch(batch);
+}
+
+bool CBlockFilterDB::ReadBestBlock(uint256& hashBest) const
+{
+    return Read('B', hashBest);
+}
+
+bool CBlockFilterDB::WriteBestBlock(const uint256& hashBest)
+{
+    return Write('B', hashBest);
+}
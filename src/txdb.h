@@ -7,15 +7,23 @@
 #ifndef BITCOIN_TXDB_H
 #define BITCOIN_TXDB_H
 
+#include "addressindex.h"
+#include "blockfilter.h"
 #include "leveldbwrapper.h"
 #include "main.h"
 #include "primitives/zerocoin.h"
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
 class CCoins;
 class uint256;
 
@@ -26,12 +34,28 @@ static const int64_t nMaxDbCache = sizeof(void*) > 4 ? 4096 : 1024;
 //! min. -dbcache in (MiB)
 static const int64_t nMinDbCache = 4;
 
+/** Maximum number of threads that scan the chainstate for GetStats */
+static const int MAX_STATS_THREADS = 8;
+
 /** CCoinsView backed by the LevelDB coin database (chainstate/) */
 class CCoinsViewDB : public CCoinsView
 {
 protected:
     CLevelDBWrapper db;
 
+    //! The last statistics computed, reused while the best block is the same
+    mutable CCriticalSection cs_stats;
+    mutable CCoinsStats statsCache;
+
+    //! Cursor for GetCoins and HaveCoins; it reads the state it was created on, so it is replaced after writes
+    mutable CCriticalSection cs_cursor;
+    mutable boost::scoped_ptr<leveldb::Iterator> pcursorCoins;
+    mutable uint64_t nCursorWrites;
+    std::atomic<uint64_t> nWrites;
+
+    //! The cursor positioned at the first output of txid; requires cs_cursor
+    leveldb::Iterator* SeekCoins(const uint256& txid) const;
+
 public:
     CCoinsViewDB(size_t nCacheSize, bool fMemory = false, bool fWipe = false);
 
@@ -39,7 +63,12 @@ public:
     bool HaveCoins(const uint256& txid) const;
     uint256 GetBestBlock() const;
     bool BatchWrite(CCoinsMap& mapCoins, const uint256& hashBlock);
+    //! Scan a snapshot of the database on several threads; needs no locks held
     bool GetStats(CCoinsStats& stats) const;
+    //! Write the dirty entries of mapCoins and the best block in one batch, leaving mapCoins as it is
+    bool WriteCoins(const CCoinsMap& mapCoins, const uint256& hashBlock, size_t& nBytes);
+    //! Convert the per-transaction records of older versions to per-output records, and check the format version
+    bool Upgrade();
 };
 
 /** Access to the block database (blocks/index/) */
@@ -54,6 +83,8 @@ private:
 
 public:
     bool WriteBlockIndex(const CDiskBlockIndex& blockindex);
+    /** Write block file info, the last block file and block index entries in one synced batch */
+    bool WriteBatchSync(const std::vector<std::pair<int, CBlockFileInfo> >& vFileInfo, int nLastFile, const std::vector<CDiskBlockIndex>& vBlockIndex, size_t& nBytes);
     bool ReadBlockFileInfo(int nFile, CBlockFileInfo& fileinfo);
     bool WriteBlockFileInfo(int nFile, const CBlockFileInfo& fileinfo);
     bool ReadLastBlockFile(int& nFile);
@@ -62,6 +93,20 @@ public:
     bool ReadReindexing(bool& fReindex);
     bool ReadTxIndex(const uint256& txid, CDiskTxPos& pos);
     bool WriteTxIndex(const std::vector<std::pair<uint256, CDiskTxPos> >& list);
+    bool WriteAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> >& vect);
+    bool EraseAddressIndex(const std::vector<std::pair<CAddressIndexKey, CAmount> >& vect);
+    /** The balance changes of an address in chain order, limited to [nStart, nEnd] when nEnd is set */
+    bool ReadAddressIndex(int nAddressType, const uint160& hashBytes, std::vector<std::pair<CAddressIndexKey, CAmount> >& vAddressIndex, int nStart = 0, int nEnd = 0);
+    /** Write the entries in order; null values erase theirs */
+    bool UpdateAddressUnspentIndex(const std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >& vect);
+    bool ReadAddressUnspentIndex(int nAddressType, const uint160& hashBytes, std::vector<std::pair<CAddressUnspentKey, CAddressUnspentValue> >& vUnspent);
+    /** Write the entries in order; null values erase theirs */
+    bool UpdateSpentIndex(const std::vector<std::pair<CSpentIndexKey, CSpentIndexValue> >& vect);
+    bool ReadSpentIndex(const CSpentIndexKey& key, CSpentIndexValue& value);
+    bool WriteTimestampIndex(const CTimestampIndexKey& key);
+    bool EraseTimestampIndex(const CTimestampIndexKey& key);
+    /** The hashes of the blocks with nLow <= nTime < nHigh, in time order */
+    bool ReadTimestampIndex(unsigned int nHigh, unsigned int nLow, std::vector<uint256>& vHashes);
     bool WriteFlag(const std::string& name, bool fValue);
     bool ReadFlag(const std::string& name, bool& fValue);
     bool WriteInt(const std::string& name, int nValue);
@@ -69,6 +114,73 @@ public:
     bool LoadBlockIndexGuts();
 };
 
+/** Latency and size of the chainstate flushes done by CCoinsViewFlusher */
+struct CFlushStats {
+    uint64_t nFlushes;
+    int64_t nLastMicros;
+    size_t nLastBytes;
+    int64_t nTotalMicros;
+    uint64_t nTotalBytes;
+
+    CFlushStats() : nFlushes(0), nLastMicros(0), nLastBytes(0), nTotalMicros(0), nTotalBytes(0) {}
+};
+
+/**
+ * Writes the chainstate on a background thread, so that validation does not
+ * wait for the disk.
+ *
+ * QueueBlockIndex and BatchWrite (called through pcoinsTip->Flush()) hand over
+ * a snapshot of the dirty block index entries and coins. The writer thread then
+ * stores the block index in one synced batch and the coins and best block in
+ * one batch after it. Until that is done the handed over coins are served from
+ * here, so the cache above reads the state it flushed. Only one flush is in
+ * flight at a time: the next one waits for it.
+ */
+class CCoinsViewFlusher : public CCoinsViewBacked
+{
+private:
+    CCoinsViewDB* pcoinsdb;
+    CBlockTreeDB* pblocktreedb;
+
+    mutable boost::mutex mutex;
+    mutable boost::condition_variable cond;
+    boost::thread thread;
+    bool fStop;
+    //! A flush is handed over and not written yet
+    bool fWriting;
+    //! A flush failed; the databases are no longer in step with the caches
+    bool fFailed;
+
+    //! The flush being written, or the one that failed; only changed while fWriting is false
+    CCoinsMap mapFrozen;
+    uint256 hashBlockFrozen;
+    std::vector<std::pair<int, CBlockFileInfo> > vFileInfo;
+    int nLastFile;
+    std::vector<CDiskBlockIndex> vBlockIndex;
+
+    CFlushStats flushStats;
+
+    void ThreadFlush();
+
+public:
+    /** Reads go to baseIn, writes to pcoinsdbIn and pblocktreeIn */
+    CCoinsViewFlusher(CCoinsView* baseIn, CCoinsViewDB* pcoinsdbIn, CBlockTreeDB* pblocktreeIn);
+    ~CCoinsViewFlusher();
+
+    bool GetCoins(const uint256& txid, CCoins& coins) const;
+    bool HaveCoins(const uint256& txid) const;
+    uint256 GetBestBlock() const;
+    bool BatchWrite(CCoinsMap& mapCoins, const uint256& hashBlock);
+    bool GetStats(CCoinsStats& stats) const;
+
+    /** Block index changes to write with the next BatchWrite */
+    void QueueBlockIndex(const std::vector<std::pair<int, CBlockFileInfo> >& vFileInfoIn, int nLastFileIn, const std::vector<CDiskBlockIndex>& vBlockIndexIn);
+    bool IsWriting() const;
+    /** Wait until the flush in flight is written; false if any flush failed */
+    bool Wait() const;
+    CFlushStats GetFlushStats() const;
+};
+
 /** Zerocoin database (zerocoin/) */
 class CZerocoinDB : public CLevelDBWrapper
 {
@@ -96,4 +208,22 @@ public:
     bool EraseAccumulatorValue(const uint32_t& nChecksum);
 };
 
+/** Compact block filters (blocks/filter/), keyed by block hash */
+class CBlockFilterDB : public CLevelDBWrapper
+{
+public:
+    CBlockFilterDB(size_t nCacheSize, bool fMemory = false, bool fWipe = false);
+
+private:
+    CBlockFilterDB(const CBlockFilterDB&);
+    void operator=(const CBlockFilterDB&);
+
+public:
+    bool ReadFilter(const uint256& hashBlock, CBlockFilter& filter) const;
+    /** Write the filter of a block and make that block the index's best in one batch */
+    bool WriteFilter(const CBlockFilter& filter, const uint256& hashBest);
+    bool ReadBestBlock(uint256& hashBest) const;
+    bool WriteBestBlock(const uint256& hashBest);
+};
+
 #endif // BITCOIN_TXDB_H
@@ -13,6 +13,7 @@
 
 #include "allocators.h"
 #include "chainparamsbase.h"
+#include "perfstats.h"
 #include "random.h"
 #include "serialize.h"
 #include "sync.h"
@@ -41,6 +42,7 @@
 #endif // __linux__
 
 #include <algorithm>
+#include <exception>
 #include <fcntl.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
@@ -209,6 +211,25 @@ static boost::once_flag debugPrintInitFlag = BOOST_ONCE_INIT;
  */
 static FILE* fileout = NULL;
 static boost::mutex* mutexDebugLog = NULL;
+static boost::condition_variable* condDebugLog = NULL;
+
+/**
+ * While the log writer thread runs, LogPrintStr only appends to strLogBuffer
+ * under mutexDebugLog and the thread swaps the whole buffer out and writes it
+ * to debug.log without holding the lock, so callers never wait on the disk.
+ * Once nMaxLogBuffer bytes are pending further messages are dropped and
+ * counted, rather than letting a slow disk stall the logging thread.
+ */
+static std::string* pstrLogBuffer = NULL;
+static size_t nMaxLogBuffer = DEFAULT_LOG_BUFFER_SIZE;
+static uint64_t nLogDropped = 0;
+static boost::thread* pthreadLogWriter = NULL;
+static bool fLogWriterRunning = false;
+static bool fLogWriterStop = false;
+//! The log writer thread is writing a buffer it swapped out
+static bool fLogWriterBusy = false;
+static boost::condition_variable* condDebugLogWritten = NULL;
+static std::terminate_handler terminatePrevious = NULL;
 
 static void DebugPrintInit()
 {
@@ -220,6 +241,131 @@ static void DebugPrintInit()
     if (fileout) setbuf(fileout, NULL); // unbuffered
 
     mutexDebugLog = new boost::mutex();
+    condDebugLog = new boost::condition_variable();
+    condDebugLogWritten = new boost::condition_variable();
+    pstrLogBuffer = new std::string();
+}
+
+static void ReopenDebugLog()
+{
+    fReopenDebugLog = false;
+    boost::filesystem::path pathDebug = GetDataDir() / "debug.log";
+    if (freopen(pathDebug.string().c_str(), "a", fileout) != NULL)
+        setbuf(fileout, NULL); // unbuffered
+}
+
+static void ThreadLogWriter()
+{
+    RenameThread("hoolibet-log");
+    static CPerfCounter& counterDropped = GetPerfCounter("log.dropped");
+    std::string strWrite;
+    while (true) {
+        uint64_t nDropped;
+        {
+            boost::mutex::scoped_lock scoped_lock(*mutexDebugLog);
+            while (pstrLogBuffer->empty() && !fLogWriterStop)
+                condDebugLog->wait(scoped_lock);
+            if (pstrLogBuffer->empty()) {
+                // Stopping with nothing left to write: later messages are written directly again
+                fLogWriterRunning = false;
+                return;
+            }
+            strWrite.clear();
+            pstrLogBuffer->swap(strWrite);
+            nDropped = nLogDropped;
+            nLogDropped = 0;
+            fLogWriterBusy = true;
+        }
+
+        // Only this thread touches fileout while it is busy, FlushDebugLog waits for it
+        if (fReopenDebugLog)
+            ReopenDebugLog();
+        if (nDropped > 0) {
+            counterDropped.Add(nDropped);
+            strWrite += strprintf("%u log messages dropped, debug.log could not keep up\n", nDropped);
+        }
+        fwrite(strWrite.data(), 1, strWrite.size(), fileout);
+
+        {
+            boost::mutex::scoped_lock scoped_lock(*mutexDebugLog);
+            fLogWriterBusy = false;
+        }
+        condDebugLogWritten->notify_all();
+    }
+}
+
+/** Get the last messages into debug.log before std::terminate aborts the process */
+static void DebugLogTerminate()
+{
+    FlushDebugLog();
+    if (terminatePrevious != NULL)
+        terminatePrevious();
+    abort();
+}
+
+void StartDebugLogThread(size_t nMaxBuffer)
+{
+    if (!fPrintToDebugLog || fPrintToConsole || !AreBaseParamsConfigured())
+        return;
+    boost::call_once(&DebugPrintInit, debugPrintInitFlag);
+    if (fileout == NULL)
+        return;
+
+    boost::mutex::scoped_lock scoped_lock(*mutexDebugLog);
+    if (pthreadLogWriter != NULL)
+        return;
+    nMaxLogBuffer = nMaxBuffer;
+    pstrLogBuffer->reserve(64 * 1024);
+    fLogWriterStop = false;
+    fLogWriterRunning = true;
+    pthreadLogWriter = new boost::thread(&ThreadLogWriter);
+    if (terminatePrevious == NULL)
+        terminatePrevious = std::set_terminate(DebugLogTerminate);
+}
+
+void StopDebugLogThread()
+{
+    if (mutexDebugLog == NULL)
+        return;
+    boost::thread* pthread;
+    {
+        boost::mutex::scoped_lock scoped_lock(*mutexDebugLog);
+        pthread = pthreadLogWriter;
+        pthreadLogWriter = NULL;
+        fLogWriterStop = true;
+    }
+    if (pthread == NULL)
+        return;
+    condDebugLog->notify_one();
+    // The writer drains everything logged up to now before it exits
+    pthread->join();
+    delete pthread;
+}
+
+void FlushDebugLog()
+{
+    if (mutexDebugLog == NULL)
+        return;
+    boost::mutex::scoped_lock scoped_lock(*mutexDebugLog);
+    // The writer cannot wait for itself, it only gets here by failing
+    if (!fLogWriterRunning || (pthreadLogWriter != NULL && pthreadLogWriter->get_id() == boost::this_thread::get_id()))
+        return;
+    // Whatever the writer holds is older than the buffer, so it goes first
+    while (fLogWriterBusy)
+        condDebugLogWritten->wait(scoped_lock);
+    if (fReopenDebugLog)
+        ReopenDebugLog();
+    fwrite(pstrLogBuffer->data(), 1, pstrLogBuffer->size(), fileout);
+    pstrLogBuffer->clear();
+}
+
+namespace
+{
+struct CLogCategoryCache {
+    std::set<string> setCategories;
+    //! Whether each category seen by this thread is logged, by the address of its string literal
+    std::map<const char*, bool> mapAccepted;
+};
 }
 
 bool LogAcceptCategory(const char* category)
@@ -232,31 +378,52 @@ bool LogAcceptCategory(const char* category)
         // This helps prevent issues debugging global destructors,
         // where mapMultiArgs might be deleted before another
         // global destructor calls LogPrint()
-        static boost::thread_specific_ptr<set<string> > ptrCategory;
+        static boost::thread_specific_ptr<CLogCategoryCache> ptrCategory;
         if (ptrCategory.get() == NULL) {
             const vector<string>& categories = mapMultiArgs["-debug"];
-            ptrCategory.reset(new set<string>(categories.begin(), categories.end()));
-            // thread_specific_ptr automatically deletes the set when the thread ends.
+            ptrCategory.reset(new CLogCategoryCache());
+            ptrCategory->setCategories.insert(categories.begin(), categories.end());
+            // thread_specific_ptr automatically deletes the cache when the thread ends.
             // "hoolibet" is a composite category enabling all HooliBet-related debug output
-            if (ptrCategory->count(string("hoolibet"))) {
-                ptrCategory->insert(string("obfuscation"));
-                ptrCategory->insert(string("swiftx"));
-                ptrCategory->insert(string("masternode"));
-                ptrCategory->insert(string("mnpayments"));
-                ptrCategory->insert(string("zero"));
-                ptrCategory->insert(string("mnbudget"));
+            if (ptrCategory->setCategories.count(string("hoolibet"))) {
+                ptrCategory->setCategories.insert(string("obfuscation"));
+                ptrCategory->setCategories.insert(string("swiftx"));
+                ptrCategory->setCategories.insert(string("masternode"));
+                ptrCategory->setCategories.insert(string("mnpayments"));
+                ptrCategory->setCategories.insert(string("zero"));
+                ptrCategory->setCategories.insert(string("mnbudget"));
             }
         }
-        const set<string>& setCategories = *ptrCategory.get();
+        CLogCategoryCache& cache = *ptrCategory.get();
+
+        // Categories are string literals, so after the first call a category
+        // costs one pointer comparison per tree level instead of building a string
+        std::map<const char*, bool>::const_iterator it = cache.mapAccepted.find(category);
+        if (it != cache.mapAccepted.end())
+            return it->second;
 
         // if not debugging everything and not debugging specific category, LogPrint does nothing.
-        if (setCategories.count(string("")) == 0 &&
-            setCategories.count(string(category)) == 0)
-            return false;
+        bool fAccept = cache.setCategories.count(string("")) != 0 ||
+                       cache.setCategories.count(string(category)) != 0;
+        cache.mapAccepted.insert(std::make_pair(category, fAccept));
+        return fAccept;
     }
     return true;
 }
 
+/** The timestamp prefix of a new line, formatted at most once a second. Called with mutexDebugLog held. */
+static const std::string& LogTimestampStr()
+{
+    static int64_t nLastTime = -1;
+    static std::string strLastTimestamp;
+    int64_t nTime = GetTime();
+    if (nTime != nLastTime) {
+        nLastTime = nTime;
+        strLastTimestamp = DateTimeStrFormat("%Y-%m-%d %H:%M:%S", nTime) + " ";
+    }
+    return strLastTimestamp;
+}
+
 int LogPrintStr(const std::string& str)
 {
     int ret = 0; // Returns total number of characters written
@@ -273,22 +440,34 @@ int LogPrintStr(const std::string& str)
 
         boost::mutex::scoped_lock scoped_lock(*mutexDebugLog);
 
-        // reopen the log file, if requested
-        if (fReopenDebugLog) {
-            fReopenDebugLog = false;
-            boost::filesystem::path pathDebug = GetDataDir() / "debug.log";
-            if (freopen(pathDebug.string().c_str(), "a", fileout) != NULL)
-                setbuf(fileout, NULL); // unbuffered
-        }
-
-        // Debug print useful for profiling
-        if (fLogTimestamps && fStartedNewLine)
-            ret += fprintf(fileout, "%s ", DateTimeStrFormat("%Y-%m-%d %H:%M:%S", GetTime()).c_str());
+        bool fTimestamp = fLogTimestamps && fStartedNewLine;
         if (!str.empty() && str[str.size() - 1] == '\n')
             fStartedNewLine = true;
         else
             fStartedNewLine = false;
 
+        if (fLogWriterRunning) {
+            const std::string& strTimestamp = fTimestamp ? LogTimestampStr() : std::string();
+            if (pstrLogBuffer->size() + strTimestamp.size() + str.size() > nMaxLogBuffer) {
+                nLogDropped++;
+                return ret;
+            }
+            bool fWasEmpty = pstrLogBuffer->empty();
+            pstrLogBuffer->append(strTimestamp);
+            pstrLogBuffer->append(str);
+            if (fWasEmpty)
+                condDebugLog->notify_one();
+            return strTimestamp.size() + str.size();
+        }
+
+        // reopen the log file, if requested
+        if (fReopenDebugLog)
+            ReopenDebugLog();
+
+        // Debug print useful for profiling
+        if (fTimestamp)
+            ret += fprintf(fileout, "%s", LogTimestampStr().c_str());
+
         ret = fwrite(str.data(), 1, str.size(), fileout);
     }
 
@@ -417,6 +596,7 @@ void PrintExceptionContinue(std::exception* pex, const char* pszThread)
 {
     std::string message = FormatException(pex, pszThread);
     LogPrintf("\n\n************************\n%s\n", message);
+    FlushDebugLog();
     fprintf(stderr, "\n\n************************\n%s\n", message.c_str());
     strMiscWarning = message;
 }
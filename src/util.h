@@ -62,10 +62,19 @@ extern volatile bool fReopenDebugLog;
 void SetupEnvironment();
 bool SetupNetworking();
 
-/** Return true if log accepts specified category */
+/** Upper bound on debug.log output waiting for the log writer thread, beyond which messages are dropped */
+static const size_t DEFAULT_LOG_BUFFER_SIZE = 16 * 1024 * 1024;
+
+/** Return true if log accepts specified category, which must be a string literal */
 bool LogAcceptCategory(const char* category);
 /** Send a string to the log output */
 int LogPrintStr(const std::string& str);
+/** Hand debug.log writes to a background thread, so logging never waits on the disk */
+void StartDebugLogThread(size_t nMaxBuffer = DEFAULT_LOG_BUFFER_SIZE);
+/** Write out everything logged so far and stop the log writer thread */
+void StopDebugLogThread();
+/** Write out everything logged so far from the calling thread, for the paths that end the process */
+void FlushDebugLog();
 
 #define LogPrintf(...) LogPrint(NULL, __VA_ARGS__)
 
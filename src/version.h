@@ -11,7 +11,7 @@
  * network protocol versioning
  */
 
-static const int PROTOCOL_VERSION = 70920;
+static const int PROTOCOL_VERSION = 70922;
 
 //! initial proto version, to be increased after version/verack negotiation
 static const int INIT_PROTO_VERSION = 209;
@@ -19,6 +19,12 @@ static const int INIT_PROTO_VERSION = 209;
 //! In this version, 'getheaders' was introduced.
 static const int GETHEADERS_VERSION = 70077;
 
+//! 'getheaders' is answered with 'headers' for headers-first sync starting with this version
+static const int HEADERS_FIRST_VERSION = 70921;
+
+//! short-id-based block download (BIP 152) starts with this version
+static const int SHORT_IDS_BLOCKS_VERSION = 70922;
+
 //! disconnect from peers older than this proto version
 static const int MIN_PEER_PROTO_VERSION_BEFORE_ENFORCEMENT = 70920;
 static const int MIN_PEER_PROTO_VERSION_AFTER_ENFORCEMENT = 70920;
@@ -31,6 +31,7 @@
 #include "zhbetwallet.h"
 #include "primitives/deterministicmint.h"
 #include <assert.h>
+#include <atomic>
 
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/thread.hpp>
@@ -1424,10 +1425,187 @@ bool CWalletTx::WriteToDisk()
     return CWalletDB(pwallet->strWalletFile).WriteTx(GetHash(), *this);
 }
 
+bool CWalletScanFilter::IsRelevant(const CTransaction& tx) const
+{
+    if (setWalletTxids.count(tx.GetHash()))
+        return true;
+    BOOST_FOREACH (const CTxIn& txin, tx.vin) {
+        if (setWalletTxids.count(txin.prevout.hash))
+            return true;
+    }
+
+    // Same cases as IsMine(), only any one of our keys is enough
+    std::vector<std::vector<unsigned char> > vSolutions;
+    BOOST_FOREACH (const CTxOut& txout, tx.vout) {
+        if (!setWholeScriptIDs.empty() && setWholeScriptIDs.count(CScriptID(txout.scriptPubKey)))
+            return true;
+
+        txnouttype whichType;
+        if (!Solver(txout.scriptPubKey, whichType, vSolutions))
+            continue;
+        switch (whichType) {
+        case TX_PUBKEY:
+        case TX_ZEROCOINMINT:
+            if (setIDs.count(CPubKey(vSolutions[0]).GetID()))
+                return true;
+            break;
+        case TX_PUBKEYHASH:
+        case TX_SCRIPTHASH:
+            if (setIDs.count(uint160(vSolutions[0])))
+                return true;
+            break;
+        case TX_MULTISIG:
+            for (unsigned int i = 1; i + 1 < vSolutions.size(); i++) {
+                if (setIDs.count(CPubKey(vSolutions[i]).GetID()))
+                    return true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
+bool CWalletScanFilter::HasMyMint(const CTransaction& tx) const
+{
+    if (setPubcoinHashes.empty() || !tx.IsZerocoinMint())
+        return false;
+
+    BOOST_FOREACH (const CTxOut& txout, tx.vout) {
+        uint256 hashPubcoin;
+        if (TxOutToPubcoinHash(txout, hashPubcoin) && setPubcoinHashes.count(hashPubcoin))
+            return true;
+    }
+    return false;
+}
+
+void CWallet::GetScanFilter(CWalletScanFilter& filter) const
+{
+    LOCK(cs_wallet);
+    std::set<CKeyID> setKeys;
+    GetKeys(setKeys);
+    filter.setIDs.insert(setKeys.begin(), setKeys.end());
+    {
+        LOCK(cs_KeyStore);
+        BOOST_FOREACH (const PAIRTYPE(CScriptID, CScript) & item, mapScripts)
+            filter.setIDs.insert(item.first);
+        BOOST_FOREACH (const CScript& script, setWatchOnly)
+            filter.setWholeScriptIDs.insert(CScriptID(script));
+        BOOST_FOREACH (const CScript& script, setMultiSig)
+            filter.setWholeScriptIDs.insert(CScriptID(script));
+    }
+
+    if (zhbetTracker)
+        filter.setPubcoinHashes = zhbetTracker->GetPubcoinHashes();
+    if (zwalletMain) {
+        std::list<std::pair<uint256, uint32_t> > listMintPool = zwalletMain->ListMintPool();
+        for (auto& pMint : listMintPool)
+            filter.setPubcoinHashes.insert(pMint.first);
+    }
+
+    for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it)
+        filter.setWalletTxids.insert(it->first);
+
+    if (!pblockfilterdb)
+        return;
+
+    // The block filters hold whole scripts, so list the ones our keys and scripts
+    // are paid to, including the multisig scripts added with AddMultiSig. Other
+    // bare multisig of our keys can combine them in any order and is not listed,
+    // so a block that pays us only through such a script is skipped.
+    filter.fBlockFilters = true;
+    BOOST_FOREACH (const CKeyID& keyID, setKeys) {
+        CPubKey pubkey;
+        if (!GetPubKey(keyID, pubkey))
+            continue;
+        filter.setFilterElements.insert(BlockFilterElement(GetScriptForDestination(keyID)));
+        filter.setFilterElements.insert(BlockFilterElement(CScript() << ToByteVector(pubkey) << OP_CHECKSIG));
+    }
+    {
+        LOCK(cs_KeyStore);
+        BOOST_FOREACH (const PAIRTYPE(CScriptID, CScript) & item, mapScripts)
+            filter.setFilterElements.insert(BlockFilterElement(GetScriptForDestination(item.first)));
+        BOOST_FOREACH (const CScript& script, setWatchOnly)
+            filter.setFilterElements.insert(BlockFilterElement(script));
+        BOOST_FOREACH (const CScript& script, setMultiSig)
+            filter.setFilterElements.insert(BlockFilterElement(script));
+    }
+    for (map<uint256, CWalletTx>::const_iterator it = mapWallet.begin(); it != mapWallet.end(); ++it) {
+        for (unsigned int i = 0; i < it->second.vout.size(); i++) {
+            if (IsMine(it->second.vout[i]) != ISMINE_NO)
+                filter.setFilterElements.insert(BlockFilterElement(COutPoint(it->first, i)));
+        }
+    }
+    BOOST_FOREACH (const uint256& hashPubcoin, filter.setPubcoinHashes)
+        filter.setFilterElements.insert(BlockFilterElement(hashPubcoin));
+    if (zhbetTracker) {
+        std::vector<uint256> vSerialHashes = zhbetTracker->GetSerialHashes();
+        BOOST_FOREACH (const uint256& hashSerial, vSerialHashes)
+            filter.setFilterElements.insert(BlockFilterElement(hashSerial));
+    }
+}
+
+/** A block read by a rescan worker, with the transactions that may be ours */
+struct CRescanBlock {
+    CBlockIndex* pindex;
+    //! Taken from pindex under cs_main, as the workers run without it
+    uint256 hashBlock;
+    CDiskBlockPos pos;
+    CBlock block;
+    bool fRead;
+    std::vector<bool> vRelevant;
+    bool fHasMyMint;
+    //! Whether the block filter index covers this block
+    bool fUseFilter;
+    //! Whether the block was skipped because its filter matched none of our elements
+    bool fFiltered;
+    CBlockFilter filter;
+
+    CRescanBlock(CBlockIndex* pindexIn) : pindex(pindexIn), hashBlock(pindexIn->GetBlockHash()), pos(pindexIn->GetBlockPos()), fRead(false), fHasMyMint(false), fUseFilter(false), fFiltered(false) {}
+};
+
+static void ReadRescanBlock(CRescanBlock& rescan, const CWalletScanFilter& filter)
+{
+    if (!ReadBlockFromDisk(rescan.block, rescan.pos))
+        return;
+    if (rescan.block.GetHash() != rescan.hashBlock) {
+        LogPrintf("%s : block=%s index=%s\n", __func__, rescan.block.GetHash().ToString(), rescan.hashBlock.ToString());
+        return;
+    }
+    rescan.fRead = true;
+    rescan.fFiltered = false;
+    rescan.vRelevant.resize(rescan.block.vtx.size());
+    for (size_t j = 0; j < rescan.block.vtx.size(); j++) {
+        const CTransaction& tx = rescan.block.vtx[j];
+        rescan.vRelevant[j] = filter.IsRelevant(tx);
+        if (filter.HasMyMint(tx))
+            rescan.fHasMyMint = true;
+    }
+}
+
+static void ThreadReadRescanBlocks(std::vector<CRescanBlock>* pvBlocks, std::atomic<size_t>* pnNext, const CWalletScanFilter* pfilter)
+{
+    size_t i;
+    while ((i = (*pnNext)++) < pvBlocks->size()) {
+        CRescanBlock& rescan = (*pvBlocks)[i];
+        if (rescan.fUseFilter && pblockfilterdb->ReadFilter(rescan.hashBlock, rescan.filter) && !rescan.filter.GetFilter().MatchAny(pfilter->setFilterElements)) {
+            rescan.fFiltered = true;
+            continue;
+        }
+        ReadRescanBlock(rescan, *pfilter);
+    }
+}
+
 /**
  * Scan the block chain (starting in pindexStart) for transactions
  * from or to us. If fUpdate is true, found transactions that already
  * exist in the wallet will be updated.
+ *
+ * Blocks are read and matched against a CWalletScanFilter on worker threads,
+ * RESCAN_BATCH_SIZE blocks at a time; cs_main and cs_wallet are only taken to
+ * apply the matches of a batch in height order. With -blockfilterindex, blocks
+ * whose filter matches none of our elements are not read at all.
  */
 int CWallet::ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate)
 {
@@ -1437,39 +1615,106 @@ int CWallet::ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate)
     if (fCheckZHBET)
         zhbetTracker->Init();
 
+    CWalletScanFilter filter;
+    GetScanFilter(filter);
+
+    int nThreads = std::max(1, std::min((int)boost::thread::hardware_concurrency(), MAX_RESCAN_THREADS));
+
     CBlockIndex* pindex = pindexStart;
+    double dProgressStart, dProgressTip;
     {
-        LOCK2(cs_main, cs_wallet);
+        LOCK(cs_main);
 
         // no need to read and scan block, if block was created before
         // our wallet birthday (as adjusted for block time variability)
         while (pindex && nTimeFirstKey && (pindex->GetBlockTime() < (nTimeFirstKey - 7200)) && pindex->nHeight <= Params().Zerocoin_StartHeight())
             pindex = chainActive.Next(pindex);
 
-        ShowProgress(_("Rescanning..."), 0); // show rescan progress in GUI as dialog or on splashscreen, if -rescan on startup
-        double dProgressStart = Checkpoints::GuessVerificationProgress(pindex, false);
-        double dProgressTip = Checkpoints::GuessVerificationProgress(chainActive.Tip(), false);
-        set<uint256> setAddedToWallet;
-        while (pindex) {
-            if (pindex->nHeight % 100 == 0 && dProgressTip - dProgressStart > 0.0)
-                ShowProgress(_("Rescanning..."), std::max(1, std::min(99, (int)((Checkpoints::GuessVerificationProgress(pindex, false) - dProgressStart) / (dProgressTip - dProgressStart) * 100))));
-
-            CBlock block;
-            ReadBlockFromDisk(block, pindex);
-            BOOST_FOREACH (CTransaction& tx, block.vtx) {
-                if (AddToWalletIfInvolvingMe(tx, &block, fUpdate))
+        dProgressStart = Checkpoints::GuessVerificationProgress(pindex, false);
+        dProgressTip = Checkpoints::GuessVerificationProgress(chainActive.Tip(), false);
+    }
+
+    ShowProgress(_("Rescanning..."), 0); // show rescan progress in GUI as dialog or on splashscreen, if -rescan on startup
+    set<uint256> setAddedToWallet;
+    GCSFilter::ElementSet setFoundElements;
+    int nFiltered = 0;
+    while (pindex) {
+        std::vector<CRescanBlock> vBlocks;
+        {
+            LOCK(cs_main);
+            for (CBlockIndex* pindexBatch = pindex; pindexBatch && vBlocks.size() < RESCAN_BATCH_SIZE; pindexBatch = chainActive.Next(pindexBatch)) {
+                vBlocks.push_back(CRescanBlock(pindexBatch));
+                vBlocks.back().fUseFilter = filter.fBlockFilters && BlockFilterIndexCovers(pindexBatch);
+            }
+        }
+
+        // Read and match the batch; this thread is one of the readers
+        std::atomic<size_t> nNext(0);
+        boost::thread_group threadGroup;
+        for (int i = 1; i < std::min(nThreads, (int)vBlocks.size()); i++)
+            threadGroup.create_thread(boost::bind(&ThreadReadRescanBlocks, &vBlocks, &nNext, &filter));
+        ThreadReadRescanBlocks(&vBlocks, &nNext, &filter);
+        threadGroup.join_all();
+
+        LOCK2(cs_main, cs_wallet);
+        // Transactions added to the wallet since the filter was taken can be spent by
+        // transactions it doesn't match, so those are then checked against mapWallet
+        bool fWalletChanged = mapWallet.size() != filter.setWalletTxids.size();
+        pindex = NULL;
+        BOOST_FOREACH (CRescanBlock& rescan, vBlocks) {
+            if (!chainActive.Contains(rescan.pindex)) {
+                // Reorganized while reading; carry on from the fork
+                pindex = chainActive.Next(chainActive.FindFork(rescan.pindex));
+                break;
+            }
+            pindex = chainActive.Next(rescan.pindex);
+            if (rescan.fFiltered) {
+                // The filter was tested against the snapshot; spends of outputs this
+                // rescan found since are only caught by testing it again
+                if (setFoundElements.empty() || !rescan.filter.GetFilter().MatchAny(setFoundElements)) {
+                    nFiltered++;
+                    continue;
+                }
+                ReadRescanBlock(rescan, filter);
+            }
+            if (!rescan.fRead) {
+                LogPrintf("%s : failed to read block %s\n", __func__, rescan.pindex->GetBlockHash().ToString());
+                continue;
+            }
+
+            const CBlock& block = rescan.block;
+            for (size_t i = 0; i < block.vtx.size(); i++) {
+                const CTransaction& tx = block.vtx[i];
+                if (!rescan.vRelevant[i]) {
+                    if (!fWalletChanged)
+                        continue;
+                    bool fSpendsWalletTx = mapWallet.count(tx.GetHash()) != 0;
+                    for (unsigned int j = 0; j < tx.vin.size() && !fSpendsWalletTx; j++)
+                        fSpendsWalletTx = mapWallet.count(tx.vin[j].prevout.hash) != 0;
+                    if (!fSpendsWalletTx)
+                        continue;
+                }
+                if (AddToWalletIfInvolvingMe(tx, &block, fUpdate)) {
                     ret++;
+                    fWalletChanged = true;
+                    if (filter.fBlockFilters) {
+                        for (unsigned int j = 0; j < tx.vout.size(); j++) {
+                            if (IsMine(tx.vout[j]) != ISMINE_NO)
+                                setFoundElements.insert(BlockFilterElement(COutPoint(tx.GetHash(), j)));
+                        }
+                    }
+                }
             }
 
             //If this is a zapwallettx, need to readd zhbet
-            if (fCheckZHBET && pindex->nHeight >= Params().Zerocoin_StartHeight()) {
+            if (fCheckZHBET && rescan.fHasMyMint && rescan.pindex->nHeight >= Params().Zerocoin_StartHeight()) {
                 list<CZerocoinMint> listMints;
                 BlockToZerocoinMintList(block, listMints, true);
 
                 for (auto& m : listMints) {
                     if (IsMyMint(m.GetValue())) {
                         LogPrint("zero", "%s: found mint\n", __func__);
-                        pwalletMain->UpdateMint(m.GetValue(), pindex->nHeight, m.GetTxHash(), m.GetDenomination());
+                        pwalletMain->UpdateMint(m.GetValue(), rescan.pindex->nHeight, m.GetTxHash(), m.GetDenomination());
 
                         // Add the transaction to the wallet
                         for (auto& tx : block.vtx) {
@@ -1482,6 +1727,7 @@ int CWallet::ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate)
                                 wtx.SetMerkleBranch(block);
                                 pwalletMain->AddToWallet(wtx);
                                 setAddedToWallet.insert(txid);
+                                fWalletChanged = true;
                             }
                         }
 
@@ -1502,19 +1748,23 @@ int CWallet::ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate)
                             wtx.nTimeReceived = pindexSpend->nTime;
                             pwalletMain->AddToWallet(wtx);
                             setAddedToWallet.emplace(txidSpend);
+                            fWalletChanged = true;
                         }
                     }
                 }
             }
+        }
 
-            pindex = chainActive.Next(pindex);
-            if (GetTime() >= nNow + 60) {
-                nNow = GetTime();
-                LogPrintf("Still rescanning. At block %d. Progress=%f\n", pindex->nHeight, Checkpoints::GuessVerificationProgress(pindex));
-            }
+        if (pindex && dProgressTip - dProgressStart > 0.0)
+            ShowProgress(_("Rescanning..."), std::max(1, std::min(99, (int)((Checkpoints::GuessVerificationProgress(pindex, false) - dProgressStart) / (dProgressTip - dProgressStart) * 100))));
+        if (pindex && GetTime() >= nNow + 60) {
+            nNow = GetTime();
+            LogPrintf("Still rescanning. At block %d. Progress=%f\n", pindex->nHeight, Checkpoints::GuessVerificationProgress(pindex));
         }
-        ShowProgress(_("Rescanning..."), 100); // hide progress dialog in GUI
     }
+    ShowProgress(_("Rescanning..."), 100); // hide progress dialog in GUI
+    if (filter.fBlockFilters)
+        LogPrintf("%s : %d blocks skipped through their block filter\n", __func__, nFiltered);
     return ret;
 }
 
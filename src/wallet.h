@@ -10,6 +10,7 @@
 
 #include "amount.h"
 #include "base58.h"
+#include "blockfilter.h"
 #include "crypter.h"
 #include "kernel.h"
 #include "key.h"
@@ -58,6 +59,10 @@ static const CAmount nHighTransactionMaxFeeWarning = 100 * nHighTransactionFeeWa
 static const unsigned int MAX_FREE_TRANSACTION_CREATE_SIZE = 1000;
 //! -custombackupthreshold default
 static const int DEFAULT_CUSTOMBACKUPTHRESHOLD = 1;
+//! Blocks read ahead by the rescan workers before their matches are applied
+static const unsigned int RESCAN_BATCH_SIZE = 256;
+//! Most threads a rescan reads blocks with
+static const int MAX_RESCAN_THREADS = 8;
 
 // Zerocoin denomination which creates exactly one of each denominations:
 // 6666 = 1*5000 + 1*1000 + 1*500 + 1*100 + 1*50 + 1*10 + 1*5 + 1
@@ -158,6 +163,32 @@ public:
     StringMap destdata;
 };
 
+/**
+ * The key, script and pubcoin hashes a wallet can recognise, taken at the start of a rescan
+ * so that blocks can be matched on worker threads without holding cs_wallet. A match is a
+ * superset of IsMine/IsFromMe: it only means the transaction has to be looked at under the lock.
+ */
+class CWalletScanFilter
+{
+public:
+    //! Key IDs, and script IDs of the redeem scripts we know
+    std::set<uint160> setIDs;
+    //! Script IDs of the watch-only and multisig scripts, which are matched whole
+    std::set<uint160> setWholeScriptIDs;
+    //! Our pubcoins, tracked or still in the deterministic mint pool
+    std::set<uint256> setPubcoinHashes;
+    //! Transactions already in the wallet, so updates and spends of them are found
+    std::set<uint256> setWalletTxids;
+    //! With -blockfilterindex: our scripts, outpoints, pubcoin and serial hashes as block filter elements
+    GCSFilter::ElementSet setFilterElements;
+    bool fBlockFilters;
+
+    CWalletScanFilter() : fBlockFilters(false) {}
+
+    bool IsRelevant(const CTransaction& tx) const;
+    bool HasMyMint(const CTransaction& tx) const;
+};
+
 /**
  * A CWallet is an extension of a keystore, which also maintains a set of transactions and balances,
  * and provides the ability to create new transactions.
@@ -296,6 +327,7 @@ public:
         fFileBacked = false;
         nMasterKeyMaxID = 0;
         pwalletdbEncryption = NULL;
+        zwalletMain = NULL;
         nOrderPosNext = 0;
         nNextResend = 0;
         nLastResend = 0;
@@ -467,6 +499,7 @@ public:
     void SyncTransaction(const CTransaction& tx, const CBlock* pblock);
     bool AddToWalletIfInvolvingMe(const CTransaction& tx, const CBlock* pblock, bool fUpdate);
     void EraseFromWallet(const uint256& hash);
+    void GetScanFilter(CWalletScanFilter& filter) const;
     int ScanForWalletTransactions(CBlockIndex* pindexStart, bool fUpdate = false);
     void ReacceptWalletTransactions();
     void ResendWalletTransactions();
@@ -367,6 +367,18 @@ bool TxOutToPublicCoin(const CTxOut& txout, libzerocoin::PublicCoin& pubCoin, CV
     return true;
 }
 
+//hash of the pubcoin value of a mint output, without building the PublicCoin
+bool TxOutToPubcoinHash(const CTxOut& txout, uint256& hashPubcoin)
+{
+    if (!txout.scriptPubKey.IsZerocoinMint() || txout.scriptPubKey.size() <= SCRIPT_OFFSET)
+        return false;
+
+    CBigNum bnValue;
+    bnValue.setvch(vector<unsigned char>(txout.scriptPubKey.begin() + SCRIPT_OFFSET, txout.scriptPubKey.end()));
+    hashPubcoin = GetPubCoinHash(bnValue);
+    return true;
+}
+
 //return a list of zerocoin spends contained in a specific block, list may have many denominations
 std::list<libzerocoin::CoinDenomination> ZerocoinSpendListFromBlock(const CBlock& block, bool fFilterInvalid)
 {
@@ -36,6 +36,7 @@ bool RemoveSerialFromDB(const CBigNum& bnSerial);
 // std::string ReindexZerocoinDB();
 libzerocoin::CoinSpend TxInToZerocoinSpend(const CTxIn& txin);
 bool TxOutToPublicCoin(const CTxOut& txout, libzerocoin::PublicCoin& pubCoin, CValidationState& state);
+bool TxOutToPubcoinHash(const CTxOut& txout, uint256& hashPubcoin);
 std::list<libzerocoin::CoinDenomination> ZerocoinSpendListFromBlock(const CBlock& block, bool fFilterInvalid);
 
 
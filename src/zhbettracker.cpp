@@ -175,6 +175,14 @@ std::vector<CMintMeta> CzHBETTracker::GetMints(bool fConfirmedOnly) const
     return vMints;
 }
 
+std::set<uint256> CzHBETTracker::GetPubcoinHashes() const
+{
+    std::set<uint256> setHashes;
+    for (auto& it : mapSerialHashes)
+        setHashes.insert(it.second.hashPubcoin);
+    return setHashes;
+}
+
 //Does a mint in the tracker have this txid
 bool CzHBETTracker::HasMintTx(const uint256& txid)
 {
@@ -7,6 +7,7 @@
 
 #include "primitives/zerocoin.h"
 #include <list>
+#include <set>
 
 class CDeterministicMint;
 
@@ -36,6 +37,7 @@ public:
     bool GetMetaFromStakeHash(const uint256& hashStake, CMintMeta& meta) const;
     CAmount GetBalance(bool fConfirmedOnly, bool fUnconfirmedOnly) const;
     std::vector<uint256> GetSerialHashes();
+    std::set<uint256> GetPubcoinHashes() const;
     std::vector<CMintMeta> GetMints(bool fConfirmedOnly) const;
     CAmount GetUnconfirmedBalance() const;
     std::set<CMintMeta> ListMints(bool fUnusedOnly, bool fMatureOnly, bool fUpdateStatus);
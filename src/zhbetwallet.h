@@ -37,6 +37,7 @@ public:
     void RemoveMintsFromPool(const std::vector<uint256>& vPubcoinHashes);
     bool SetMintSeen(const CBigNum& bnValue, const int& nHeight, const uint256& txid, const libzerocoin::CoinDenomination& denom);
     bool IsInMintPool(const CBigNum& bnValue) { return mintPool.Has(bnValue); }
+    std::list<std::pair<uint256, uint32_t> > ListMintPool() { return mintPool.List(); }
     void UpdateCount();
     void Lock();
     void SeedToZHBET(const uint512& seed, CBigNum& bnValue, CBigNum& bnSerial, CBigNum& bnRandomness, CKey& key);